@@ -0,0 +1,77 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2026, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Gaffer/Export.h"
+
+#include <functional>
+
+namespace Gaffer
+{
+
+namespace Private
+{
+
+/// Registers a process-wide cache of data derived from plug values, so that
+/// it is managed alongside the main ValuePlug cache :
+///
+/// - `ValuePlug::clearCache()` calls `clear()`.
+/// - `ValuePlug::setCacheMemoryLimit()` calls `setMemoryLimit()` with
+///   `memoryLimitFraction` of the new limit. It is also called immediately,
+///   with a fraction of the current limit. This fraction is taken out of the
+///   limit for the compute cache, so that the total remains within the limit.
+/// - `ValuePlug::cacheMemoryUsage()` includes the result of `memoryUsage()`.
+///
+/// Registered caches must remain alive for the lifetime of the process.
+GAFFER_API void registerCache( const std::function<void ()> &clear, const std::function<void ( size_t )> &setMemoryLimit, const std::function<size_t ()> &memoryUsage, float memoryLimitFraction );
+
+/// Convenience overload for `IECorePreview::LRUCache`. The cache must
+/// measure its costs in bytes.
+template<typename Cache>
+void registerCache( Cache *cache, float memoryLimitFraction )
+{
+	registerCache(
+		[cache] { cache->clear(); },
+		[cache] ( size_t bytes ) { cache->setMaxCost( bytes ); },
+		[cache] { return cache->currentCost(); },
+		memoryLimitFraction
+	);
+}
+
+} // namespace Private
+
+} // namespace Gaffer
@@ -150,9 +150,11 @@ class GAFFER_API ValuePlug : public Plug
 		//@{
 		/// Returns the maximum amount of memory in bytes to use for the cache.
 		static size_t getCacheMemoryLimit();
-		/// Sets the maximum amount of memory the cache may use in bytes.
+		/// Sets the maximum amount of memory the cache may use in bytes. This
+		/// limit is shared with internal caches of data derived from plug values.
 		static void setCacheMemoryLimit( size_t bytes );
-		/// Returns the current memory usage of the cache in bytes.
+		/// Returns the current memory usage of the cache in bytes, including
+		/// the internal caches that share its limit.
 		static size_t cacheMemoryUsage();
 		/// Clears the cache.
 		static void clearCache();
@@ -126,12 +126,22 @@ class GAFFERIMAGE_API ImageReader : public ImageNode
 		Gaffer::IntPlug *channelInterpretationPlug();
 		const Gaffer::IntPlug *channelInterpretationPlug() const;
 
+		Gaffer::BoolPlug *readLayersSeparatelyPlug();
+		const Gaffer::BoolPlug *readLayersSeparatelyPlug() const;
+
 		Gaffer::IntVectorDataPlug *availableFramesPlug();
 		const Gaffer::IntVectorDataPlug *availableFramesPlug() const;
 
 		Gaffer::BoolPlug *fileValidPlug();
 		const Gaffer::BoolPlug *fileValidPlug() const;
 
+		/// Name of an integer context variable used to request a reduced resolution
+		/// version of the image, as used by the Viewer when zoomed out. If the file
+		/// contains MIP levels, level `n` is read in place of the full resolution image,
+		/// and the format and data window are reduced accordingly. Requests are clamped
+		/// to the levels available, and files without MIP levels are unaffected.
+		static const IECore::InternedString proxyLevelContextName;
+
 		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
 
 		static size_t supportedExtensions( std::vector<std::string> &extensions );
@@ -87,11 +87,23 @@ class GAFFERIMAGE_API OpenImageIOReader : public ImageNode
 		Gaffer::IntPlug *channelInterpretationPlug();
 		const Gaffer::IntPlug *channelInterpretationPlug() const;
 
+		/// When on, channels are read from the file one layer at a time,
+		/// rather than reading all the channels of a subimage together.
+		Gaffer::BoolPlug *readLayersSeparatelyPlug();
+		const Gaffer::BoolPlug *readLayersSeparatelyPlug() const;
+
 		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
 
 		static void setOpenFilesLimit( size_t maxOpenFiles );
 		static size_t getOpenFilesLimit();
 
+		/// Sets the number of threads used to read tile batches ahead of
+		/// them being needed. These threads are separate from the TBB workers
+		/// used for compute, so that slow I/O doesn't stall the compute of other
+		/// tiles. A value of 0 disables reading ahead.
+		static void setReadAheadThreads( size_t numThreads );
+		static size_t getReadAheadThreads();
+
 		static size_t supportedExtensions( std::vector<std::string> &extensions );
 
 	protected :
@@ -121,6 +133,9 @@ class GAFFERIMAGE_API OpenImageIOReader : public ImageNode
 	private :
 
 		std::shared_ptr<void> retrieveFile( const Gaffer::Context *context, bool holdForBlack = false ) const;
+		// Returns the MIP level that will be read for the `ImageReader::proxyLevelContextName`
+		// variable in the context.
+		int proxyLevel( const Gaffer::Context *context, bool holdForBlack = false ) const;
 
 		Gaffer::ObjectVectorPlug *tileBatchPlug();
 		const Gaffer::ObjectVectorPlug *tileBatchPlug() const;
@@ -171,6 +171,29 @@ class GAFFERIMAGEUI_API ImageGadget : public GafferUI::Gadget
 		void setWipeAngle( float angle );
 		float getWipeAngle() const;
 
+		/// Allows a reduced resolution proxy of the image to be displayed when zoomed
+		/// out, by setting `ImageReader::proxyLevelContextName` to a level appropriate
+		/// for the current zoom, up to `maxProxyLevel`. The proxy is drawn scaled to fit
+		/// the full resolution format. This is only appropriate when the nodes between
+		/// the ImageReader and the gadget are resolution independent, so it is disabled
+		/// by default, with a `maxProxyLevel` of 0.
+		void setMaxProxyLevel( int maxProxyLevel );
+		int getMaxProxyLevel() const;
+
+		/// Once the tiles for the current frame are complete, the same tiles
+		/// that are visible in the viewport are computed in the background for
+		/// up to `prefetchFrames` subsequent frames, in the direction of the
+		/// most recent frame change. This puts them in the compute cache ready
+		/// for playback. Prefetching uses at most half of the available threads,
+		/// stops once `prefetchMemoryLimit` bytes of channel data have been
+		/// computed, and is cancelled whenever the image or context changes.
+		/// Disabled by default.
+		void setPrefetchFrames( int prefetchFrames );
+		int getPrefetchFrames() const;
+
+		void setPrefetchMemoryLimit( size_t prefetchMemoryLimit );
+		size_t getPrefetchMemoryLimit() const;
+
 		void setSelectedIDs( const std::vector<uint32_t> &ids );
 		const std::vector<uint32_t> &getSelectedIDs();
 
@@ -216,6 +239,18 @@ class GAFFERIMAGEUI_API ImageGadget : public GafferUI::Gadget
 		Imath::V2f m_wipePos;
 		float m_wipeAngle;
 
+		// Proxy display. The proxy level is chosen according to the
+		// zoom by `updateProxyLevel()`, and the scale and offset map
+		// from proxy pixel coordinates to full resolution pixel coordinates.
+
+		void updateProxyLevel() const;
+		Imath::V2f proxyToFull( const Imath::V2f &p ) const;
+
+		int m_maxProxyLevel;
+		mutable int m_proxyLevel;
+		mutable Imath::V2f m_proxyScale;
+		mutable Imath::V2f m_proxyOffset;
+
 		// Image access.
 		//
 		// We only pull on the m_image plug lazily when
@@ -255,14 +290,14 @@ class GAFFERIMAGEUI_API ImageGadget : public GafferUI::Gadget
 
 		struct TileIndex
 		{
-			TileIndex( const Imath::V2i &tileOrigin, IECore::InternedString channelName )
-				:	tileOrigin( tileOrigin ), channelName( channelName )
+			TileIndex( const Imath::V2i &tileOrigin, IECore::InternedString channelName, int proxyLevel )
+				:	tileOrigin( tileOrigin ), channelName( channelName ), proxyLevel( proxyLevel )
 			{
 			}
 
 			bool operator == ( const TileIndex &rhs ) const
 			{
-				return tileOrigin == rhs.tileOrigin && channelName == rhs.channelName;
+				return tileOrigin == rhs.tileOrigin && channelName == rhs.channelName && proxyLevel == rhs.proxyLevel;
 			}
 
 			struct Hash
@@ -276,12 +311,14 @@ class GAFFERIMAGEUI_API ImageGadget : public GafferUI::Gadget
 					// and is sufficient because all equal InternedStrings are
 					// guaranteed to have the same pointers.
 					boost::hash_combine( result, tileIndex.channelName.c_str() );
+					boost::hash_combine( result, tileIndex.proxyLevel );
 					return result;
 				}
 			};
 
 			Imath::V2i tileOrigin;
 			IECore::InternedString channelName;
+			int proxyLevel;
 		};
 
 		struct Tile
@@ -329,6 +366,16 @@ class GAFFERIMAGEUI_API ImageGadget : public GafferUI::Gadget
 
 		void updateTiles();
 		void removeOutOfBoundsTiles() const;
+		// Called from the background thread used by `updateTiles()`.
+		// Returns the part of `dataWindow` that is visible in the viewport,
+		// plus a margin.
+		Imath::Box2i prefetchRegion( const Imath::Box2i &dataWindow ) const;
+		void prefetch( const std::vector<std::string> &channelNames, const Imath::Box2i &region, int frames, float frameStep, size_t memoryLimit ) const;
+
+		int m_prefetchFrames;
+		size_t m_prefetchMemoryLimit;
+		float m_prefetchFrameStep;
+		float m_previousFrame;
 
 		std::unique_ptr<Gaffer::BackgroundTask> m_tilesTask;
 		std::atomic_bool m_renderRequestPending;
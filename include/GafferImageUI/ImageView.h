@@ -100,6 +100,11 @@ class GAFFERIMAGEUI_API ImageView : public GafferUI::View
 		const Gaffer::StringPlug *compareCatalogueOutputPlug() const;
 		Gaffer::BoolPlug *compareMatchDisplayWindowsPlug();
 		const Gaffer::BoolPlug *compareMatchDisplayWindowsPlug() const;
+		Gaffer::IntPlug *prefetchFramesPlug();
+		const Gaffer::IntPlug *prefetchFramesPlug() const;
+		/// In megabytes.
+		Gaffer::IntPlug *prefetchMemoryLimitPlug();
+		const Gaffer::IntPlug *prefetchMemoryLimitPlug() const;
 
 		/// The gadget responsible for displaying the image.
 		ImageGadget *imageGadget();
@@ -121,6 +126,7 @@ class GAFFERIMAGEUI_API ImageView : public GafferUI::View
 
 		void contextChanged();
 		void plugSet( Gaffer::Plug *plug );
+		void plugDirtied( Gaffer::Plug *plug );
 		bool keyPress( const GafferUI::KeyEvent &event );
 		void preRender();
 
@@ -78,6 +78,10 @@ class GAFFERSCENE_API AttributeProcessor : public FilteredSceneProcessor
 		/// Must be implemented by derived classes to return the processed attributes.
 		virtual IECore::ConstCompoundObjectPtr computeProcessedAttributes( const ScenePath &path, const Gaffer::Context *context, const IECore::CompoundObject *inputAttributes ) const = 0;
 
+		/// Implemented to return `filteredAffectedPaths()`, since unfiltered
+		/// locations are passed through unchanged.
+		bool affectedPaths( const Gaffer::Plug *input, const Gaffer::ValuePlug *output, IECore::PathMatcher &paths ) const override;
+
 	private :
 
 		void init();
@@ -111,6 +111,9 @@ class GAFFERSCENE_API Cryptomatte : public GafferImage::FlatImageProcessor
 		Gaffer::PathMatcherDataPlug *manifestPathDataPlug();
 		const Gaffer::PathMatcherDataPlug *manifestPathDataPlug() const;
 
+		Gaffer::AtomicCompoundDataPlug *manifestIndexPlug();
+		const Gaffer::AtomicCompoundDataPlug *manifestIndexPlug() const;
+
 		GafferScene::ScenePlug *manifestScenePlug();
 		const GafferScene::ScenePlug *manifestScenePlug() const;
 
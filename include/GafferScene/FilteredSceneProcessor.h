@@ -83,6 +83,14 @@ class GAFFERSCENE_API FilteredSceneProcessor : public SceneProcessor
 		/// make your own SceneScope and then query the filter directly multiple times.
 		IECore::PathMatcher::Result filterValue( const Gaffer::Context *context ) const;
 
+		/// Utility for implementing `affectedPaths()` in derived classes which pass
+		/// through unfiltered locations unchanged. Returns the locations matched by the
+		/// filter, combined with the journaled locations for `input` if it is a child of
+		/// `inPlug()`. Returns false if the filter can't be evaluated without computation,
+		/// which is currently the case for anything other than a PathFilter with constant
+		/// `paths`.
+		bool filteredAffectedPaths( const Gaffer::Plug *input, IECore::PathMatcher &paths ) const;
+
 		static size_t g_firstPlugIndex;
 
 };
@@ -41,6 +41,8 @@
 #include "GafferScene/BranchCreator.h"
 #include "GafferScene/Capsule.h"
 
+#include <atomic>
+
 namespace GafferSceneModule
 {
 
@@ -174,6 +176,24 @@ class GAFFERSCENE_API Instancer : public BranchCreator
 		Gaffer::AtomicCompoundDataPlug *variationsPlug();
 		const Gaffer::AtomicCompoundDataPlug *variationsPlug() const;
 
+		/// Statistics describing the prototypes used when rendering encapsulated
+		/// instancers from this node, accumulated since construction or the last
+		/// call to `resetPrototypeStatistics()`.
+		struct PrototypeStatistics
+		{
+			/// The number of instances rendered.
+			size_t instances = 0;
+			/// The number of unique combinations of prototype and context
+			/// used by the instances.
+			size_t variants = 0;
+			/// The number of prototypes rendered, after merging variants which
+			/// would render identically.
+			size_t prototypes = 0;
+		};
+
+		PrototypeStatistics prototypeStatistics() const;
+		void resetPrototypeStatistics();
+
 		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
 
 	protected :
@@ -269,6 +289,10 @@ class GAFFERSCENE_API Instancer : public BranchCreator
 				ConstEngineDataPtr m_engine;
 		};
 
+		mutable std::atomic_size_t m_statisticsInstances;
+		mutable std::atomic_size_t m_statisticsVariants;
+		mutable std::atomic_size_t m_statisticsPrototypes;
+
 		static size_t g_firstPlugIndex;
 
 		// For bindings
@@ -73,6 +73,9 @@ class GAFFERSCENE_API MeshTessellate : public ObjectProcessor
 		Gaffer::StringPlug *triangleSubdivisionRulePlug();
 		const Gaffer::StringPlug *triangleSubdivisionRulePlug() const;
 
+		Gaffer::BoolPlug *adaptivePlug();
+		const Gaffer::BoolPlug *adaptivePlug() const;
+
 		GAFFER_NODE_DECLARE_TYPE( GafferScene::MeshTessellate, MeshTessellateTypeId, ObjectProcessor );
 
 	protected :
@@ -83,6 +83,10 @@ class GAFFERSCENE_API ObjectProcessor : public FilteredSceneProcessor
 		/// TBB tasks. The default implementation returns `ValuePlug::CachePolicy::Default`.
 		virtual Gaffer::ValuePlug::CachePolicy processedObjectComputeCachePolicy() const;
 
+		/// Implemented to return `filteredAffectedPaths()`, since unfiltered
+		/// locations are passed through unchanged.
+		bool affectedPaths( const Gaffer::Plug *input, const Gaffer::ValuePlug *output, IECore::PathMatcher &paths ) const override;
+
 		void hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
 		void compute( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const override;
 		Gaffer::ValuePlug::CachePolicy computeCachePolicy( const Gaffer::ValuePlug *output ) const override;
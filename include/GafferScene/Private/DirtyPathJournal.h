@@ -0,0 +1,103 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2026, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "GafferScene/Export.h"
+
+#include "Gaffer/ValuePlug.h"
+
+#include "IECore/PathMatcher.h"
+
+namespace GafferScene
+{
+
+namespace Private
+{
+
+/// Records the scene locations affected by each edit to a node graph, so
+/// that clients such as the RenderController can update only those locations
+/// rather than traversing the whole scene. Entries are published by SceneNodes
+/// via `SceneNode::affectedPaths()`, and are keyed by the dirty count of
+/// each plug, so an entry is only ever valid for the dirtying it describes.
+/// When no valid entry exists, clients must assume that any location may have
+/// been affected.
+namespace DirtyPathJournal
+{
+
+/// Journals are only maintained while at least one Observer exists,
+/// so there is no overhead when nobody is interested in them.
+struct GAFFERSCENE_API Observer
+{
+	Observer();
+	~Observer();
+	Observer( const Observer & ) = delete;
+	Observer &operator=( const Observer & ) = delete;
+};
+
+/// Returns true if any Observers exist.
+GAFFERSCENE_API bool observed();
+
+/// Records the locations affected by the current dirtying of `plug`.
+/// Multiple records for the same dirtying are merged. Passing `nullptr`
+/// records that any location may have been affected.
+GAFFERSCENE_API void record( const Gaffer::ValuePlug *plug, const IECore::PathMatcher *paths );
+
+/// Records that the input to `plug` has changed, so that the dirtying
+/// which follows may affect any location.
+GAFFERSCENE_API void inputChanged( const Gaffer::ValuePlug *plug );
+
+/// Returns true and fills `paths` if the locations affected by the most
+/// recent dirtying of `plug` are known. Plugs which receive their value
+/// from an input connection defer to the entry for the input.
+GAFFERSCENE_API bool affectedPaths( const Gaffer::ValuePlug *plug, IECore::PathMatcher &paths );
+
+/// Removes the entry for `plug`. Must be called before a plug with an
+/// entry is destroyed, so that a new plug at the same address can't
+/// pick up a stale entry.
+GAFFERSCENE_API void erase( const Gaffer::ValuePlug *plug );
+
+/// Removes all entries. Entries are only needed while dirtiness is being
+/// propagated, so Observers should call this once they have consumed them.
+/// Clearing while another Observer is still consuming entries is safe, but
+/// means that it must assume that any location may have been affected.
+GAFFERSCENE_API void clear();
+
+} // namespace DirtyPathJournal
+
+} // namespace Private
+
+} // namespace GafferScene
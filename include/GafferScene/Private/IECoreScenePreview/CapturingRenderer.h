@@ -158,6 +158,10 @@ class GAFFERSCENE_API CapturingRenderer : public Renderer
 
 		std::vector<std::string> capturedObjectNames() const;
 		const CapturedObject *capturedObject( const std::string &name ) const;
+		/// Returns the names passed to `instances()`. Instance arrays are
+		/// also captured as individual objects, so they may be introspected
+		/// using `capturedObject()`.
+		std::vector<std::string> capturedInstanceArrayNames() const;
 
 		/// Renderer interface
 		/// ==================
@@ -172,6 +176,7 @@ class GAFFERSCENE_API CapturingRenderer : public Renderer
 		ObjectInterfacePtr lightFilter( const std::string &name, const IECore::Object *object, const AttributesInterface *attributes ) override;
 		ObjectInterfacePtr object( const std::string &name, const IECore::Object *object, const AttributesInterface *attributes ) override;
 		ObjectInterfacePtr object( const std::string &name, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times, const AttributesInterface *attributes ) override;
+		ObjectInterfacePtr instances( const std::string &name, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times, const IECore::CompoundObject *attributes, const InstanceArray &instances ) override;
 		void render() override;
 		void pause() override;
 
@@ -185,6 +190,8 @@ class GAFFERSCENE_API CapturingRenderer : public Renderer
 		std::atomic_bool m_rendering;
 		using ObjectMap = tbb::concurrent_hash_map<std::string, CapturedObject *>;
 		ObjectMap m_capturedObjects;
+		using InstanceArrayMap = tbb::concurrent_hash_map<std::string, size_t>;
+		InstanceArrayMap m_capturedInstanceArrays;
 
 		static Renderer::TypeDescription<CapturingRenderer> g_typeDescription;
 
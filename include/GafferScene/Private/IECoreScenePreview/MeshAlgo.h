@@ -39,6 +39,8 @@
 #include "IECoreScene/MeshPrimitive.h"
 #include "IECore/Canceller.h"
 
+#include <functional>
+
 namespace IECoreScenePreview
 {
 
@@ -51,9 +53,34 @@ GAFFERSCENE_API IECoreScene::MeshPrimitivePtr tessellateMesh(
 	IECore::InternedString interpolateBoundary = "",
 	IECore::InternedString faceVaryingLinearInterpolation = "",
 	IECore::InternedString triangleSubdivisionRule = "",
+	/// When true, `divisions` is treated as a maximum, and the
+	/// tessellation rate varies according to the curvature of the mesh.
+	bool adaptive = false,
 	const IECore::Canceller *canceller = nullptr
 );
 
+// Topology cache
+// ==============
+//
+// Many mesh operations derive data from the topology alone, and this is unchanged
+// between frames of a deforming mesh. These functions allow such data to be cached
+// and shared between all nodes and all frames that use the same topology.
+
+// Returns a hash of the topology of the mesh : the vertex count, `verticesPerFace()`
+// and `vertexIds()`. Primitive variables and subdivision properties are not included.
+GAFFERSCENE_API IECore::MurmurHash topologyHash( const IECoreScene::MeshPrimitive &mesh );
+
+using TopologyDataFunction = std::function<IECore::ConstDataPtr ( const IECoreScene::MeshPrimitive &mesh, const IECore::Canceller *canceller )>;
+
+// Returns the result of `function( mesh )`, reusing a previous result if one has
+// been cached for the same topology and `key`. The `key` must identify the function,
+// and any inputs it uses other than the topology. The function must not depend on
+// any other properties of the mesh.
+GAFFERSCENE_API IECore::ConstDataPtr cachedTopologyData(
+	const IECoreScene::MeshPrimitive &mesh, const IECore::MurmurHash &key,
+	const TopologyDataFunction &function, const IECore::Canceller *canceller = nullptr
+);
+
 } // namespace MeshAlgo
 
 } // namespace IECoreScenePreview
@@ -42,6 +42,7 @@
 #include "IECoreScene/Output.h"
 
 #include "IECore/CompoundObject.h"
+#include "IECore/Data.h"
 #include "IECore/MessageHandler.h"
 
 #include "boost/unordered_set.hpp"
@@ -300,6 +301,42 @@ class GAFFERSCENE_API Renderer : public IECore::RefCounted
 		/// As above, but specifying a deforming object.
 		virtual ObjectInterfacePtr object( const std::string &name, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times, const AttributesInterface *attributes ) = 0;
 
+		/// Describes an array of instances of a single prototype, as passed to `instances()`.
+		struct InstanceArray
+		{
+			/// The id for each instance. Instances are named `<prefix>/<id>`,
+			/// where `prefix` is `instanceNamePrefix`, or the name passed to
+			/// `instances()` if that is empty.
+			std::vector<int64_t> ids;
+			/// Optional prefix for instance names. This allows several arrays
+			/// to name their instances consistently while the arrays themselves
+			/// have unique names.
+			std::string instanceNamePrefix;
+			/// The transform for each instance. Contains one vector of
+			/// transforms per time in `transformTimes`, or a single vector
+			/// if `transformTimes` is empty.
+			std::vector<std::vector<Imath::M44f>> transforms;
+			std::vector<float> transformTimes;
+			/// Optional per-instance attributes, which are added to the
+			/// prototype attributes. Each value must be vector typed data, and
+			/// instance `i` takes element `attributeIndices[i]`.
+			using Attributes = std::vector<std::pair<IECore::InternedString, IECore::ConstDataPtr>>;
+			Attributes attributes;
+			std::vector<size_t> attributeIndices;
+			/// Optional ids to be passed to `ObjectInterface::assignInstanceID()`,
+			/// one per instance.
+			std::vector<uint32_t> instanceIDs;
+		};
+
+		/// Adds an array of instances of a single prototype, which is specified as for
+		/// the deforming variant of `object()`. The returned handle refers to the
+		/// whole array : `attributes()`, `link()` and `assignID()` apply to every instance,
+		/// and `transform()` is ignored, because the instance transforms are provided by
+		/// `instances`. A default implementation that adds each instance via `object()` is
+		/// provided, calling it concurrently from several threads. Renderers that support instancing natively should provide a more
+		/// efficient override.
+		virtual ObjectInterfacePtr instances( const std::string &name, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times, const IECore::CompoundObject *attributes, const InstanceArray &instances );
+
 		/// Performs the render - should be called after the
 		/// entire scene has been specified using the methods
 		/// above. Batch and SceneDescripton renders will have
@@ -0,0 +1,171 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2026, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Gaffer/ThreadState.h"
+
+#include "IECore/PathMatcher.h"
+
+#include "tbb/parallel_for.h"
+
+#include <vector>
+
+namespace GafferScene
+{
+
+namespace Private
+{
+
+namespace PathMatcherAlgo
+{
+
+enum class FilterAction
+{
+	// Keep the location and everything below it.
+	Keep,
+	// Remove the location and everything below it.
+	Remove,
+	// Keep the location itself if it is a member, and
+	// make a separate decision for each of its children.
+	Recurse
+};
+
+/// Returns a copy of `paths`, filtered by `functor`. This is called in parallel
+/// for locations in the hierarchy of `paths`, visiting parents before their
+/// children, and must have the signature
+/// `FilterAction functor( const std::vector<IECore::InternedString> &path )`.
+/// Calls are made with the ThreadState of the caller.
+template<typename Functor>
+IECore::PathMatcher parallelFilter( const IECore::PathMatcher &paths, Functor &&functor );
+
+namespace Detail
+{
+
+template<typename Functor>
+IECore::PathMatcher parallelFilterWalk(
+	const IECore::PathMatcher &paths, std::vector<IECore::InternedString> &path, Functor &functor,
+	const Gaffer::ThreadState &threadState, tbb::task_group_context &taskGroupContext
+)
+{
+	switch( functor( path ) )
+	{
+		case FilterAction::Keep :
+			return paths;
+		case FilterAction::Remove :
+			return IECore::PathMatcher();
+		case FilterAction::Recurse :
+			break;
+	}
+
+	// Find our children. Paths are relative to `path`, so we just need
+	// the locations at depth 1.
+
+	bool exactMatch = false;
+	std::vector<IECore::InternedString> childNames;
+	for( IECore::PathMatcher::RawIterator it = paths.begin(), eIt = paths.end(); it != eIt; ++it )
+	{
+		if( it->empty() )
+		{
+			exactMatch = it.exactMatch();
+		}
+		else
+		{
+			childNames.push_back( it->back() );
+			it.prune();
+		}
+	}
+
+	// Filter the children in parallel, and combine their results in order.
+
+	std::vector<IECore::PathMatcher> childResults( childNames.size() );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, childNames.size() ),
+		[&] ( const tbb::blocked_range<size_t> &range ) {
+			Gaffer::ThreadState::Scope threadStateScope( threadState );
+			std::vector<IECore::InternedString> childPath = path;
+			childPath.push_back( IECore::InternedString() );
+			std::vector<IECore::InternedString> childName( 1 );
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				childName.back() = childNames[i];
+				childPath.back() = childNames[i];
+				childResults[i] = parallelFilterWalk( paths.subTree( childName ), childPath, functor, threadState, taskGroupContext );
+			}
+		},
+		taskGroupContext
+	);
+
+	IECore::PathMatcher result;
+	if( exactMatch )
+	{
+		result.addPath( std::vector<IECore::InternedString>() );
+	}
+
+	std::vector<IECore::InternedString> prefix( 1 );
+	for( size_t i = 0; i < childNames.size(); ++i )
+	{
+		if( !childResults[i].isEmpty() )
+		{
+			prefix.back() = childNames[i];
+			result.addPaths( childResults[i], prefix );
+		}
+	}
+
+	return result;
+}
+
+} // namespace Detail
+
+template<typename Functor>
+IECore::PathMatcher parallelFilter( const IECore::PathMatcher &paths, Functor &&functor )
+{
+	if( paths.isEmpty() )
+	{
+		return paths;
+	}
+
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated ); // Prevents outer tasks silently cancelling our tasks
+	const Gaffer::ThreadState &threadState = Gaffer::ThreadState::current();
+	std::vector<IECore::InternedString> path;
+	return Detail::parallelFilterWalk( paths, path, functor, threadState, taskGroupContext );
+}
+
+} // namespace PathMatcherAlgo
+
+} // namespace Private
+
+} // namespace GafferScene
@@ -43,12 +43,14 @@
 
 #include "GafferScene/RenderManifest.h"
 
+#include "GafferScene/Private/DirtyPathJournal.h"
 #include "GafferScene/Private/IECoreScenePreview/Renderer.h"
 #include "GafferScene/Private/RendererAlgo.h"
 
 #include "Gaffer/BackgroundTask.h"
 
 #include <atomic>
+#include <chrono>
 #include <functional>
 
 namespace GafferScene
@@ -97,6 +99,41 @@ class GAFFERSCENE_API RenderController : public Gaffer::Signals::Trackable
 
 		void updateMatchingPaths( const IECore::PathMatcher &pathsToUpdate, const ProgressCallback &callback = ProgressCallback() );
 
+		/// Called between the passes made by `updateProgressively()`, with the
+		/// renderer paused. Must call `prepareNextPass()`, which computes the
+		/// scene data for the next pass. The renderer may be started while this
+		/// happens, but must be paused again before returning.
+		using PassCallback = std::function<void ( const std::function<void ()> &prepareNextPass )>;
+
+		/// Performs an update in a series of passes, ordered so that the
+		/// renderer can produce a meaningful image as soon as possible :
+		/// cameras and lights first, followed by the objects visible to the
+		/// render camera in order of decreasing size on screen, and finally
+		/// everything else. If `passCallback` is provided, the caller may use it
+		/// to run the renderer between passes, so that it need only be paused
+		/// while objects are output. As for `update()`, the renderer is left
+		/// paused on return, and it is the caller's responsibility to call
+		/// `render()`. Only the initial translation of the scene is prioritised
+		/// in this way; subsequent edits are typically small enough to be
+		/// applied in a single pass.
+		void updateProgressively( const ProgressCallback &callback = ProgressCallback(), const PassCallback &passCallback = PassCallback() );
+
+		// Progress
+		// ========
+
+		struct Progress
+		{
+			/// The number of objects output to the renderer by the
+			/// current or most recent update.
+			size_t objectsTranslated = 0;
+			/// The rate at which those objects were output.
+			double objectsPerSecond = 0.0;
+		};
+
+		/// May be called from any thread, including from within a
+		/// `ProgressCallback`.
+		Progress progress() const;
+
 		// Manifest
 		// ========
 		//
@@ -133,14 +170,20 @@ class GAFFERSCENE_API RenderController : public Gaffer::Signals::Trackable
 		void contextChanged( const IECore::InternedString &name );
 		void requestUpdate();
 		void dirtyGlobals( unsigned components );
-		void dirtySceneGraphs( unsigned components );
+		// If `plug` is specified, the dirty path journal is used to limit
+		// the dirtying to the affected locations where possible.
+		void dirtySceneGraphs( unsigned components, const Gaffer::ValuePlug *plug = nullptr );
 
 		void updateInternal( const ProgressCallback &callback = ProgressCallback(), const IECore::PathMatcher *pathsToUpdate = nullptr, bool signalCompletion = true );
 		void updateDefaultCamera();
 		void cancelBackgroundTask();
+		// Used by `updateProgressively()`.
+		std::vector<IECore::PathMatcher> screenCoverageTiers() const;
+		void prefetch( const IECore::PathMatcher *paths ) const;
 
 		class SceneGraph;
 		class SceneGraphUpdateTask;
+		struct ProgressScope;
 
 		ConstScenePlugPtr m_scene;
 		Gaffer::ConstContextPtr m_context;
@@ -161,6 +204,7 @@ class GAFFERSCENE_API RenderController : public Gaffer::Signals::Trackable
 		std::vector<std::unique_ptr<SceneGraph> > m_sceneGraphs;
 		unsigned m_dirtyGlobalComponents;
 		unsigned m_changedGlobalComponents;
+		bool m_cameraOptionsChanged;
 		Private::RendererAlgo::RenderOptions m_renderOptions;
 		Private::RendererAlgo::RenderSets m_renderSets;
 		std::unique_ptr<Private::RendererAlgo::LightLinks> m_lightLinks;
@@ -169,9 +213,15 @@ class GAFFERSCENE_API RenderController : public Gaffer::Signals::Trackable
 
 		std::shared_ptr<Gaffer::BackgroundTask> m_backgroundTask;
 
+		std::atomic<size_t> m_objectsTranslated;
+		std::atomic<std::chrono::steady_clock::rep> m_updateStartTime;
+		std::atomic<std::chrono::steady_clock::rep> m_updateEndTime;
+
 		bool m_manifestRequired;
 		std::shared_ptr<RenderManifest> m_renderManifest;
 
+		Private::DirtyPathJournal::Observer m_dirtyPathJournalObserver;
+
 };
 
 } // namespace GafferScene
@@ -121,6 +121,13 @@ GAFFERSCENE_API IECore::MurmurHash matchingPathsHash( const IECore::PathMatcher
 ///     /// to the children.
 ///     bool operator()( const ScenePlug *scene, const ScenePlug::ScenePath &path );
 ///
+///     /// Optional. If provided, this is called once all the children
+///     /// of a location have been processed, with the functors used for
+///     /// them, in the same order as the child names. This allows results
+///     /// to be gathered from the children deterministically, for instance
+///     /// to build a PathMatcher from per-child subtrees.
+///     void gatherChildren( std::vector<ThreadableFunctor> &children );
+///
 /// };
 /// ```
 template <class ThreadableFunctor>
@@ -319,6 +326,8 @@ GAFFERSCENE_API IECore::PathMatcher linkedLights( const ScenePlug *scene, const
 /// ===============
 
 // Hashes all properties of a location and all its children. Does not include set membership.
+// Results are cached, so repeated queries for a hierarchy that hasn't been dirtied
+// are cheap, and do not need to traverse it.
 GAFFERSCENE_API IECore::MurmurHash hierarchyHash( const ScenePlug *scene, const ScenePlug::ScenePath &root );
 
 /// Miscellaneous
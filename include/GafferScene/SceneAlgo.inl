@@ -42,7 +42,11 @@
 #include "tbb/parallel_reduce.h"
 #include "tbb/task_arena.h"
 
+#include <algorithm>
+#include <chrono>
+#include <type_traits>
 #include <variant>
+#include <vector>
 
 namespace GafferScene
 {
@@ -50,10 +54,34 @@ namespace GafferScene
 namespace Detail
 {
 
+// Detects functors providing the optional `gatherChildren()` method
+// documented for `parallelProcessLocations()`.
+template<typename ThreadableFunctor, typename = void>
+struct HasGatherChildren : std::false_type {};
+
+template<typename ThreadableFunctor>
+struct HasGatherChildren<
+	ThreadableFunctor,
+	std::void_t<decltype( std::declval<ThreadableFunctor &>().gatherChildren( std::declval<std::vector<ThreadableFunctor> &>() ) )>
+> : std::true_type {};
+
+// Wide hierarchies containing many cheap locations would spend more time
+// scheduling tasks than processing locations if each child were given its
+// own task. So for wide locations we process a few children serially to
+// measure their cost, and then use that to choose a grain size giving
+// packets of roughly `g_targetPacketDuration`. Each packet shares a single
+// PathScope between all the locations it processes.
+inline constexpr size_t g_minChildrenForPacketSizing = 256;
+inline constexpr size_t g_maxChildrenForPacketSizing = 64;
+inline constexpr std::chrono::microseconds g_targetPacketDuration( 50 );
+
+// Processes `path` and its descendants. `pathScope` is reused for all
+// locations processed on this thread, and `path` is modified during the
+// walk, but is restored before returning.
 template<typename ThreadableFunctor>
-void parallelProcessLocationsWalk( const GafferScene::ScenePlug *scene, const Gaffer::ThreadState &threadState, const ScenePlug::ScenePath &path, ThreadableFunctor &f, tbb::task_group_context &taskGroupContext )
+void parallelProcessLocationsWalk( const GafferScene::ScenePlug *scene, const Gaffer::ThreadState &threadState, ScenePlug::PathScope &pathScope, ScenePlug::ScenePath &path, ThreadableFunctor &f, tbb::task_group_context &taskGroupContext )
 {
-	ScenePlug::PathScope pathScope( threadState, &path );
+	pathScope.setPath( &path );
 
 	if( !f( scene, path ) )
 	{
@@ -67,28 +95,91 @@ void parallelProcessLocationsWalk( const GafferScene::ScenePlug *scene, const Ga
 		return;
 	}
 
-	using ChildNameRange = tbb::blocked_range<std::vector<IECore::InternedString>::const_iterator>;
-	const ChildNameRange loopRange( childNames.begin(), childNames.end() );
+	// Functors which gather results from their children need the child
+	// functors to stay alive until all children have been processed. We
+	// reserve up front, so that `emplace_back()` never needs to relocate
+	// existing elements. That would invoke the functor's copy constructor,
+	// which has the special meaning of constructing a child.
 
-	auto loopBody = [&] ( const ChildNameRange &range ) {
-		ScenePlug::ScenePath childPath = path;
-		childPath.push_back( IECore::InternedString() ); // Space for the child name
-		for( auto &childName : range )
+	constexpr bool gather = HasGatherChildren<ThreadableFunctor>::value;
+	std::vector<ThreadableFunctor> gatheredChildren;
+	if constexpr( gather )
+	{
+		gatheredChildren.reserve( childNames.size() );
+		for( size_t i = 0; i < childNames.size(); ++i )
+		{
+			gatheredChildren.emplace_back( f );
+		}
+	}
+
+	auto processChild = [&] ( size_t childIndex, ScenePlug::PathScope &childPathScope, ScenePlug::ScenePath &childPath ) {
+		childPath.back() = childNames[childIndex];
+		if constexpr( gather )
+		{
+			parallelProcessLocationsWalk( scene, threadState, childPathScope, childPath, gatheredChildren[childIndex], taskGroupContext );
+		}
+		else
 		{
 			ThreadableFunctor childFunctor( f );
-			childPath.back() = childName;
-			parallelProcessLocationsWalk( scene, threadState, childPath, childFunctor, taskGroupContext );
+			parallelProcessLocationsWalk( scene, threadState, childPathScope, childPath, childFunctor, taskGroupContext );
 		}
 	};
 
-	if( childNames.size() > 1 )
+	// Process children serially in this thread while that is appropriate,
+	// either because there is only one, or because we are measuring their
+	// cost.
+
+	size_t numSerialChildren = 0;
+	std::chrono::steady_clock::duration serialDuration( 0 );
+	path.push_back( IECore::InternedString() ); // Space for the child name
+	if( childNames.size() == 1 || childNames.size() >= g_minChildrenForPacketSizing )
 	{
-		tbb::parallel_for( loopRange, loopBody, taskGroupContext );
+		const auto start = std::chrono::steady_clock::now();
+		do
+		{
+			processChild( numSerialChildren++, pathScope, path );
+			serialDuration = std::chrono::steady_clock::now() - start;
+		} while(
+			numSerialChildren < childNames.size() &&
+			numSerialChildren < g_maxChildrenForPacketSizing &&
+			serialDuration < g_targetPacketDuration
+		);
 	}
-	else
+
+	// Process the remaining children in parallel.
+
+	if( numSerialChildren < childNames.size() )
 	{
-		// Serial execution
-		loopBody( loopRange );
+		size_t grainSize = 1;
+		if( numSerialChildren )
+		{
+			const size_t packetSize = serialDuration.count() ? numSerialChildren * g_targetPacketDuration / serialDuration : childNames.size();
+			// Ensure there are still enough packets to load balance well.
+			const size_t maxGrainSize = std::max<size_t>( 1, ( childNames.size() - numSerialChildren ) / ( tbb::this_task_arena::max_concurrency() * 4 ) );
+			grainSize = std::clamp<size_t>( packetSize, 1, maxGrainSize );
+		}
+
+		tbb::parallel_for(
+			tbb::blocked_range<size_t>( numSerialChildren, childNames.size(), grainSize ),
+			[&] ( const tbb::blocked_range<size_t> &range ) {
+				ScenePlug::PathScope childPathScope( threadState );
+				ScenePlug::ScenePath childPath = path;
+				for( size_t i = range.begin(); i != range.end(); ++i )
+				{
+					processChild( i, childPathScope, childPath );
+				}
+			},
+			taskGroupContext
+		);
+	}
+
+	path.pop_back();
+
+	if constexpr( gather )
+	{
+		// Restore the scope, since `path` was modified while processing children.
+		pathScope.setPath( &path );
+		f.gatherChildren( gatheredChildren );
 	}
 }
 
@@ -156,7 +247,10 @@ template <class ThreadableFunctor>
 void parallelProcessLocations( const GafferScene::ScenePlug *scene, ThreadableFunctor &f, const ScenePlug::ScenePath &root )
 {
 	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated ); // Prevents outer tasks silently cancelling our tasks
-	Detail::parallelProcessLocationsWalk( scene, Gaffer::ThreadState::current(), root, f, taskGroupContext );
+	const Gaffer::ThreadState &threadState = Gaffer::ThreadState::current();
+	ScenePlug::PathScope pathScope( threadState );
+	ScenePlug::ScenePath path = root;
+	Detail::parallelProcessLocationsWalk( scene, threadState, pathScope, path, f, taskGroupContext );
 }
 
 template <class ThreadableFunctor>
@@ -60,6 +60,10 @@ class GAFFERSCENE_API SceneElementProcessor : public FilteredSceneProcessor
 
 	protected :
 
+		/// Implemented to return `filteredAffectedPaths()`, since unfiltered
+		/// locations are passed through unchanged.
+		bool affectedPaths( const Gaffer::Plug *input, const Gaffer::ValuePlug *output, IECore::PathMatcher &paths ) const override;
+
 		/// Implemented to call hashProcessedBound() where appropriate.
 		void hashBound( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const override;
 		/// Implemented to call hashProcessedTransform() where appropriate.
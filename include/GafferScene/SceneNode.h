@@ -42,6 +42,8 @@
 
 #include "Gaffer/ComputeNode.h"
 
+#include "IECore/PathMatcher.h"
+
 namespace GafferScene
 {
 
@@ -99,6 +101,10 @@ class GAFFERSCENE_API SceneNode : public Gaffer::ComputeNode
 		virtual void hashGlobals( const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const;
 		virtual void hashSetNames( const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const;
 		virtual void hashSet( const IECore::InternedString &setName, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const;
+		/// Unlike the methods above, this has a default implementation which derives the
+		/// result from `parent->setPlug()`. Derived classes need only override it if they
+		/// can compute a branch more cheaply than they can compute the whole set.
+		virtual void hashSetSubtree( const IECore::InternedString &setName, const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const;
 
 		/// Implemented to call the compute*() methods below whenever output is part of a ScenePlug and the node is enabled.
 		void compute( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const override;
@@ -117,6 +123,9 @@ class GAFFERSCENE_API SceneNode : public Gaffer::ComputeNode
 		/// account. The rationale for this is that it frees other nodes from checking that a set exists before accessing
 		/// it, and that makes computation quicker, as we don't need to access setNamesPlug() at all in many common cases.
 		virtual IECore::ConstPathMatcherDataPtr computeSet( const IECore::InternedString &setName, const Gaffer::Context *context, const ScenePlug *parent ) const;
+		/// Must return only the members of `setName` at or below `path`. The default
+		/// implementation extracts them from the result of `parent->setPlug()`.
+		virtual IECore::ConstPathMatcherDataPtr computeSetSubtree( const IECore::InternedString &setName, const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent ) const;
 
 		/// \deprecated Use `ScenePlug::childBounds()` instead.
 		Imath::Box3f unionOfTransformedChildBounds( const ScenePath &path, const ScenePlug *out, const IECore::InternedStringVectorData *childNames = nullptr ) const;
@@ -131,9 +140,18 @@ class GAFFERSCENE_API SceneNode : public Gaffer::ComputeNode
 		/// base classes, so there should be little need to call this.
 		bool enabled( const Gaffer::Context *context ) const;
 
+		/// May be implemented to report the locations at which `output` may change
+		/// when `input` is dirtied, so that clients such as the RenderController can
+		/// update only those locations following an edit. `output` is always a child
+		/// of `outPlug()`, and for `outPlug()->boundPlug()` the ancestors of the
+		/// returned locations are implicitly included. Returns false if the locations
+		/// are unknown, which is the default.
+		virtual bool affectedPaths( const Gaffer::Plug *input, const Gaffer::ValuePlug *output, IECore::PathMatcher &paths ) const;
+
 	private :
 
 		void plugInputChanged( Gaffer::Plug *plug );
+		void plugDirtied( const Gaffer::Plug *plug );
 
 		void hashExists( const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const;
 		bool computeExists( const Gaffer::Context *context, const ScenePlug *parent ) const;
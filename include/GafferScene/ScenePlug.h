@@ -127,6 +127,14 @@ class GAFFERSCENE_API ScenePlug : public Gaffer::ValuePlug
 		/// which set to compute.
 		Gaffer::PathMatcherDataPlug *setPlug();
 		const Gaffer::PathMatcherDataPlug *setPlug() const;
+		/// Provides the subset of `setPlug()` containing only the
+		/// current location and its descendants. This is sensitive to
+		/// both the scene:setName and scene:path context variables, and
+		/// allows clients that are only interested in part of the scene
+		/// to avoid computing the full set. Paths are absolute, so the
+		/// result is directly comparable with that of `setPlug()`.
+		Gaffer::PathMatcherDataPlug *branchSetPlug();
+		const Gaffer::PathMatcherDataPlug *branchSetPlug() const;
 
 		/// Context management
 		/// ==================
@@ -245,6 +253,8 @@ class GAFFERSCENE_API ScenePlug : public Gaffer::ValuePlug
 		/// could otherwise lead to poor cache performance.
 		IECore::ConstInternedStringVectorDataPtr setNames() const;
 		IECore::ConstPathMatcherDataPtr set( const IECore::InternedString &setName ) const;
+		/// Returns the members of the named set which are at or below `scenePath`.
+		IECore::ConstPathMatcherDataPtr branchSet( const IECore::InternedString &setName, const ScenePath &scenePath ) const;
 
 		IECore::MurmurHash boundHash( const ScenePath &scenePath ) const;
 		IECore::MurmurHash transformHash( const ScenePath &scenePath ) const;
@@ -259,6 +269,7 @@ class GAFFERSCENE_API ScenePlug : public Gaffer::ValuePlug
 		/// See comments for `setNames()` method.
 		IECore::MurmurHash setNamesHash() const;
 		IECore::MurmurHash setHash( const IECore::InternedString &setName ) const;
+		IECore::MurmurHash branchSetHash( const IECore::InternedString &setName, const ScenePath &scenePath ) const;
 
 		/// Utility methods
 		/// ===============
@@ -81,6 +81,20 @@ class GAFFERSCENE_API SceneReader : public SceneNode
 
 		static size_t supportedExtensions( std::vector<std::string> &extensions );
 
+		/// Specifies a directory in which to store an index for each file
+		/// loaded. An index records the child names, static bounds, set names
+		/// and set memberships for a file, and is built on a background thread
+		/// the first time the file is loaded. Until it is complete, queries
+		/// are read from the file directly. After that, including in other
+		/// sessions, hierarchy and set queries are read from the index without
+		/// traversing the file itself. Indices are keyed by file name,
+		/// modification time, `tags` and `refreshCount`, so incrementing
+		/// `refreshCount` causes a fresh index to be built. An empty string
+		/// disables indexing, and is the default unless the
+		/// `GAFFERSCENE_SCENEREADER_INDEX_DIRECTORY` environment variable is set.
+		static void setIndexDirectory( const std::string &directory );
+		static std::string getIndexDirectory();
+
 	protected :
 
 		Gaffer::ValuePlug::CachePolicy computeCachePolicy( const Gaffer::ValuePlug *output ) const override;
@@ -133,6 +147,12 @@ class GAFFERSCENE_API SceneReader : public SceneNode
 		// `tagsPlug()` respectively.
 		IECoreScene::ConstSceneInterfacePtr scene( const ScenePath &path, const Gaffer::Context *context, int *refreshCount = nullptr, std::string *tags = nullptr ) const;
 
+		// Index of the hierarchy and sets, used when `getIndexDirectory()`
+		// is not empty. Returns nullptr if there is no index for the current file.
+		class Index;
+		IE_CORE_DECLAREPTR( Index );
+		ConstIndexPtr index( const Gaffer::Context *context ) const;
+
 		static const double g_frameRate;
 		static size_t g_firstPlugIndex;
 
@@ -1952,6 +1952,45 @@ class ImageWriterTest( GafferImageTest.ImageTestCase ) :
 			['character.Z,', '32-bit'], ['character.ZBack,', '32-bit'], ['character.custom,', '32-bit'], ['character.mask,', '32-bit']
 		] )
 
+	def testCompressedRoundTrip( self ) :
+
+		# A data window that isn't aligned to tile boundaries, so that
+		# batches of output tiles are clipped on the right and bottom.
+		checkerboard = GafferImage.Checkerboard()
+		checkerboard["format"].setValue( GafferImage.Format( 1000, 600 ) )
+		checkerboard["size"].setValue( imath.V2f( 13 ) )
+
+		crop = GafferImage.Crop()
+		crop["in"].setInput( checkerboard["out"] )
+		crop["area"].setValue( imath.Box2i( imath.V2i( 11, 7 ), imath.V2i( 931, 589 ) ) )
+		crop["affectDisplayWindow"].setValue( False )
+
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( crop["out"] )
+		writer["fileName"].setValue( self.temporaryDirectory() / "test.exr" )
+		writer["openexr"]["dataType"].setValue( "float" )
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setInput( writer["fileName"] )
+
+		for mode in ( GafferImage.ImageWriter.Mode.Scanline, GafferImage.ImageWriter.Mode.Tile ) :
+			for compression in ( "none", "zip", "piz" ) :
+				with self.subTest( mode = mode, compression = compression ) :
+
+					writer["openexr"]["mode"].setValue( mode )
+					writer["openexr"]["compression"].setValue( compression )
+
+					with IECore.CapturingMessageHandler() as mh :
+						writer["task"].execute()
+
+					debugMessages = [ m.message for m in mh.messages if m.level == IECore.Msg.Level.Debug ]
+					self.assertEqual( len( debugMessages ), 1 )
+					self.assertRegex( debugMessages[0], r'Wrote ".*test.exr" in .* : compute .*, encode and write .*, waiting for writes .*' )
+
+					reader["refreshCount"].setValue( reader["refreshCount"].getValue() + 1 )
+					self.assertEqual( reader["out"].metadata()["compression"], IECore.StringData( compression ) )
+					self.assertImagesEqual( reader["out"], crop["out"], ignoreMetadata = True )
+
 	def testOmitFileValidMetadata( self ) :
 
 		testSequence = IECore.FileSequence( str( self.temporaryDirectory() / "incompleteSequence.####.exr" ) )
@@ -744,6 +744,200 @@ class OpenImageIOReaderTest( GafferImageTest.ImageTestCase ) :
 		finally :
 			GafferImage.OpenImageIOReader.setOpenFilesLimit( l )
 
+	def testReadAhead( self ) :
+
+		source = GafferImage.ImageReader()
+		source["fileName"].setValue( self.dotGridWarpedFileName )
+
+		resize = GafferImage.Resize()
+		resize["in"].setInput( source["out"] )
+		resize["format"]["displayWindow"].setValue( imath.Box2i( imath.V2i( 0 ), imath.V2i( 1500, 1000 ) ) )
+
+		for tiled in ( False, True ) :
+
+			fileName = self.temporaryDirectory() / "readAhead{}.exr".format( "Tiled" if tiled else "Scanline" )
+
+			writer = GafferImage.ImageWriter()
+			writer["in"].setInput( resize["out"] )
+			writer["fileName"].setValue( fileName )
+			writer["openexr"]["mode"].setValue( GafferImage.ImageWriter.Mode.Tile if tiled else GafferImage.ImageWriter.Mode.Scanline )
+			writer["task"].execute()
+
+			reference = GafferImage.OpenImageIOReader()
+			reference["fileName"].setValue( fileName )
+			GafferImageTest.processTiles( reference["out"] )
+
+			threads = GafferImage.OpenImageIOReader.getReadAheadThreads()
+			try :
+				GafferImage.OpenImageIOReader.setReadAheadThreads( 2 )
+				self.assertEqual( GafferImage.OpenImageIOReader.getReadAheadThreads(), 2 )
+
+				reader = GafferImage.OpenImageIOReader()
+				reader["fileName"].setValue( fileName )
+				reader["refreshCount"].setValue( 1 )
+				self.assertImagesEqual( reader["out"], reference["out"], ignoreMetadata = True )
+			finally :
+				GafferImage.OpenImageIOReader.setReadAheadThreads( threads )
+
+	def testReadAheadIsUsed( self ) :
+
+		constant = GafferImage.Constant()
+		constant["format"].setValue( GafferImage.Format( 256, 2048 ) )
+
+		fileName = self.temporaryDirectory() / "readAhead.exr"
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( constant["out"] )
+		writer["fileName"].setValue( fileName )
+		writer["openexr"]["mode"].setValue( GafferImage.ImageWriter.Mode.Scanline )
+		writer["task"].execute()
+
+		threads = GafferImage.OpenImageIOReader.getReadAheadThreads()
+		self.addCleanup( GafferImage.OpenImageIOReader.setReadAheadThreads, threads )
+		GafferImage.OpenImageIOReader.setReadAheadThreads( 1 )
+		GafferImageTest.resetReadAheadClaimCount()
+
+		reader = GafferImage.OpenImageIOReader()
+		reader["fileName"].setValue( fileName )
+		reader["refreshCount"].setValue( 2 )
+
+		# Request the scanline batches in order, waiting for each read-ahead
+		# to complete before asking for the next batch. Every batch other than
+		# the first should then come from a read-ahead.
+
+		tileSize = GafferImage.ImagePlug.tileSize()
+		tileOrigins = list( reversed( range( 0, 2048, tileSize ) ) )
+		for y in tileOrigins :
+			reader["out"].channelData( "R", imath.V2i( 0, y ) )
+			GafferImageTest.waitForReadAheads()
+
+		self.assertEqual( GafferImageTest.readAheadClaimCount(), len( tileOrigins ) - 1 )
+
+		# With reading ahead disabled, nothing is claimed.
+
+		GafferImage.OpenImageIOReader.setReadAheadThreads( 0 )
+		GafferImageTest.resetReadAheadClaimCount()
+		reader["refreshCount"].setValue( 3 )
+		for y in tileOrigins :
+			reader["out"].channelData( "R", imath.V2i( 0, y ) )
+
+		self.assertEqual( GafferImageTest.readAheadClaimCount(), 0 )
+
+	def testReadLayersSeparately( self ) :
+
+		for fileName in [
+			"layers.10x10.exr", "multipart.exr", "imitateProductionLayers1.exr",
+			"channelTestMultiViewPartPerView.exr", "representativeDeepImage.exr"
+		] :
+
+			with self.subTest( fileName = fileName ) :
+
+				reference = GafferImage.OpenImageIOReader()
+				reference["fileName"].setValue( self.imagesPath() / fileName )
+
+				reader = GafferImage.OpenImageIOReader()
+				reader["fileName"].setValue( self.imagesPath() / fileName )
+				reader["readLayersSeparately"].setValue( True )
+
+				with IECore.CapturingMessageHandler() :
+					self.assertImagesEqual( reader["out"], reference["out"] )
+
+	def testReadLayersSeparatelyWarning( self ) :
+
+		reader = GafferImage.OpenImageIOReader()
+		reader["fileName"].setValue( self.imagesPath() / "layers.10x10.exr" )
+		reader["refreshCount"].setValue( 1 )
+		reader["readLayersSeparately"].setValue( True )
+
+		channelNames = reader["out"].channelNames()
+		self.assertGreater( len( GafferImage.ImageAlgo.layerNames( channelNames ) ), 1 )
+
+		with IECore.CapturingMessageHandler() as mh :
+			reader["out"].channelData( channelNames[0], imath.V2i( 0 ) )
+			reader["out"].channelData( channelNames[-1], imath.V2i( 0 ) )
+
+		# We only warn once per file.
+		self.assertEqual( len( mh.messages ), 1 )
+		self.assertEqual( mh.messages[0].level, IECore.Msg.Level.Warning )
+		self.assertIn( "requires decoding all", mh.messages[0].message )
+
+	def testReadLayersSeparatelyNoWarningForTiledOrUncompressed( self ) :
+
+		spec = OpenImageIO.ImageSpec( 64, 64, 6, "half" )
+		spec.channelnames = ( "R", "G", "B", "diffuse.R", "diffuse.G", "diffuse.B" )
+
+		for name, tiled, compression in [
+			( "tiled.exr", True, "zip" ),
+			( "uncompressed.exr", False, "none" ),
+		] :
+
+			spec.tile_width = spec.tile_height = 32 if tiled else 0
+			spec.attribute( "compression", compression )
+
+			fileName = self.temporaryDirectory() / name
+			buffer = OpenImageIO.ImageBuf( spec )
+			self.assertTrue( buffer.write( str( fileName ) ) )
+
+			reader = GafferImage.OpenImageIOReader()
+			reader["fileName"].setValue( fileName )
+			reader["readLayersSeparately"].setValue( True )
+
+			with IECore.CapturingMessageHandler() as mh :
+				reader["out"].channelData( "diffuse.R", imath.V2i( 0 ) )
+
+			self.assertEqual( mh.messages, [] )
+
+	def testProxyLevel( self ) :
+
+		fileName = self.temporaryDirectory() / "mipmapped.exr"
+		buffer = OpenImageIO.ImageBuf( OpenImageIO.ImageSpec( 256, 128, 3, "float" ) )
+		OpenImageIO.ImageBufAlgo.fill( buffer, ( 0.25, 0.5, 1.0 ) )
+		self.assertTrue( OpenImageIO.ImageBufAlgo.make_texture( OpenImageIO.MakeTxTexture, buffer, str( fileName ) ) )
+
+		reader = GafferImage.OpenImageIOReader()
+		reader["fileName"].setValue( fileName )
+
+		def assertLevel( level, size ) :
+
+			with Gaffer.Context() as context :
+				context["image:proxyLevel"] = level
+				self.assertEqual( reader["out"].format().getDisplayWindow(), imath.Box2i( imath.V2i( 0 ), size ) )
+				self.assertEqual( reader["out"].dataWindow(), imath.Box2i( imath.V2i( 0 ), size ) )
+				self.assertEqual( reader["out"].channelNames(), IECore.StringVectorData( [ "R", "G", "B" ] ) )
+				for channelName, value in zip( "RGB", ( 0.25, 0.5, 1.0 ) ) :
+					channelData = reader["out"].channelData( channelName, imath.V2i( 0 ) )
+					self.assertEqual( channelData[0], value )
+				return reader["out"].channelDataHash( "R", imath.V2i( 0 ) )
+
+		h0 = assertLevel( 0, imath.V2i( 256, 128 ) )
+		h1 = assertLevel( 1, imath.V2i( 128, 64 ) )
+		h2 = assertLevel( 2, imath.V2i( 64, 32 ) )
+		self.assertEqual( len( { h0, h1, h2 } ), 3 )
+
+		# Requests for levels beyond the last are clamped.
+
+		h8 = assertLevel( 8, imath.V2i( 1 ) )
+		self.assertEqual( assertLevel( 100, imath.V2i( 1 ) ), h8 )
+
+		# Metadata always comes from the full resolution image.
+
+		metadata = reader["out"].metadata()
+		with Gaffer.Context() as context :
+			context["image:proxyLevel"] = 2
+			self.assertEqual( reader["out"].metadata(), metadata )
+
+		# Files without MIP levels are unaffected, and share the
+		# same cache entries for all levels.
+
+		reader["fileName"].setValue( self.imagesPath() / "checker.exr" )
+		format = reader["out"].format()
+		dataWindow = reader["out"].dataWindow()
+		channelDataHash = reader["out"].channelDataHash( "R", imath.V2i( 0 ) )
+		with Gaffer.Context() as context :
+			context["image:proxyLevel"] = 2
+			self.assertEqual( reader["out"].format(), format )
+			self.assertEqual( reader["out"].dataWindow(), dataWindow )
+			self.assertEqual( reader["out"].channelDataHash( "R", imath.V2i( 0 ) ), channelDataHash )
+
 	def testSubimageMetadataNotLoaded( self ) :
 
 		reader = GafferImage.ImageReader()
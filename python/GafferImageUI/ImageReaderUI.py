@@ -257,6 +257,22 @@ Gaffer.Metadata.registerNode(
 
 		],
 
+		"readLayersSeparately" : [
+
+			"description",
+			"""
+			Reads the channels of each layer independently of the other layers in
+			the same part of the file. This reduces the time and memory needed when
+			only a few layers of a file with many channels are used, but increases
+			it when all layers are used, because each read must still decompress
+			the data for all channels of the part.
+
+			> Tip : Files written with each layer in a separate part can be read
+			> selectively without this cost, regardless of this setting.
+			""",
+
+		],
+
 		"availableFrames" : [
 
 			"description",
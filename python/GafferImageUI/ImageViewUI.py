@@ -169,6 +169,39 @@ Gaffer.Metadata.registerNode(
 
 		],
 
+		"prefetch" : [
+
+			"description",
+			"""
+			Controls the computation of subsequent frames in the background,
+			ready for playback. These settings are normally driven by the
+			Viewer section of the preferences.
+			""",
+
+			"plugValueWidget:type", "",
+
+		],
+
+		"prefetch.frames" : [
+
+			"description",
+			"""
+			The number of frames to compute in advance, in the direction of
+			the most recent frame change. Prefetching is cancelled whenever the
+			frame or image changes.
+			""",
+
+		],
+
+		"prefetch.memoryLimit" : [
+
+			"description",
+			"""
+			The maximum amount of image data to prefetch, in megabytes.
+			""",
+
+		],
+
 
 	}
 
@@ -38,6 +38,8 @@ import time
 import unittest
 import imath
 
+import OpenImageIO
+
 import IECore
 
 import Gaffer
@@ -145,5 +147,114 @@ class ImageGadgetTest( GafferUITest.TestCase ) :
 			self.waitForIdle()
 			self.assertEqual( GafferImageUI.ImageGadget.tileUpdateCount(), 4 )
 
+	def testPrefetch( self ) :
+
+		script = Gaffer.ScriptNode()
+		script["image"] = GafferImage.Checkerboard()
+		script["image"]["format"].setValue( GafferImage.Format( 100, 100 ) )
+
+		gadget = GafferImageUI.ImageGadget()
+		gadget.setImage( script["image"]["out"] )
+		gadget.setContext( script.context() )
+
+		self.assertEqual( gadget.getPrefetchFrames(), 0 )
+		gadget.setPrefetchFrames( 3 )
+		self.assertEqual( gadget.getPrefetchFrames(), 3 )
+
+		with GafferUI.Window() as window :
+			GafferUI.GadgetWidget( gadget )
+
+		def numFramesComputed( expected ) :
+
+			with Gaffer.ContextMonitor( script["image"] ) as monitor :
+				window.setVisible( True )
+				timeout = time.time() + 10
+				while time.time() < timeout :
+					self.waitForIdle()
+					if gadget.state() == gadget.State.Complete and monitor.combinedStatistics().numUniqueValues( "frame" ) >= expected :
+						break
+				# Give any unwanted prefetching a chance to show itself.
+				time.sleep( 0.5 )
+				self.waitForIdle()
+
+			return monitor.combinedStatistics().numUniqueValues( "frame" )
+
+		self.assertEqual( numFramesComputed( 4 ), 4 )
+
+		script.context().setFrame( 10 )
+		gadget.setPrefetchMemoryLimit( 0 )
+		self.assertEqual( gadget.getPrefetchMemoryLimit(), 0 )
+		self.assertEqual( numFramesComputed( 1 ), 1 )
+
+		script.context().setFrame( 20 )
+		gadget.setPrefetchMemoryLimit( 1024 * 1024 )
+		gadget.setPrefetchFrames( 0 )
+		self.assertEqual( numFramesComputed( 1 ), 1 )
+
+	def testMaxProxyLevel( self ) :
+
+		fileName = self.temporaryDirectory() / "mipmapped.exr"
+		buffer = OpenImageIO.ImageBuf( OpenImageIO.ImageSpec( 2048, 1024, 3, "float" ) )
+		OpenImageIO.ImageBufAlgo.fill( buffer, ( 0.25, 0.5, 1.0 ) )
+		self.assertTrue( OpenImageIO.ImageBufAlgo.make_texture( OpenImageIO.MakeTxTexture, buffer, str( fileName ) ) )
+
+		script = Gaffer.ScriptNode()
+		script["reader"] = GafferImage.ImageReader()
+		script["reader"]["fileName"].setValue( fileName )
+
+		gadget = GafferImageUI.ImageGadget()
+		gadget.setImage( script["reader"]["out"] )
+		gadget.setContext( script.context() )
+
+		# Negative levels are clamped.
+
+		self.assertEqual( gadget.getMaxProxyLevel(), 0 )
+		gadget.setMaxProxyLevel( -1 )
+		self.assertEqual( gadget.getMaxProxyLevel(), 0 )
+		gadget.setMaxProxyLevel( 4 )
+		self.assertEqual( gadget.getMaxProxyLevel(), 4 )
+
+		with GafferUI.Window() as window :
+			gadgetWidget = GafferUI.GadgetWidget( gadget )
+
+		window._qtWidget().resize( 256, 128 )
+		window.setVisible( True )
+		gadgetWidget.getViewportGadget().frame( gadget.bound() )
+
+		def waitForComplete() :
+
+			timeout = time.time() + 10
+			while gadget.state() != gadget.State.Complete and time.time() < timeout :
+				self.waitForIdle()
+			self.assertEqual( gadget.state(), gadget.State.Complete )
+
+		# Zoomed out, the gadget should request a proxy level, which changes
+		# the hashes of the tiles it draws.
+
+		with Gaffer.ContextMonitor( script["reader"] ) as monitor :
+			waitForComplete()
+
+		self.assertIn( "image:proxyLevel", monitor.combinedStatistics().variableNames() )
+
+		with Gaffer.Context( script.context() ) as context :
+			fullHash = script["reader"]["out"].channelDataHash( "R", imath.V2i( 0 ) )
+			context["image:proxyLevel"] = 1
+			self.assertNotEqual( script["reader"]["out"].channelDataHash( "R", imath.V2i( 0 ) ), fullHash )
+
+		# Setting the same level again shouldn't cause any updates.
+
+		GafferImageUI.ImageGadget.resetTileUpdateCount()
+		gadget.setMaxProxyLevel( 4 )
+		self.waitForIdle( 100 )
+		waitForComplete()
+		self.assertEqual( GafferImageUI.ImageGadget.tileUpdateCount(), 0 )
+
+		# But turning proxies off must fetch the full resolution tiles.
+
+		gadget.setMaxProxyLevel( 0 )
+		self.waitForIdle( 100 )
+		waitForComplete()
+		self.assertGreater( GafferImageUI.ImageGadget.tileUpdateCount(), 0 )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -92,5 +92,28 @@ class ImageViewTest( GafferUITest.TestCase ) :
 		self.assertIsInstance( view.imageGadget(), GafferImageUI.ImageGadget )
 		self.assertTrue( view.viewportGadget().isAncestorOf( view.imageGadget() ) )
 
+	def testPrefetchPlugs( self ) :
+
+		script = Gaffer.ScriptNode()
+		view = GafferImageUI.ImageView( script )
+
+		view["prefetch"]["frames"].setValue( 2 )
+		self.assertEqual( view.imageGadget().getPrefetchFrames(), 2 )
+
+		# Values must also be transferred when the plugs are driven by
+		# an input, as they are by the Viewer preferences.
+
+		preferences = Gaffer.Node()
+		preferences["frames"] = Gaffer.IntPlug( defaultValue = 3, flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		preferences["memoryLimit"] = Gaffer.IntPlug( defaultValue = 10, flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+
+		view["prefetch"]["frames"].setInput( preferences["frames"] )
+		view["prefetch"]["memoryLimit"].setInput( preferences["memoryLimit"] )
+		self.assertEqual( view.imageGadget().getPrefetchFrames(), 3 )
+		self.assertEqual( view.imageGadget().getPrefetchMemoryLimit(), 10 * 1024 * 1024 )
+
+		preferences["frames"].setValue( 5 )
+		self.assertEqual( view.imageGadget().getPrefetchFrames(), 5 )
+
 if __name__ == "__main__":
 	unittest.main()
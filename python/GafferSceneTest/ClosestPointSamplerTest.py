@@ -34,6 +34,7 @@
 #
 ##########################################################################
 
+import unittest
 import imath
 
 import IECore
@@ -263,6 +264,89 @@ class ClosestPointSamplerTest( GafferSceneTest.SceneTestCase ) :
 		with GafferTest.TestRunner.PerformanceScope() :
 			sampler["out"].object( "/plane" )
 
+	def testManyDestinations( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 10 ) )
+
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( plane["out"] )
+		duplicate["filter"].setInput( planeFilter["out"] )
+		duplicate["copies"].setValue( 10 )
+		duplicate["transform"]["translate"]["z"].setValue( 0.1 )
+
+		samplerFilter = GafferScene.PathFilter()
+		samplerFilter["paths"].setValue( IECore.StringVectorData( [ "/plane*" ] ) )
+
+		sampler = GafferScene.ClosestPointSampler()
+		sampler["in"].setInput( duplicate["out"] )
+		sampler["source"].setInput( sphere["out"] )
+		sampler["filter"].setInput( samplerFilter["out"] )
+		sampler["sourceLocation"].setValue( "/sphere" )
+		sampler["primitiveVariables"].setValue( "P" )
+		sampler["prefix"].setValue( "sampled:" )
+
+		def assertSampledRadius( radius ) :
+
+			for name in sampler["out"].childNames( "/" ) :
+				path = "/" + str( name )
+				translate = sampler["out"].fullTransform( path ).translation()
+				for p in sampler["out"].object( path )["sampled:P"].data :
+					self.assertAlmostEqual( ( p + translate ).length(), radius, delta = 0.05 )
+
+		# All destinations share the same source, and must
+		# sample it correctly despite their differing transforms.
+
+		assertSampledRadius( 1 )
+
+		# Edits to the source must be reflected in the results.
+
+		sphere["radius"].setValue( 2 )
+		assertSampledRadius( 2 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.CategorisedTestMethod( { "expensivePerformance" } )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testManyDestinationsPerformance( self ) :
+
+		sphere = GafferScene.Sphere()
+		sphere["divisions"].setValue( imath.V2i( 1000 ) )
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 100 ) )
+
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( plane["out"] )
+		duplicate["filter"].setInput( planeFilter["out"] )
+		duplicate["copies"].setValue( 99 )
+		duplicate["transform"]["translate"]["z"].setValue( 0.01 )
+
+		samplerFilter = GafferScene.PathFilter()
+		samplerFilter["paths"].setValue( IECore.StringVectorData( [ "/plane*" ] ) )
+
+		sampler = GafferScene.ClosestPointSampler()
+		sampler["in"].setInput( duplicate["out"] )
+		sampler["source"].setInput( sphere["out"] )
+		sampler["filter"].setInput( samplerFilter["out"] )
+		sampler["sourceLocation"].setValue( "/sphere" )
+		sampler["primitiveVariables"].setValue( "uv" )
+
+		# Precache the inputs so we don't include them
+		# in the performance measurement.
+		GafferSceneTest.traverseScene( sampler["in"] )
+		sampler["source"].object( "/sphere" )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferSceneTest.traverseScene( sampler["out"] )
+
 	def testPruneSourceLocation( self ) :
 
 		plane = GafferScene.Plane()
@@ -420,6 +420,86 @@ class CryptomatteTest( GafferSceneTest.SceneTestCase ) :
 		self.assertIn( "A2", c["out"]["channelNames"].getValue() )
 		self.assertNotIn( "A", c["out"]["channelNames"].getValue() )
 
+	def testAncestorMatchWithSimilarSiblingNames( self ) :
+
+		manifest = {
+			"/a" : "00000001",
+			"/a/b" : "00000002",
+			"/a/b/c" : "00000003",
+			"/a/b-c" : "00000004",
+			"/a/b.c" : "00000005",
+			"/a/bc" : "00000006",
+			"/a/b/c/d" : "00000007",
+		}
+		manifestFile = self.temporaryDirectory() / "manifest.json"
+		with open( manifestFile, "w" ) as f :
+			json.dump( manifest, f )
+
+		c = GafferScene.Cryptomatte()
+		c["manifestSource"].setValue( GafferScene.Cryptomatte.ManifestSource.Sidecar )
+		c["sidecarFile"].setValue( manifestFile )
+
+		def matteValues( names ) :
+			c["matteNames"].setValue( IECore.StringVectorData( names ) )
+			return set( c["__matteValues"].getValue() )
+
+		self.assertEqual( matteValues( [ "/a/b" ] ), matteValues( [ "/a/b", "/a/b/c", "/a/b/c/d" ] ) )
+		self.assertTrue( matteValues( [ "/a/b" ] ).issubset( matteValues( [ "a/b/" ] ) ) )
+		self.assertTrue( matteValues( [ "/a/b" ] ).issubset( matteValues( [ "/a/b/..." ] ) ) )
+		self.assertEqual( len( matteValues( [ "/a/b/..." ] ) ), 4 )
+		self.assertEqual( matteValues( [ "/" ] ), matteValues( list( manifest.keys() ) + [ "/" ] ) )
+		self.assertEqual( matteValues( [ "/a" ] ), matteValues( list( manifest.keys() ) ) )
+		self.assertEqual( len( matteValues( [ "/a/b-c" ] ) ), 1 )
+		self.assertEqual( len( matteValues( [ "/a/b/c/d" ] ) ), 1 )
+		self.assertEqual( len( matteValues( [ "/a/b/c/d/e" ] ) ), 1 )
+
+	def testManyMatteNames( self ) :
+
+		r = GafferImage.ImageReader()
+		r["fileName"].setValue( self.testImage )
+
+		c = GafferScene.Cryptomatte()
+		c["in"].setInput( r["out"] )
+		c["layer"].setValue( "crypto_object" )
+
+		c["matteNames"].setValue( IECore.StringVectorData( [ "/GAFFERBOT" ] ) )
+		expectedValues = c["__matteValues"].getValue()
+		expectedAlpha = GafferImage.ImageAlgo.image( c["out"] )["A"]
+
+		paths = IECore.PathMatcher()
+		GafferScene.SceneAlgo.matchingPaths( IECore.PathMatcher( [ "/GAFFERBOT/..." ] ), c["manifestScene"], paths )
+		self.assertGreater( paths.size(), 1 )
+
+		c["matteNames"].setValue( IECore.StringVectorData(
+			paths.paths() + [ "/notInManifest/object{}".format( i ) for i in range( 0, 20000 ) ]
+		) )
+
+		values = c["__matteValues"].getValue()
+		self.assertGreaterEqual( len( values ), len( expectedValues ) + 20000 )
+		self.assertTrue( set( expectedValues ).issubset( set( values ) ) )
+		self.assertEqual( GafferImage.ImageAlgo.image( c["out"] )["A"], expectedAlpha )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testManyMatteNamesPerformance( self ) :
+
+		r = GafferImage.ImageReader()
+		r["fileName"].setValue( self.testImage )
+
+		c = GafferScene.Cryptomatte()
+		c["in"].setInput( r["out"] )
+		c["layer"].setValue( "crypto_object" )
+
+		c["matteNames"].setValue( IECore.StringVectorData(
+			[ "/GAFFERBOT" ] + [ "/notInManifest/object{}".format( i ) for i in range( 0, 100000 ) ]
+		) )
+
+		# Pre-compute input and manifest to remove their cost from the performance test
+		GafferImageTest.processTiles( c["in"] )
+		c["manifestScene"].childNames( "/" )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( c["out"] )
+
 	@GafferTest.TestRunner.PerformanceTestMethod()
 	def testPerformance( self ) :
 
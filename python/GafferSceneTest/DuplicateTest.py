@@ -83,6 +83,29 @@ class DuplicateTest( GafferSceneTest.SceneTestCase ) :
 			self.assertPathHashesEqual( d["out"], "/sphere", d["out"], path, checks = self.allPathChecks - { "transform" } )
 			self.assertEqual( d["out"].transform( path ), imath.M44f().translate( imath.V3f( 1, 0, 0 ) * i ) )
 
+	def testManyCopies( self ) :
+
+		sphere = GafferScene.Sphere()
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( sphere["out"] )
+		duplicate["target"].setValue( "/sphere" )
+		duplicate["name"].setValue( "copy7" )
+		duplicate["transform"]["translate"].setValue( imath.V3f( 1, 0, 0 ) )
+		duplicate["copies"].setValue( 5000 )
+
+		self.assertEqual(
+			duplicate["out"].childNames( "/" ),
+			IECore.InternedStringVectorData(
+				[ "sphere" ] + [ "copy%d" % x for x in range( 7, 5007 ) ]
+			)
+		)
+
+		for i in list( range( 0, 5000, 499 ) ) + [ 4999 ] :
+			self.assertEqual(
+				duplicate["out"].transform( "/copy%d" % ( i + 7 ) ),
+				imath.M44f().translate( imath.V3f( i + 1, 0, 0 ) )
+			)
+
 	def testHierarchy( self ) :
 
 		s = GafferScene.Sphere()
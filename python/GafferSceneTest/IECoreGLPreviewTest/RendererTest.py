@@ -225,6 +225,63 @@ class RendererTest( GafferTest.TestCase ) :
 
 		del o
 
+	def testQueryRayAndFrustum( self ) :
+
+		renderer = GafferScene.Private.IECoreScenePreview.Renderer.create(
+			"OpenGL",
+			GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Interactive
+		)
+
+		cube = IECoreScene.MeshPrimitive.createBox( imath.Box3f( imath.V3f( -0.5 ), imath.V3f( 0.5 ) ) )
+		attributes = renderer.attributes( IECore.CompoundObject() )
+
+		objects = []
+		for x in range( 0, 10 ) :
+			for y in range( 0, 10 ) :
+				o = renderer.object( "/cube{}_{}".format( x, y ), cube, attributes )
+				o.transform( imath.M44f().translate( imath.V3f( x * 2, y * 2, -x ) ) )
+				objects.append( o )
+
+		# Ray queries return hits ordered front to back.
+
+		hits = renderer.command( "gl:queryRay", { "origin" : imath.V3f( 4, 4, 10 ), "direction" : imath.V3f( 0, 0, -1 ) } )
+		self.assertEqual( hits["paths"], IECore.StringVectorData( [ "/cube2_2" ] ) )
+		self.assertAlmostEqual( hits["distances"][0], 11.5 )
+
+		hits = renderer.command( "gl:queryRay", { "origin" : imath.V3f( -10, 0, 0.25 ), "direction" : imath.V3f( 1, 0, -0.05 ) } )
+		self.assertEqual( hits["paths"][0], "/cube0_0" )
+		self.assertEqual( list( hits["distances"] ), sorted( hits["distances"] ) )
+
+		hits = renderer.command( "gl:queryRay", { "origin" : imath.V3f( 4, 4, 10 ), "direction" : imath.V3f( 0, 0, 1 ) } )
+		self.assertEqual( len( hits["paths"] ), 0 )
+
+		hits = renderer.command( "gl:queryRay", { "origin" : imath.V3f( 4, 4, 10 ), "direction" : imath.V3f( 0, 0, -1 ), "mask" : IECore.StringVectorData( [ "Camera" ] ) } )
+		self.assertEqual( len( hits["paths"] ), 0 )
+
+		# Frustum queries return everything inside an orthographic
+		# view of the lower left corner of the grid.
+
+		worldToClip = imath.M44f().translate( imath.V3f( -2.25, -2.25, 0 ) ) * imath.M44f().scale( imath.V3f( 1 / 3.0, 1 / 3.0, 1 / 20.0 ) )
+		paths = renderer.command( "gl:queryFrustum", { "worldToClip" : worldToClip } )
+		self.assertEqual(
+			set( paths.value.paths() ),
+			{ "/cube{}_{}".format( x, y ) for x in range( 0, 3 ) for y in range( 0, 3 ) }
+		)
+
+		# Results are updated after edits.
+
+		objects[0].transform( imath.M44f().translate( imath.V3f( 100 ) ) )
+		paths = renderer.command( "gl:queryFrustum", { "worldToClip" : worldToClip } )
+		self.assertNotIn( "/cube0_0", paths.value.paths() )
+		self.assertEqual( len( paths.value.paths() ), 8 )
+
+		del objects[1]
+		paths = renderer.command( "gl:queryFrustum", { "worldToClip" : worldToClip } )
+		self.assertNotIn( "/cube0_1", paths.value.paths() )
+		self.assertEqual( len( paths.value.paths() ), 7 )
+
+		del objects
+
 	def testTransforms( self ) :
 
 		renderer = GafferScene.Private.IECoreScenePreview.Renderer.create(
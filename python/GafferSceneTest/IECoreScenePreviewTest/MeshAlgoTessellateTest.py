@@ -602,6 +602,83 @@ class MeshAlgoTessellateTest( GafferTest.TestCase ) :
 			MeshAlgo.tessellateMesh( generalMesh, 1, triangleSubdivisionRule = "smooth" )
 		)
 
+	def eulerCharacteristic( self, mesh ) :
+
+		edges = set()
+		offset = 0
+		for n in mesh.verticesPerFace :
+			ids = mesh.vertexIds[offset:offset+n]
+			for i in range( n ) :
+				edges.add( tuple( sorted( ( ids[i], ids[(i+1)%n] ) ) ) )
+			offset += n
+
+		return len( mesh["P"].data ) - len( edges ) + mesh.numFaces()
+
+	def testAdaptive( self ) :
+
+		# A flat mesh has no curvature, so adaptive tessellation shouldn't add any divisions.
+
+		plane = IECoreScene.MeshPrimitive.createPlane(
+			imath.Box2f( imath.V2f( -1 ), imath.V2f( 1 ) ), divisions = imath.V2i( 4 )
+		)
+		plane.setInterpolation( "catmullClark" )
+		self.assertEqual(
+			MeshAlgo.tessellateMesh( plane, 5, adaptive = True ),
+			MeshAlgo.tessellateMesh( plane, 0 )
+		)
+
+		# A mesh with regions of varying curvature should get fewer faces than uniform
+		# tessellation, while remaining valid and watertight.
+
+		file = IECoreScene.SceneInterface.create(
+			str( self.usdFileDir / "generalTestMesh.usd" ), IECore.IndexedIO.OpenMode.Read
+		)
+		source = file.child( "object" ).readObject( 0.0 )
+
+		for divisions in [ 3, 4 ] :
+			with self.subTest( divisions = divisions ) :
+				uniform = MeshAlgo.tessellateMesh( source, divisions, calculateNormals = True )
+				adaptive = MeshAlgo.tessellateMesh( source, divisions, calculateNormals = True, adaptive = True )
+				self.assertTrue( adaptive.arePrimitiveVariablesValid() )
+				self.assertLess( adaptive.numFaces(), uniform.numFaces() )
+				self.assertGreater( adaptive.numFaces(), source.numFaces() )
+				self.assertEqual( self.eulerCharacteristic( adaptive ), self.eulerCharacteristic( uniform ) )
+				self.assertEqual( set( adaptive.keys() ), set( uniform.keys() ) )
+
+		# Adaptive tessellation has no effect when there are no divisions to vary.
+
+		self.assertEqual(
+			MeshAlgo.tessellateMesh( source, 0, adaptive = True ),
+			MeshAlgo.tessellateMesh( source, 0 )
+		)
+
+	def testTopologyReuse( self ) :
+
+		# Tessellating meshes which share topology but differ in position
+		# should give the same results as tessellating them independently.
+
+		source = self.createTestData( 2 )
+		tessellated = MeshAlgo.tessellateMesh( source, 3, calculateNormals = True )
+
+		moved = source.copy()
+		moved["P"] = IECoreScene.PrimitiveVariable(
+			IECoreScene.PrimitiveVariable.Interpolation.Vertex,
+			IECore.V3fVectorData( [ p * 2 for p in source["P"].data ] )
+		)
+		movedTessellated = MeshAlgo.tessellateMesh( moved, 3, calculateNormals = True )
+
+		self.assertEqual( movedTessellated.verticesPerFace, tessellated.verticesPerFace )
+		self.assertEqual( movedTessellated.vertexIds, tessellated.vertexIds )
+		for p, q in zip( movedTessellated["P"].data, tessellated["P"].data ) :
+			self.assertTrue( p.equalWithAbsError( q * 2, 0.00001 ) )
+
+		# And changing the topology-related options must not reuse stale topology.
+
+		self.assertNotEqual(
+			MeshAlgo.tessellateMesh( moved, 3, interpolateBoundary = IECoreScene.MeshPrimitive.interpolateBoundaryNone ),
+			MeshAlgo.tessellateMesh( moved, 3, interpolateBoundary = IECoreScene.MeshPrimitive.interpolateBoundaryEdgeAndCorner )
+		)
+
 
 	@GafferTest.TestRunner.PerformanceTestMethod()
 	def testSmallSourcePerf( self ):
@@ -629,6 +706,23 @@ class MeshAlgoTessellateTest( GafferTest.TestCase ) :
 		with GafferTest.TestRunner.PerformanceScope() :
 			MeshAlgo.tessellateMesh( sphere, 1 )
 
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testRepeatedTopologyPerf( self ):
+
+		sphere = IECoreScene.MeshPrimitive.createSphere(
+			1, divisions = imath.V2i( 300 )
+		)
+
+		sphere.setInterpolation( "catmullClark" )
+		del sphere["N"]
+
+		# Prime the topology cache, as would happen on the first frame
+		# of a deforming mesh.
+		MeshAlgo.tessellateMesh( sphere, 1 )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			MeshAlgo.tessellateMesh( sphere, 1 )
+
 	@GafferTest.TestRunner.PerformanceTestMethod()
 	def testBigSourcePerfRegular( self ):
 
@@ -673,6 +673,47 @@ class PrimitiveAlgoTest( GafferTest.TestCase ) :
 			{'labelSource', 'uv', 'indexedVertex', 'stringConstant', 'altUv', 'indexedUniform', 'N', 'unindexedUniform', 'unindexedFaceVarying'}
 		)
 
+	def testMergeManyTransformed( self ) :
+
+		mesh = IECoreScene.MeshPrimitive.createBox( imath.Box3f( imath.V3f( -1 ), imath.V3f( 1 ) ) )
+		vectorData = mesh["P"].data.copy()
+		vectorData.setInterpretation( IECore.GeometricData.Interpretation.Vector )
+		mesh["vector"] = IECoreScene.PrimitiveVariable( Interpolation.Vertex, vectorData )
+
+		projective = imath.M44f()
+		projective[0][3] = 0.1
+		projective[3][3] = 2.0
+
+		primitives = []
+		for i in range( 2000 ) :
+			m = imath.M44f()
+			m.translate( imath.V3f( i, 0, 0 ) )
+			m.rotate( imath.V3f( 0, math.radians( i ), 0 ) )
+			m.scale( imath.V3f( 1, 1 + i % 3, 1 ) )
+			if i % 100 == 7 :
+				m = m * projective
+			elif i % 100 == 13 :
+				m = imath.M44f()
+			primitives.append( ( mesh, m ) )
+
+		merged = PrimitiveAlgo.mergePrimitives( primitives )
+		self.assertTrue( merged.arePrimitiveVariablesValid() )
+
+		for name in [ "P", "vector", "N" ] :
+			offset = 0
+			data = merged[name].data
+			for sourceMesh, m in primitives :
+				transformed = sourceMesh.copy()
+				PrimitiveAlgo.transformPrimitive( transformed, m )
+				expected = transformed[name].data
+				for j in range( len( expected ) ) :
+					if isinstance( expected[j], imath.V3f ) :
+						self.assertTrue( data[offset+j].equalWithAbsError( expected[j], 0.0001 ), name )
+					else :
+						self.assertEqual( data[offset+j], expected[j] )
+				offset += len( expected )
+			self.assertEqual( offset, len( data ) )
+
 	@GafferTest.TestRunner.PerformanceTestMethod()
 	def testMergeManyPerf( self ) :
 
@@ -691,6 +732,21 @@ class PrimitiveAlgoTest( GafferTest.TestCase ) :
 		with GafferTest.TestRunner.PerformanceScope() :
 			PrimitiveAlgo.mergePrimitives( meshes )
 
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testMergeManySmallPerf( self ) :
+
+		mesh = IECoreScene.MeshPrimitive.createBox( imath.Box3f( imath.V3f( -1 ), imath.V3f( 1 ) ) )
+
+		meshes = []
+		for i in range( 100000 ):
+			m = imath.M44f()
+			m.setTranslation( imath.V3f( 0, i, 0 ) )
+
+			meshes.append( ( mesh, m ) )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			PrimitiveAlgo.mergePrimitives( meshes )
+
 	@GafferTest.TestRunner.PerformanceTestMethod()
 	def testMergeFewPerf( self ) :
 
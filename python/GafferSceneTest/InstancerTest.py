@@ -3125,6 +3125,134 @@ parent["radius"] = ( 2 + context.getFrame() ) * 15
 			else:
 				rootsByHash[ co.hash() ] = co.root()
 
+	def testEncapsulatedRenderUsesInstanceArrays( self ) :
+
+		points = IECoreScene.PointsPrimitive( IECore.V3fVectorData( [ imath.V3f( i, 0, 0 ) for i in range( 6 ) ] ) )
+		points["index"] = IECoreScene.PrimitiveVariable( IECoreScene.PrimitiveVariable.Interpolation.Vertex, IECore.IntVectorData( [ 0, 1 ] * 3 ) )
+		points["f"] = IECoreScene.PrimitiveVariable( IECoreScene.PrimitiveVariable.Interpolation.Vertex, IECore.FloatVectorData( [ i * 0.5 for i in range( 6 ) ] ) )
+
+		objectToScene = GafferScene.ObjectToScene()
+		objectToScene["object"].setValue( points )
+
+		sphere = GafferScene.Sphere()
+		cube = GafferScene.Cube()
+		parent = GafferScene.Parent()
+		parent["parent"].setValue( "/" )
+		parent["in"].setInput( sphere["out"] )
+		parent["children"][0].setInput( cube["out"] )
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( objectToScene["out"] )
+		instancer["prototypes"].setInput( parent["out"] )
+		instancer["parent"].setValue( "/object" )
+		instancer["prototypeIndex"].setValue( "index" )
+		instancer["encapsulate"].setValue( True )
+
+		for attributes in ( "", "f" ) :
+
+			instancer["attributes"].setValue( attributes )
+
+			renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer( GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Batch )
+			instancer["out"].object( "/object/instances" ).render( renderer )
+
+			self.assertEqual( sorted( renderer.capturedInstanceArrayNames() ), [ "cube", "sphere" ] )
+			self.assertEqual(
+				sorted( renderer.capturedObjectNames() ),
+				sorted( [ "{}/{}".format( [ "sphere", "cube" ][i % 2], i ) for i in range( 6 ) ] )
+			)
+
+			for i in range( 6 ) :
+				o = renderer.capturedObject( "{}/{}".format( [ "sphere", "cube" ][i % 2], i ) )
+				self.assertEqual( o.capturedTransforms(), [ imath.M44f().translate( imath.V3f( i, 0, 0 ) ) ] )
+				if attributes :
+					self.assertEqual( o.capturedAttributes().attributes()["f"], IECore.FloatData( i * 0.5 ) )
+				else :
+					self.assertNotIn( "f", o.capturedAttributes().attributes() )
+
+	def testPrototypeStatistics( self ) :
+
+		points = IECoreScene.PointsPrimitive( IECore.V3fVectorData( [ imath.V3f( i, 0, 0 ) for i in range( 100 ) ] ) )
+		points["variant"] = IECoreScene.PrimitiveVariable( IECoreScene.PrimitiveVariable.Interpolation.Vertex, IECore.IntVectorData( [ i % 10 for i in range( 100 ) ] ) )
+
+		objectToScene = GafferScene.ObjectToScene()
+		objectToScene["object"].setValue( points )
+
+		script = Gaffer.ScriptNode()
+		script["sphere"] = GafferScene.Sphere()
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( objectToScene["out"] )
+		instancer["prototypes"].setInput( script["sphere"]["out"] )
+		instancer["parent"].setValue( "/object" )
+		instancer["contextVariables"].addChild( GafferScene.Instancer.ContextVariablePlug( "context" ) )
+		instancer["contextVariables"][0]["name"].setValue( "variant" )
+		instancer["contextVariables"][0]["quantize"].setValue( 0 )
+		instancer["encapsulate"].setValue( True )
+
+		def assertStatistics( instances, variants, prototypes ) :
+
+			instancer.resetPrototypeStatistics()
+			renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer( GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Batch )
+			instancer["out"].object( "/object/instances" ).render( renderer )
+
+			statistics = instancer.prototypeStatistics()
+			self.assertEqual( statistics.instances, instances )
+			self.assertEqual( statistics.variants, variants )
+			self.assertEqual( statistics.prototypes, prototypes )
+
+		# The sphere doesn't depend on the variant, so all variants
+		# share a single prototype.
+
+		assertStatistics( 100, 10, 1 )
+
+		# Now only two distinct spheres are generated.
+
+		script["expression"] = Gaffer.Expression()
+		script["expression"].setExpression( 'parent["sphere"]["radius"] = 1 + context.get( "variant", 0 ) % 2' )
+
+		assertStatistics( 100, 10, 2 )
+
+		# And now every variant is unique.
+
+		script["expression"].setExpression( 'parent["sphere"]["radius"] = 1 + context.get( "variant", 0 )' )
+
+		assertStatistics( 100, 10, 10 )
+
+		instancer.resetPrototypeStatistics()
+		statistics = instancer.prototypeStatistics()
+		self.assertEqual( ( statistics.instances, statistics.variants, statistics.prototypes ), ( 0, 0, 0 ) )
+
+	def testInstanceArrayNamesWithContextVariation( self ) :
+
+		points = IECoreScene.PointsPrimitive( IECore.V3fVectorData( [ imath.V3f( i, 0, 0 ) for i in range( 6 ) ] ) )
+		points["variant"] = IECoreScene.PrimitiveVariable( IECoreScene.PrimitiveVariable.Interpolation.Vertex, IECore.IntVectorData( [ i % 3 for i in range( 6 ) ] ) )
+
+		objectToScene = GafferScene.ObjectToScene()
+		objectToScene["object"].setValue( points )
+
+		script = Gaffer.ScriptNode()
+		script["sphere"] = GafferScene.Sphere()
+		script["expression"] = Gaffer.Expression()
+		script["expression"].setExpression( 'parent["sphere"]["radius"] = 1 + context.get( "variant", 0 )' )
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( objectToScene["out"] )
+		instancer["prototypes"].setInput( script["sphere"]["out"] )
+		instancer["parent"].setValue( "/object" )
+		instancer["contextVariables"].addChild( GafferScene.Instancer.ContextVariablePlug( "context" ) )
+		instancer["contextVariables"][0]["name"].setValue( "variant" )
+		instancer["contextVariables"][0]["quantize"].setValue( 0 )
+		instancer["encapsulate"].setValue( True )
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer( GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Batch )
+		instancer["out"].object( "/object/instances" ).render( renderer )
+
+		# Each variant is output as a separate array, with a unique name.
+		self.assertEqual( sorted( renderer.capturedInstanceArrayNames() ), [ "sphere", "sphere:1", "sphere:2" ] )
+		# But the instances are still named after the prototype, to match
+		# the non-encapsulated hierarchy.
+		self.assertEqual( sorted( renderer.capturedObjectNames() ), sorted( [ "sphere/{}".format( i ) for i in range( 6 ) ] ) )
+
 	def testDestinationBug( self ) :
 
 		# The destination plug should be automatically handled by BranchCreator, but previously Instancer had
@@ -3483,6 +3611,65 @@ parent["radius"] = ( 2 + context.getFrame() ) * 15
 		with GafferTest.TestRunner.PerformanceScope() :
 			nodes["instancer"]["out"].object( "/plane/instances" ).render( renderer )
 
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.CategorisedTestMethod( { "expensivePerformance" } )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testManyInstancesPerf( self ) :
+
+		# 10M points, 5 prototypes and 3 per-instance attributes.
+
+		mesh = IECoreScene.MeshPrimitive.createPlane(
+			imath.Box2f( imath.V2f( -1 ), imath.V2f( 1 ) ),
+			imath.V2i( 3999, 2499 )
+		)
+		numPoints = mesh.variableSize( IECoreScene.PrimitiveVariable.Interpolation.Vertex )
+		self.assertEqual( numPoints, 10000000 )
+
+		mesh["index"] = IECoreScene.PrimitiveVariable(
+			IECoreScene.PrimitiveVariable.Interpolation.Vertex,
+			IECore.IntVectorData( [ 0, 1, 2, 3, 4 ] * ( numPoints // 5 ) ),
+		)
+		mesh["width"] = IECoreScene.PrimitiveVariable(
+			IECoreScene.PrimitiveVariable.Interpolation.Vertex,
+			IECore.FloatVectorData( [ 0.5, 1.0 ] * ( numPoints // 2 ) ),
+		)
+
+		meshSource = GafferScene.ObjectToScene()
+		meshSource["name"].setValue( "plane" )
+		meshSource["object"].setValue( mesh )
+		meshSource["out"].object( "/plane" )
+
+		sphere = GafferScene.Sphere()
+		prototypes = GafferScene.Group()
+		for i in range( 0, 5 ) :
+			prototypes["in"][i].setInput( sphere["out"] )
+
+		instancerFilter = GafferScene.PathFilter()
+		instancerFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( meshSource["out"] )
+		instancer["filter"].setInput( instancerFilter["out"] )
+		instancer["prototypes"].setInput( prototypes["out"] )
+		instancer["prototypeMode"].setValue( GafferScene.Instancer.PrototypeMode.IndexedRootsList )
+		instancer["prototypeIndex"].setValue( "index" )
+		instancer["prototypeRootsList"].setValue(
+			IECore.StringVectorData( [ "/group/sphere" ] + [ "/group/sphere{}".format( i ) for i in range( 1, 5 ) ] )
+		)
+		instancer["scale"].setValue( "width" )
+		instancer["attributes"].setValue( "P N width" )
+
+		Gaffer.ValuePlug.clearCache()
+		Gaffer.ValuePlug.clearHashCache( True )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			for i, prototypeName in enumerate( instancer["out"].childNames( "/plane/instances" ) ) :
+				instancer["out"].bound( "/plane/instances/{}".format( prototypeName ) )
+				for id in range( i, numPoints, 10000 * 5 ) :
+					path = "/plane/instances/{}/{}".format( prototypeName, id )
+					instancer["out"].transform( path )
+					instancer["out"].attributes( path )
+
 	def testUnrelatedPrototypeChange( self ):
 
 		points = GafferScene.Plane()
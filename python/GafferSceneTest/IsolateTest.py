@@ -35,6 +35,7 @@
 ##########################################################################
 
 import unittest
+import imath
 
 import IECore
 import IECoreScene
@@ -488,5 +489,49 @@ class IsolateTest( GafferSceneTest.SceneTestCase ) :
 		self.assertSceneValid( isolate["out"] )
 		self.assertTrue( isolate["out"].exists( "/sphere" ) )
 
+	def testSetWithManyMembers( self ) :
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 49 ) )
+
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		sphere = GafferScene.Sphere()
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( plane["out"] )
+		instancer["prototypes"].setInput( sphere["out"] )
+		instancer["filter"].setInput( planeFilter["out"] )
+
+		allInstancesFilter = GafferScene.PathFilter()
+		allInstancesFilter["paths"].setValue( IECore.StringVectorData( [ "/plane/instances/sphere/*" ] ) )
+
+		setNode = GafferScene.Set()
+		setNode["in"].setInput( instancer["out"] )
+		setNode["filter"].setInput( allInstancesFilter["out"] )
+		setNode["name"].setValue( "A" )
+
+		isolateFilter = GafferScene.PathFilter()
+		isolateFilter["paths"].setValue( IECore.StringVectorData( [ "/plane/instances/sphere/*1", "/plane/instances/sphere/2*" ] ) )
+
+		isolate = GafferScene.Isolate()
+		isolate["in"].setInput( setNode["out"] )
+		isolate["filter"].setInput( isolateFilter["out"] )
+
+		expected = IECore.PathMatcher( [
+			"/plane/instances/sphere/{}".format( i ) for i in range( 0, 2500 )
+			if str( i ).endswith( "1" ) or str( i ).startswith( "2" )
+		] )
+
+		self.assertEqual( isolate["out"].set( "A" ).value, expected )
+
+		# Only members below `from` are candidates for removal.
+
+		isolate["from"].setValue( "/plane/instances/sphere/0" )
+		expected = setNode["out"].set( "A" ).value.copy()
+		expected.removePath( "/plane/instances/sphere/0" )
+		self.assertEqual( isolate["out"].set( "A" ).value, expected )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -199,5 +199,37 @@ class MeshSegmentsTest( GafferSceneTest.SceneTestCase ) :
 		s["connectivity"].setValue( "const" )
 		self.assertEqual( s["out"].object( "/object" )["segment"].data, IECore.IntVectorData( [0, 0] ) )
 
+	def testDeformingMesh( self ) :
+
+		# Segments depend only on topology, so should be shared between
+		# frames of a deforming mesh, rather than being recomputed.
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 10 ) )
+
+		transform = GafferScene.FreezeTransform()
+		transform["in"].setInput( plane["out"] )
+
+		f = GafferScene.PathFilter()
+		f["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+		transform["filter"].setInput( f["out"] )
+
+		s = GafferScene.MeshSegments()
+		s["in"].setInput( transform["out"] )
+		s["filter"].setInput( f["out"] )
+
+		segments1 = s["out"].object( "/plane", _copy = False )["segment"].data
+		self.assertEqual( segments1, IECore.IntVectorData( [ 0 ] * 100 ) )
+
+		plane["transform"]["translate"]["x"].setValue( 2 )
+		self.assertNotEqual( transform["out"].object( "/plane" )["P"], plane["out"].object( "/plane" )["P"] )
+		segments2 = s["out"].object( "/plane", _copy = False )["segment"].data
+		self.assertTrue( segments2.isSame( segments1 ) )
+
+		# But changing topology must not reuse the cached segments.
+
+		plane["divisions"].setValue( imath.V2i( 5 ) )
+		self.assertEqual( s["out"].object( "/plane" )["segment"].data, IECore.IntVectorData( [ 0 ] * 25 ) )
+
 if __name__ == "__main__":
 	unittest.main()
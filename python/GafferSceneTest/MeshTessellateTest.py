@@ -69,6 +69,7 @@ class MeshTessellateTest( GafferSceneTest.SceneTestCase ) :
 				interpolateBoundary = node["interpolateBoundary"].getValue(),
 				faceVaryingLinearInterpolation = node["faceVaryingLinearInterpolation"].getValue(),
 				triangleSubdivisionRule = node["triangleSubdivisionRule"].getValue(),
+				adaptive = node["adaptive"].getValue(),
 			)
 
 		self.assertEqual( node["out"].object( path ), reference )
@@ -97,6 +98,11 @@ class MeshTessellateTest( GafferSceneTest.SceneTestCase ) :
 		tessellate["calculateNormals"].setValue( True )
 		self.assertNodeCorrect( tessellate, "object" )
 
+		tessellate["adaptive"].setValue( True )
+		self.assertNodeCorrect( tessellate, "object" )
+		tessellate["adaptive"].setValue( False )
+		self.assertNodeCorrect( tessellate, "object" )
+
 
 		# For the parameters shared with MeshType, we should get the same result if we use a MeshType to set
 		# the parameter, vs setting it on the MeshTessellate node
@@ -291,6 +291,77 @@ class ParentTest( GafferSceneTest.SceneTestCase ) :
 		self.assertEqual( p["out"]["setNames"].getValue(), IECore.InternedStringVectorData( [ "__lights", "defaultLights" ] ) )
 		self.assertEqual( set(  p["out"].set( "__lights" ).value.paths() ), set( [ "/light", "/light1" ] ) )
 
+	def testSetsWithManyParents( self ) :
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 19 ) )
+
+		sphere = GafferScene.Sphere()
+
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( plane["out"] )
+		instancer["prototypes"].setInput( sphere["out"] )
+		instancer["filter"].setInput( planeFilter["out"] )
+
+		cube = GafferScene.Cube()
+		cube["sets"].setValue( "A" )
+
+		instanceFilter = GafferScene.PathFilter()
+		instanceFilter["paths"].setValue( IECore.StringVectorData( [ "/plane/instances/sphere/*" ] ) )
+
+		parent = GafferScene.Parent()
+		parent["in"].setInput( instancer["out"] )
+		parent["children"][0].setInput( cube["out"] )
+		parent["filter"].setInput( instanceFilter["out"] )
+
+		self.assertEqual(
+			parent["out"].set( "A" ).value,
+			IECore.PathMatcher( [ "/plane/instances/sphere/{}/cube".format( i ) for i in range( 0, 400 ) ] )
+		)
+
+		cube["name"].setValue( "box" )
+		self.assertEqual(
+			parent["out"].set( "A" ).value,
+			IECore.PathMatcher( [ "/plane/instances/sphere/{}/box".format( i ) for i in range( 0, 400 ) ] )
+		)
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testSetPerformanceWithManyParents( self ) :
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 315 ) )
+
+		sphere = GafferScene.Sphere()
+
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( plane["out"] )
+		instancer["prototypes"].setInput( sphere["out"] )
+		instancer["filter"].setInput( planeFilter["out"] )
+
+		cube = GafferScene.Cube()
+		cube["sets"].setValue( "A" )
+
+		instanceFilter = GafferScene.PathFilter()
+		instanceFilter["paths"].setValue( IECore.StringVectorData( [ "/plane/instances/sphere/*" ] ) )
+
+		parent = GafferScene.Parent()
+		parent["in"].setInput( instancer["out"] )
+		parent["children"][0].setInput( cube["out"] )
+		parent["filter"].setInput( instanceFilter["out"] )
+
+		# Compute the branches up front, so that we measure only the
+		# set computation.
+		parent["out"].childNames( "/plane/instances/sphere/0" )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			self.assertEqual( parent["out"].set( "A" ).value.size(), 316 * 316 )
+
 	def testGlobalsPassThrough( self ) :
 
 		g = GafferScene.Group()
@@ -41,6 +41,7 @@ import IECore
 import IECoreScene
 
 import Gaffer
+import GafferTest
 import GafferScene
 import GafferSceneTest
 
@@ -403,5 +404,78 @@ class PruneTest( GafferSceneTest.SceneTestCase ) :
 		self.assertEqual( prune["out"].childNames( "/group"), IECore.InternedStringVectorData( [ "sphere" ] ) )
 		self.assertEqual( prune["out"].bound( "/" ), sphere["out"].bound( "/" ) )
 
+	def testSetWithManyMembers( self ) :
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 49 ) )
+
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		sphere = GafferScene.Sphere()
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( plane["out"] )
+		instancer["prototypes"].setInput( sphere["out"] )
+		instancer["filter"].setInput( planeFilter["out"] )
+
+		allInstancesFilter = GafferScene.PathFilter()
+		allInstancesFilter["paths"].setValue( IECore.StringVectorData( [ "/plane/instances/sphere/*" ] ) )
+
+		setNode = GafferScene.Set()
+		setNode["in"].setInput( instancer["out"] )
+		setNode["filter"].setInput( allInstancesFilter["out"] )
+		setNode["name"].setValue( "A" )
+
+		pruneFilter = GafferScene.PathFilter()
+		pruneFilter["paths"].setValue( IECore.StringVectorData( [ "/plane/instances/sphere/*1", "/plane/instances/sphere/2*" ] ) )
+
+		prune = GafferScene.Prune()
+		prune["in"].setInput( setNode["out"] )
+		prune["filter"].setInput( pruneFilter["out"] )
+
+		expected = IECore.PathMatcher( [
+			"/plane/instances/sphere/{}".format( i ) for i in range( 0, 2500 )
+			if not ( str( i ).endswith( "1" ) or str( i ).startswith( "2" ) )
+		] )
+
+		self.assertEqual( prune["out"].set( "A" ).value, expected )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testSetPerformance( self ) :
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 999 ) )
+
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		sphere = GafferScene.Sphere()
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( plane["out"] )
+		instancer["prototypes"].setInput( sphere["out"] )
+		instancer["filter"].setInput( planeFilter["out"] )
+
+		allInstancesFilter = GafferScene.PathFilter()
+		allInstancesFilter["paths"].setValue( IECore.StringVectorData( [ "/plane/instances/sphere/*" ] ) )
+
+		setNode = GafferScene.Set()
+		setNode["in"].setInput( instancer["out"] )
+		setNode["filter"].setInput( allInstancesFilter["out"] )
+		setNode["name"].setValue( "A" )
+
+		pruneFilter = GafferScene.PathFilter()
+		pruneFilter["paths"].setValue( IECore.StringVectorData( [ "/plane/instances/sphere/*1" ] ) )
+
+		prune = GafferScene.Prune()
+		prune["in"].setInput( setNode["out"] )
+		prune["filter"].setInput( pruneFilter["out"] )
+
+		prune["in"].set( "A" )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			prune["out"].set( "A" )
+
 if __name__ == "__main__":
 	unittest.main()
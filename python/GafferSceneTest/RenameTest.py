@@ -35,10 +35,12 @@
 ##########################################################################
 
 import unittest
+import imath
 
 import IECore
 
 import Gaffer
+import GafferTest
 import GafferScene
 import GafferSceneTest
 
@@ -607,5 +609,40 @@ class RenameTest( GafferSceneTest.SceneTestCase ) :
 		Gaffer.ValuePlug.clearCache()
 		rename["out"].set( "setA" )
 
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testSetPerformance( self ) :
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 999 ) )
+
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		sphere = GafferScene.Sphere()
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( plane["out"] )
+		instancer["prototypes"].setInput( sphere["out"] )
+		instancer["filter"].setInput( planeFilter["out"] )
+
+		allInstancesFilter = GafferScene.PathFilter()
+		allInstancesFilter["paths"].setValue( IECore.StringVectorData( [ "/plane/instances/sphere/*" ] ) )
+
+		setNode = GafferScene.Set()
+		setNode["in"].setInput( instancer["out"] )
+		setNode["filter"].setInput( allInstancesFilter["out"] )
+		setNode["name"].setValue( "A" )
+
+		rename = GafferScene.Rename()
+		rename["in"].setInput( setNode["out"] )
+		rename["filter"].setInput( allInstancesFilter["out"] )
+		rename["addPrefix"].setValue( "instance" )
+
+		rename["in"].set( "A" )
+		GafferSceneTest.traverseScene( rename["in"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			rename["out"].set( "A" )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -1863,5 +1863,200 @@ class RenderControllerTest( GafferSceneTest.SceneTestCase ) :
 		controller.update()
 		self.assertTrue( capture.isSame( renderer.capturedObject( "/cube" ) ) )
 
+	def testDirtyPathJournal( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		sphereFilter = GafferScene.PathFilter()
+		sphereFilter["paths"].setValue( IECore.StringVectorData( [ "/sphere" ] ) )
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( sphere["out"] )
+		duplicate["filter"].setInput( sphereFilter["out"] )
+		duplicate["copies"].setValue( 20 )
+		duplicate["transform"]["translate"]["x"].setValue( 1 )
+
+		transformFilter = GafferScene.PathFilter()
+		transformFilter["paths"].setValue( IECore.StringVectorData( [ "/sphere10" ] ) )
+
+		transform = GafferScene.Transform()
+		transform["in"].setInput( duplicate["out"] )
+		transform["filter"].setInput( transformFilter["out"] )
+
+		standardOptions = GafferScene.StandardOptions()
+		standardOptions["in"].setInput( transform["out"] )
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer()
+		controller = GafferScene.RenderController( standardOptions["out"], Gaffer.Context(), renderer )
+		controller.setMinimumExpansionDepth( 2 )
+		controller.update()
+
+		def assertTransformsMatch() :
+
+			for name in standardOptions["out"].childNames( "/" ) :
+				path = "/" + str( name )
+				self.assertEqual(
+					renderer.capturedObject( path ).capturedTransforms(),
+					[ standardOptions["out"].fullTransform( path ) ]
+				)
+
+		assertTransformsMatch()
+
+		# Edits to the Transform node only affect `/sphere10`, so that
+		# should be the only location that is updated.
+
+		transform["transform"]["translate"]["y"].setValue( 2 )
+		self.assertTrue( controller.updateRequired() )
+		with Gaffer.PerformanceMonitor() as monitor :
+			controller.update()
+
+		self.assertEqual( monitor.plugStatistics( transform["out"]["transform"] ).hashCount, 1 )
+		assertTransformsMatch()
+
+		# Duplicate doesn't publish the locations it affects, so edits to
+		# it must fall back to updating everything.
+
+		duplicate["transform"]["translate"]["x"].setValue( 2 )
+		self.assertTrue( controller.updateRequired() )
+		with Gaffer.PerformanceMonitor() as monitor :
+			controller.update()
+
+		self.assertGreater( monitor.plugStatistics( transform["out"]["transform"] ).hashCount, 20 )
+		assertTransformsMatch()
+
+		# As must changes to the filter itself.
+
+		transformFilter["paths"].setValue( IECore.StringVectorData( [ "/sphere5" ] ) )
+		controller.update()
+		assertTransformsMatch()
+
+	def testUpdateProgressively( self ) :
+
+		camera = GafferScene.Camera()
+
+		def sphere( name, radius, z ) :
+
+			result = GafferScene.Sphere()
+			result["name"].setValue( name )
+			result["radius"].setValue( radius )
+			result["transform"]["translate"]["z"].setValue( z )
+			return result
+
+		# Large on screen, small on screen, too small to prioritise,
+		# and behind the camera.
+		spheres = [
+			sphere( "large", 1, -3 ),
+			sphere( "medium", 0.05, -3 ),
+			sphere( "tiny", 0.01, -3 ),
+			sphere( "behind", 1, 3 ),
+		]
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( camera["out"] )
+		for i, s in enumerate( spheres ) :
+			group["in"][i+1].setInput( s["out"] )
+
+		options = GafferScene.StandardOptions()
+		options["in"].setInput( group["out"] )
+		options["options"]["render:camera"]["enabled"].setValue( True )
+		options["options"]["render:camera"]["value"].setValue( "/group/camera" )
+
+		paths = [ "/group/camera", "/group/large", "/group/medium", "/group/tiny", "/group/behind" ]
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer(
+			GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Interactive
+		)
+		controller = GafferScene.RenderController( options["out"], Gaffer.Context(), renderer )
+		controller.setMinimumExpansionDepth( 2 )
+
+		# Record which objects have been output each time the
+		# renderer is updated.
+
+		snapshots = []
+		def callback( status ) :
+			if status == Gaffer.BackgroundTask.Status.Running :
+				snapshots.append( tuple( renderer.capturedObject( p ) is not None for p in paths ) )
+
+		with IECore.CapturingMessageHandler() as mh :
+			controller.updateProgressively( callback )
+
+		# The renderer is left paused, without being started and stopped
+		# between passes.
+
+		self.assertEqual( mh.messages, [] )
+
+		# Everything should have been output in the end.
+
+		for path in paths :
+			self.assertIsNotNone( renderer.capturedObject( path ) )
+
+		progress = controller.progress()
+		self.assertEqual( progress.objectsTranslated, 5 )
+		self.assertGreater( progress.objectsPerSecond, 0 )
+
+		# But in order of importance, with each pass complete before
+		# the next one starts.
+
+		self.assertIn( ( True, True, False, False, False ), snapshots )
+		self.assertIn( ( True, True, True, False, False ), snapshots )
+		for cameraOutput, largeOutput, mediumOutput, tinyOutput, behindOutput in snapshots :
+			if largeOutput :
+				self.assertTrue( cameraOutput )
+			if mediumOutput :
+				self.assertTrue( largeOutput )
+			if tinyOutput or behindOutput :
+				self.assertTrue( mediumOutput )
+
+		# Subsequent edits are made in a single pass.
+
+		spheres[0]["radius"].setValue( 2 )
+		del snapshots[:]
+		controller.updateProgressively( callback )
+		self.assertEqual( controller.progress().objectsTranslated, 1 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.CategorisedTestMethod( { "expensivePerformance" } )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testSingleLocationEditPerformance( self ) :
+
+		# Edit the transform of a single location in a scene with a million
+		# locations. The dirty path journal means that we should only need to
+		# visit the edited location, rather than the whole scene.
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 999 ) )
+
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		sphere = GafferScene.Sphere()
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( plane["out"] )
+		instancer["prototypes"].setInput( sphere["out"] )
+		instancer["filter"].setInput( planeFilter["out"] )
+
+		transformFilter = GafferScene.PathFilter()
+		transformFilter["paths"].setValue( IECore.StringVectorData( [ "/plane/instances/sphere/500000" ] ) )
+
+		transform = GafferScene.Transform()
+		transform["in"].setInput( instancer["out"] )
+		transform["filter"].setInput( transformFilter["out"] )
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer()
+		controller = GafferScene.RenderController( transform["out"], Gaffer.Context(), renderer )
+		controller.setMinimumExpansionDepth( 4 )
+		controller.update()
+
+		transform["transform"]["translate"]["y"].setValue( 1 )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			controller.update()
+
+		self.assertEqual(
+			renderer.capturedObject( "/plane/instances/sphere/500000" ).capturedTransforms(),
+			[ transform["out"].fullTransform( "/plane/instances/sphere/500000" ) ]
+		)
+
 if __name__ == "__main__":
 	unittest.main()
@@ -43,6 +43,7 @@ import IECore
 import IECoreScene
 
 import Gaffer
+import GafferTest
 import GafferScene
 import GafferSceneTest
 
@@ -309,6 +310,55 @@ class ScatterTest( GafferSceneTest.SceneTestCase ) :
 
 		self.assertEqual( scatter["out"].object( "/plane/scatter" ).keys(), ["N", "P", "type"] )
 
+	def testLargeMesh( self ) :
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 250 ) )
+
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		primitiveVariables = GafferScene.PrimitiveVariables()
+		primitiveVariables["in"].setInput( plane["out"] )
+		primitiveVariables["filter"].setInput( planeFilter["out"] )
+		primitiveVariables["primitiveVariables"].addChild( Gaffer.NameValuePlug( "constant", 10 ) )
+
+		scatter = GafferScene.Scatter()
+		scatter["in"].setInput( primitiveVariables["out"] )
+		scatter["parent"].setValue( "/plane" )
+		scatter["density"].setValue( 100 )
+		scatter["primitiveVariables"].setValue( "*" )
+
+		# Points are distributed in parallel, but the result should be identical
+		# to distributing over the whole mesh in one go.
+
+		expected = IECoreScene.MeshAlgo.distributePoints(
+			primitiveVariables["out"].object( "/plane" ), 100, imath.V2f( 0 ), "", "uv", "P", "*"
+		)
+		expected["type"] = IECoreScene.PrimitiveVariable( IECoreScene.PrimitiveVariable.Interpolation.Constant, "gl:point" )
+
+		points = scatter["out"].object( "/plane/seeds" )
+		self.assertGreater( points.numPoints, 1000 )
+		self.assertEqual( points, expected )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testLargeMeshPerformance( self ) :
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 1000 ) )
+
+		scatter = GafferScene.Scatter()
+		scatter["in"].setInput( plane["out"] )
+		scatter["parent"].setValue( "/plane" )
+		scatter["density"].setValue( 1000000 )
+
+		# Precache the input object so we don't include
+		# it in the performance measurement.
+		plane["out"].object( "/plane" )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			scatter["out"].object( "/plane/seeds" )
+
 	def testInternalConnectionsNotSerialised( self ) :
 
 		s = Gaffer.ScriptNode()
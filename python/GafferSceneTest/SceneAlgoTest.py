@@ -2351,6 +2351,50 @@ class SceneAlgoTest( GafferSceneTest.SceneTestCase ) :
 
 		self.assertNotEqual( h1, h2 )
 
+	def testHierarchyHashCaching( self ) :
+
+		script = Gaffer.ScriptNode()
+
+		script["sphere"] = GafferScene.Sphere()
+
+		script["innerGroup"] = GafferScene.Group()
+		script["innerGroup"]["in"][0].setInput( script["sphere"]["out"] )
+
+		script["outerGroup"] = GafferScene.Group()
+		script["outerGroup"]["in"][0].setInput( script["innerGroup"]["out"] )
+
+		with Gaffer.Context() as context :
+
+			h1 = GafferScene.SceneAlgo.hierarchyHash( script["outerGroup"]["out"], "/group" )
+
+			# Repeated queries for an unchanged scene shouldn't need to
+			# visit the locations below the root.
+
+			Gaffer.ValuePlug.clearHashCache( now = True )
+			with Gaffer.PerformanceMonitor() as monitor :
+				self.assertEqual( GafferScene.SceneAlgo.hierarchyHash( script["outerGroup"]["out"], "/group" ), h1 )
+
+			self.assertEqual( monitor.plugStatistics( script["sphere"]["out"]["object"] ).hashCount, 0 )
+
+			# But changes deep in the hierarchy must still be detected.
+
+			script["sphere"]["radius"].setValue( 2 )
+			self.assertNotEqual( GafferScene.SceneAlgo.hierarchyHash( script["outerGroup"]["out"], "/group" ), h1 )
+
+			script["sphere"]["radius"].setValue( 1 )
+			self.assertEqual( GafferScene.SceneAlgo.hierarchyHash( script["outerGroup"]["out"], "/group" ), h1 )
+
+			# As must changes in context.
+
+			script["expression"] = Gaffer.Expression()
+			script["expression"].setExpression( 'parent["sphere"]["radius"] = context.getFrame()' )
+
+			h2 = GafferScene.SceneAlgo.hierarchyHash( script["outerGroup"]["out"], "/group" )
+			context.setFrame( 2 )
+			self.assertNotEqual( GafferScene.SceneAlgo.hierarchyHash( script["outerGroup"]["out"], "/group" ), h2 )
+			context.setFrame( 1 )
+			self.assertEqual( GafferScene.SceneAlgo.hierarchyHash( script["outerGroup"]["out"], "/group" ), h2 )
+
 	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
 	def testHierarchyHashPerf( self ):
 
@@ -2706,6 +2750,79 @@ class SceneAlgoTest( GafferSceneTest.SceneTestCase ) :
 
 		self.assertEqual( gathered, [] )
 
+	def __wideScene( self, copies ) :
+
+		sphere = GafferScene.Sphere()
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( sphere["out"] )
+		duplicate["target"].setValue( "/sphere" )
+		duplicate["copies"].setValue( copies )
+		duplicate["transform"]["translate"]["x"].setValue( 1 )
+
+		return [ sphere, duplicate ], duplicate["out"]
+
+	def __deepScene( self, depth, copies ) :
+
+		nodes = [ GafferScene.Sphere() ]
+		for i in range( 0, depth ) :
+			group = GafferScene.Group()
+			group["in"][0].setInput( nodes[-1]["out"] )
+			group["transform"]["translate"]["y"].setValue( 1 )
+			nodes.append( group )
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( nodes[-1]["out"] )
+		duplicate["target"].setValue( "/group" )
+		duplicate["copies"].setValue( copies )
+		duplicate["transform"]["translate"]["x"].setValue( 1 )
+		nodes.append( duplicate )
+
+		return nodes, duplicate["out"]
+
+	def testParallelProcessLocationsContext( self ) :
+
+		# Check that the context is correct for every location, in
+		# hierarchies wide enough to be processed in packets and deep
+		# enough to reuse a scope for many levels.
+
+		for nodes, scene in [
+			self.__wideScene( 5000 ),
+			self.__deepScene( 20, 500 ),
+		] :
+
+			gathered = []
+			GafferScene.SceneAlgo.parallelGatherLocations(
+				scene,
+				lambda scene, path : ( GafferScene.ScenePlug.pathToString( path ), scene["transform"].getValue() == scene.transform( path ) ),
+				lambda x : gathered.append( x )
+			)
+
+			paths = IECore.PathMatcher()
+			GafferScene.SceneAlgo.matchingPaths( IECore.PathMatcher( [ "/..." ] ), scene, paths )
+
+			self.assertEqual( len( gathered ), paths.size() )
+			self.assertEqual( { x[0] for x in gathered }, set( paths.paths() ) )
+			self.assertTrue( all( x[1] for x in gathered ) )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testTraverseWideScenePerformance( self ) :
+
+		nodes, scene = self.__wideScene( 500000 )
+		scene.childNames( "/" )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferSceneTest.traverseScene( scene )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testTraverseDeepScenePerformance( self ) :
+
+		nodes, scene = self.__deepScene( 100, 1000 )
+		scene.childNames( "/" )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferSceneTest.traverseScene( scene )
+
 	def tearDown( self ) :
 
 		GafferSceneTest.SceneTestCase.tearDown( self )
@@ -293,5 +293,51 @@ class ScenePlugTest( GafferSceneTest.SceneTestCase ) :
 		self.assertEqual( p.globalsHash(), p["globals"].hash() )
 		self.assertEqual( p.setNamesHash(), p["setNames"].hash() )
 
+	def testBranchSet( self ) :
+
+		sphere = GafferScene.Sphere()
+		sphere["sets"].setValue( "A" )
+
+		cube = GafferScene.Cube()
+		cube["sets"].setValue( "A" )
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( sphere["out"] )
+		group["in"][1].setInput( cube["out"] )
+
+		plane = GafferScene.Plane()
+		plane["sets"].setValue( "A" )
+
+		merge = GafferScene.MergeScenes()
+		merge["in"][0].setInput( group["out"] )
+		merge["in"][1].setInput( plane["out"] )
+
+		attributes = GafferScene.StandardAttributes()
+		attributes["in"].setInput( merge["out"] )
+		self.assertTrue( attributes["out"]["branchSet"].getInput().isSame( merge["out"]["branchSet"] ) )
+
+		for scene in ( group["out"], merge["out"], attributes["out"] ) :
+			for path in ( "/", "/group", "/group/sphere", "/group/cube", "/plane", "/notHere" ) :
+				expected = IECore.PathMatcher( [
+					p for p in scene.set( "A" ).value.paths()
+					if path == "/" or p == path or p.startswith( path + "/" )
+				] )
+				self.assertEqual( scene.branchSet( "A", path ).value, expected )
+			self.assertEqual( scene.branchSet( "B", "/group" ).value, IECore.PathMatcher() )
+			self.assertEqual( scene.branchSetHash( "A", "/" ), scene.setHash( "A" ) )
+
+		# MergeScenes should merge the input branches, without ever
+		# computing the full output set.
+
+		sphere["sets"].setValue( "A B" )
+		with Gaffer.PerformanceMonitor() as monitor :
+			self.assertEqual(
+				merge["out"].branchSet( "A", "/group/sphere" ).value,
+				IECore.PathMatcher( [ "/group/sphere" ] )
+			)
+
+		self.assertEqual( monitor.plugStatistics( merge["out"]["set"] ).computeCount, 0 )
+		self.assertEqual( monitor.plugStatistics( merge["out"]["branchSet"] ).computeCount, 1 )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -826,5 +826,110 @@ class SceneReaderTest( GafferSceneTest.SceneTestCase ) :
 		self.assertEqual( len( mh.messages ), 1 )
 		self.assertEqual( mh.messages[0].message, 'No file found for "/volume"' )
 
+	def testIndex( self ) :
+
+		plane = GafferScene.Plane()
+		plane["sets"].setValue( "A B" )
+
+		sphere = GafferScene.Sphere()
+		sphere["sets"].setValue( "B C" )
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( plane["out"] )
+		group["in"][1].setInput( sphere["out"] )
+
+		writer = GafferScene.SceneWriter()
+		writer["in"].setInput( group["out"] )
+		writer["fileName"].setValue( self.temporaryDirectory() / "test.scc" )
+		writer["task"].execute()
+
+		reader = GafferScene.SceneReader()
+		reader["fileName"].setInput( writer["fileName"] )
+
+		def sceneValues() :
+
+			result = {}
+			def walk( path ) :
+				result[path] = ( reader["out"].childNames( path ), reader["out"].bound( path ) )
+				for childName in result[path][0] :
+					walk( path.rstrip( "/" ) + "/" + str( childName ) )
+			walk( "/" )
+
+			for setName in reader["out"].setNames() :
+				result[setName] = reader["out"].set( setName )
+
+			return result
+
+		def indexFiles() :
+
+			return sorted( indexDirectory.glob( "*.fio" ) )
+
+		expectedValues = sceneValues()
+
+		indexDirectory = self.temporaryDirectory() / "index"
+		originalIndexDirectory = GafferScene.SceneReader.getIndexDirectory()
+		self.addCleanup( GafferScene.SceneReader.setIndexDirectory, originalIndexDirectory )
+		GafferScene.SceneReader.setIndexDirectory( str( indexDirectory ) )
+		self.assertEqual( GafferScene.SceneReader.getIndexDirectory(), str( indexDirectory ) )
+
+		# Index is built in the background on first use. The file is read
+		# directly until it is complete.
+
+		self.assertEqual( sceneValues(), expectedValues )
+		GafferSceneTest.waitForSceneReaderIndexBuilds()
+		self.assertEqual( len( indexFiles() ), 1 )
+		self.assertEqual( sceneValues(), expectedValues )
+
+		self.assertNotEqual( reader["out"].childNamesHash( "/" ), reader["out"].childNamesHash( "/group" ) )
+		self.assertNotEqual( reader["out"].boundHash( "/group/plane" ), reader["out"].boundHash( "/group/sphere" ) )
+
+		# And loaded from disk after that.
+
+		GafferScene.SceneReader.setIndexDirectory( str( indexDirectory ) )
+		Gaffer.ValuePlug.clearCache()
+		Gaffer.ValuePlug.clearHashCache()
+
+		self.assertEqual( sceneValues(), expectedValues )
+		self.assertEqual( len( indexFiles() ), 1 )
+
+		# Incrementing `refreshCount` builds a new index.
+
+		reader["refreshCount"].setValue( reader["refreshCount"].getValue() + 1 )
+		self.assertEqual( sceneValues(), expectedValues )
+		GafferSceneTest.waitForSceneReaderIndexBuilds()
+		self.assertEqual( len( indexFiles() ), 2 )
+
+		# As does changing the tags.
+
+		reader["tags"].setValue( "ObjectType:MeshPrimitive" )
+		self.assertEqual( reader["out"].childNames( "/group" ), IECore.InternedStringVectorData( [ "plane" ] ) )
+		GafferSceneTest.waitForSceneReaderIndexBuilds()
+		self.assertEqual( len( indexFiles() ), 3 )
+
+		# Invalid indices are rebuilt.
+
+		reader["tags"].setValue( "" )
+		for f in indexFiles() :
+			f.write_text( "notAnIndex" )
+
+		GafferScene.SceneReader.setIndexDirectory( str( indexDirectory ) )
+		Gaffer.ValuePlug.clearCache()
+		Gaffer.ValuePlug.clearHashCache()
+
+		with IECore.CapturingMessageHandler() as mh :
+			self.assertEqual( sceneValues(), expectedValues )
+
+		self.assertEqual( len( mh.messages ), 1 )
+		self.assertIn( "Rebuilding index", mh.messages[0].message )
+
+		GafferSceneTest.waitForSceneReaderIndexBuilds()
+		Gaffer.ValuePlug.clearCache()
+		Gaffer.ValuePlug.clearHashCache()
+
+		with IECore.CapturingMessageHandler() as mh :
+			self.assertEqual( sceneValues(), expectedValues )
+
+		self.assertEqual( mh.messages, [] )
+
 if __name__ == "__main__":
 	unittest.main()
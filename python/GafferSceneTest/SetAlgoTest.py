@@ -35,11 +35,13 @@
 ##########################################################################
 
 import re
+import random
 import functools
 
 import IECore
 
 import Gaffer
+import GafferTest
 import GafferScene
 import GafferSceneTest
 
@@ -331,6 +333,121 @@ class SetAlgoTest( GafferSceneTest.SceneTestCase ) :
 
 		self.assertFalse( GafferScene.SetAlgo.affectsSetExpression( Gaffer.IntPlug() ) )
 
+	def testShortCircuitEvaluation( self ) :
+
+		cube = GafferScene.Cube()
+
+		setA = GafferScene.Set()
+		setA["in"].setInput( cube["out"] )
+		setA["name"].setValue( "A" )
+		setA["paths"].setValue( IECore.StringVectorData( [ "/cube" ] ) )
+
+		setEmpty = GafferScene.Set()
+		setEmpty["in"].setInput( setA["out"] )
+		setEmpty["name"].setValue( "empty" )
+
+		for expression in [ "empty & A", "empty - A", "empty in A", "empty containing A" ] :
+			with Gaffer.PerformanceMonitor() as monitor :
+				self.assertEqual( GafferScene.SetAlgo.evaluateSetExpression( expression, setEmpty["out"] ), IECore.PathMatcher() )
+			self.assertEqual( monitor.plugStatistics( setA["out"]["set"] ).computeCount, 0 )
+
+		self.assertCorrectEvaluation( setEmpty["out"], "empty | A", [ "/cube" ] )
+		self.assertCorrectEvaluation( setEmpty["out"], "A - empty", [ "/cube" ] )
+
+	def testSharedSubExpressions( self ) :
+
+		cube = GafferScene.Cube()
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( cube["out"] )
+		duplicate["target"].setValue( "/cube" )
+		duplicate["copies"].setValue( 4 )
+
+		setA = GafferScene.Set()
+		setA["in"].setInput( duplicate["out"] )
+		setA["name"].setValue( "A" )
+		setA["paths"].setValue( IECore.StringVectorData( [ "/cube", "/cube1", "/cube2" ] ) )
+
+		setB = GafferScene.Set()
+		setB["in"].setInput( setA["out"] )
+		setB["name"].setValue( "B" )
+		setB["paths"].setValue( IECore.StringVectorData( [ "/cube2", "/cube3" ] ) )
+
+		setC = GafferScene.Set()
+		setC["in"].setInput( setB["out"] )
+		setC["name"].setValue( "C" )
+		setC["paths"].setValue( IECore.StringVectorData( [ "/cube1" ] ) )
+
+		# The same subexpressions appear in several expressions, and the
+		# same expressions are evaluated repeatedly. Results must remain
+		# correct as the input sets are edited.
+
+		for i in range( 0, 2 ) :
+			self.assertCorrectEvaluation( setC["out"], "(A | B) - C", [ "/cube", "/cube2", "/cube3" ] )
+			self.assertCorrectEvaluation( setC["out"], "C | (A | B) - C", [ "/cube", "/cube1", "/cube2", "/cube3" ] )
+			self.assertCorrectEvaluation( setC["out"], "(A | B) & (B | C)", [ "/cube1", "/cube2", "/cube3" ] )
+
+		setB["paths"].setValue( IECore.StringVectorData( [ "/cube4" ] ) )
+
+		self.assertCorrectEvaluation( setC["out"], "(A | B) - C", [ "/cube", "/cube2", "/cube4" ] )
+		self.assertCorrectEvaluation( setC["out"], "C | (A | B) - C", [ "/cube", "/cube1", "/cube2", "/cube4" ] )
+		self.assertCorrectEvaluation( setC["out"], "(A | B) & (B | C)", [ "/cube1", "/cube4" ] )
+
+		# Syntax errors must be reported every time, not just the first.
+
+		for i in range( 0, 2 ) :
+			with self.assertRaisesRegex( RuntimeError, "Syntax error" ) :
+				GafferScene.SetAlgo.evaluateSetExpression( "(A | B", setC["out"] )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testLinkingExpressionPerformance( self ) :
+
+		# 200 sets, each containing a random sample of 1000 locations, queried
+		# via the sort of expressions typically used for light linking.
+
+		cube = GafferScene.Cube()
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( cube["out"] )
+		duplicate["target"].setValue( "/cube" )
+		duplicate["copies"].setValue( 999 )
+
+		locations = [ "/cube" ] + [ "/cube{}".format( i ) for i in range( 1, 1000 ) ]
+		generator = random.Random( 0 )
+
+		scene = duplicate["out"]
+		setNodes = []
+		for i in range( 0, 200 ) :
+			setNode = GafferScene.Set()
+			setNode["in"].setInput( scene )
+			setNode["name"].setValue( "set{}".format( i ) )
+			setNode["paths"].setValue( IECore.StringVectorData( generator.sample( locations, 100 ) ) )
+			setNodes.append( setNode )
+			scene = setNode["out"]
+
+		def randomSet() :
+			return "set{}".format( generator.randrange( 0, 200 ) )
+
+		expressions = []
+		for i in range( 0, 100 ) :
+			common = "({} | {} | {})".format( randomSet(), randomSet(), randomSet() )
+			expressions.extend( [
+				"{} - {}".format( common, randomSet() ),
+				"{} & {}".format( common, randomSet() ),
+				"{} | {} {}".format( common, randomSet(), randomSet() ),
+				"{} in ({} | {})".format( randomSet(), common, randomSet() ),
+			] )
+
+		# Compute all the sets up front, so that we're only timing the
+		# evaluation of the expressions themselves.
+		for expression in expressions :
+			GafferScene.SetAlgo.evaluateSetExpression( expression, scene )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			for i in range( 0, 10 ) :
+				for expression in expressions :
+					GafferScene.SetAlgo.evaluateSetExpression( expression, scene )
+
 	def assertCorrectEvaluation( self, scenePlug, expression, expectedContents ) :
 
 		result = set( GafferScene.SetAlgo.evaluateSetExpression( expression, scenePlug ).paths() )
@@ -254,6 +254,7 @@ class SetTest( GafferSceneTest.SceneTestCase ) :
 		expectedFilterDependentPlugs = {
 			s["filter"],
 			s["out"]["set"],
+			s["out"]["branchSet"],
 			s["out"],
 			s["__filterResults"],
 			s["__pathMatcher"],
@@ -172,6 +172,18 @@ Gaffer.Metadata.registerNode(
 
 			"plugValueWidget:type", "GafferUI.PresetsPlugValueWidget",
 		],
+		"adaptive" : [
+
+			"description",
+			"""
+			Varies the number of divisions according to the curvature of the mesh, rather than
+			using the same number everywhere. The full number of divisions is used only where the
+			mesh is most curved, and flat regions receive as few as none, saving memory and
+			downstream processing. Divisions are chosen per edge, so neighbouring faces always
+			agree and the result remains watertight.
+			""",
+
+		],
 	}
 
 )
@@ -40,6 +40,7 @@
 #include "Gaffer/Action.h"
 #include "Gaffer/ComputeNode.h"
 #include "Gaffer/Context.h"
+#include "Gaffer/Private/CacheRegistry.h"
 #include "Gaffer/Private/IECorePreview/LRUCache.h"
 #include "Gaffer/Process.h"
 
@@ -52,7 +53,9 @@
 #include "fmt/format.h"
 
 #include <atomic>
+#include <mutex>
 #include <unordered_set>
+#include <vector>
 
 using namespace Gaffer;
 
@@ -94,8 +97,62 @@ const IECore::MurmurHash g_nullHash;
 // order to catch inaccuracies in the cache
 const uint64_t DIRTY_COUNT_RANGE_MAX = std::numeric_limits<uint64_t>::max() / 2;
 
+const size_t g_defaultCacheMemoryLimit = 1024 * 1024 * 1024 * 1; // 1 gig
+
 } // namespace
 
+//////////////////////////////////////////////////////////////////////////
+// Registry of additional caches managed alongside the compute cache.
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+struct RegisteredCache
+{
+	std::function<void ()> clear;
+	std::function<void ( size_t )> setMemoryLimit;
+	std::function<size_t ()> memoryUsage;
+	float memoryLimitFraction;
+};
+
+struct CacheRegistry
+{
+	std::mutex mutex;
+	std::vector<RegisteredCache> caches;
+	// The limit passed to `ValuePlug::setCacheMemoryLimit()`. Each registered
+	// cache is given its fraction of this, and the compute cache gets the
+	// remainder.
+	size_t memoryLimit = g_defaultCacheMemoryLimit;
+};
+
+CacheRegistry &cacheRegistry()
+{
+	// Deliberately leaked, as registered caches are typically
+	// function-level statics with an unpredictable destruction order.
+	static CacheRegistry *g_registry = new CacheRegistry;
+	return *g_registry;
+}
+
+size_t registeredCacheLimit( size_t bytes, float fraction )
+{
+	return static_cast<size_t>( static_cast<double>( bytes ) * fraction );
+}
+
+} // namespace
+
+void Gaffer::Private::registerCache( const std::function<void ()> &clear, const std::function<void ( size_t )> &setMemoryLimit, const std::function<size_t ()> &memoryUsage, float memoryLimitFraction )
+{
+	{
+		CacheRegistry &registry = cacheRegistry();
+		std::lock_guard<std::mutex> lock( registry.mutex );
+		registry.caches.push_back( { clear, setMemoryLimit, memoryUsage, memoryLimitFraction } );
+	}
+
+	// Reapply the current limit, to share it with the new cache.
+	ValuePlug::setCacheMemoryLimit( ValuePlug::getCacheMemoryLimit() );
+}
+
 //////////////////////////////////////////////////////////////////////////
 // The HashProcess manages the task of calling ComputeNode::hash() and
 // managing a cache of recently computed hashes.
@@ -696,7 +753,7 @@ class ValuePlug::ComputeProcess : public Process
 const IECore::InternedString ValuePlug::ComputeProcess::staticType( ValuePlug::computeProcessType() );
 // Using a null `GetterFunction` because it will never get called, because we only ever call `getIfCached()`.
 // Note : The default size here is overridden by `startup/Gaffer/cache.py`.
-ValuePlug::ComputeProcess::CacheType ValuePlug::ComputeProcess::g_cache( CacheType::GetterFunction(), 1024 * 1024 * 1024 * 1, CacheType::RemovalCallback(), /* cacheErrors = */ false ); // 1 gig
+ValuePlug::ComputeProcess::CacheType ValuePlug::ComputeProcess::g_cache( CacheType::GetterFunction(), g_defaultCacheMemoryLimit, CacheType::RemovalCallback(), /* cacheErrors = */ false );
 
 //////////////////////////////////////////////////////////////////////////
 // SetValueAction implementation
@@ -1120,22 +1177,52 @@ void ValuePlug::dirty()
 
 size_t ValuePlug::getCacheMemoryLimit()
 {
-	return ComputeProcess::getCacheMemoryLimit();
+	CacheRegistry &registry = cacheRegistry();
+	std::lock_guard<std::mutex> lock( registry.mutex );
+	return registry.memoryLimit;
 }
 
 void ValuePlug::setCacheMemoryLimit( size_t bytes )
 {
-	ComputeProcess::setCacheMemoryLimit( bytes );
+	CacheRegistry &registry = cacheRegistry();
+	std::lock_guard<std::mutex> lock( registry.mutex );
+	registry.memoryLimit = bytes;
+
+	size_t computeCacheLimit = bytes;
+	for( const auto &cache : registry.caches )
+	{
+		const size_t cacheLimit = std::min( registeredCacheLimit( bytes, cache.memoryLimitFraction ), computeCacheLimit );
+		cache.setMemoryLimit( cacheLimit );
+		computeCacheLimit -= cacheLimit;
+	}
+
+	ComputeProcess::setCacheMemoryLimit( computeCacheLimit );
 }
 
 size_t ValuePlug::cacheMemoryUsage()
 {
-	return ComputeProcess::cacheMemoryUsage();
+	size_t result = ComputeProcess::cacheMemoryUsage();
+
+	CacheRegistry &registry = cacheRegistry();
+	std::lock_guard<std::mutex> lock( registry.mutex );
+	for( const auto &cache : registry.caches )
+	{
+		result += cache.memoryUsage();
+	}
+
+	return result;
 }
 
 void ValuePlug::clearCache()
 {
 	ComputeProcess::clearCache();
+
+	CacheRegistry &registry = cacheRegistry();
+	std::lock_guard<std::mutex> lock( registry.mutex );
+	for( const auto &cache : registry.caches )
+	{
+		cache.clear();
+	}
 }
 
 size_t ValuePlug::getHashCacheSizeLimit()
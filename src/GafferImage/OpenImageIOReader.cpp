@@ -36,6 +36,7 @@
 //////////////////////////////////////////////////////////////////////////
 
 #include "GafferImage/OpenImageIOReader.h"
+#include "GafferImage/Private/ReadAhead.h"
 
 // The nested TaskMutex needs to be the first to include tbb
 #include "Gaffer/Private/IECorePreview/LRUCache.h"
@@ -63,8 +64,19 @@
 
 #include "tbb/parallel_for.h"
 #include "tbb/enumerable_thread_specific.h"
-
+#include "tbb/task_arena.h"
+#include "tbb/task_group.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <tuple>
 
 OIIO_NAMESPACE_USING
 
@@ -115,26 +127,31 @@ void podVectorResizeUninitialized( std::vector<T> &v, size_t s )
 }
 
 const IECore::InternedString g_tileBatchOriginContextName( "__tileBatchOrigin" );
+const IECore::InternedString g_tileBatchChannelsContextName( "__tileBatchChannels" );
 const IECore::InternedString g_noView( "" );
 
 const std::string g_oiioCompression( "compression" );
 
 struct ChannelMapEntry
 {
-	ChannelMapEntry( int subImage, int channelIndex )
-		: subImage( subImage ), channelIndex( channelIndex )
+	ChannelMapEntry( int subImage, int channelIndex, int numSubImageChannels )
+		: subImage( subImage ), channelIndex( channelIndex ), subImageChannels( 0, numSubImageChannels ), layerChannels( subImageChannels )
 	{}
 
 	ChannelMapEntry( const ChannelMapEntry & ) = default;
 
 	ChannelMapEntry()
-		: subImage( 0 ), channelIndex( 0 )
+		: subImage( 0 ), channelIndex( 0 ), subImageChannels( 0 ), layerChannels( 0 )
 	{}
 
 	ChannelMapEntry& operator=( const ChannelMapEntry &rhs ) = default;
 
 	int subImage;
 	int channelIndex;
+	// Half-open ranges of channel indices within the subimage. `layerChannels`
+	// spans all the channels in the same layer as this one.
+	V2i subImageChannels;
+	V2i layerChannels;
 };
 
 // This function transforms an input region to account for the display window being flipped.
@@ -708,6 +725,132 @@ Box2i expandToGrid( Box2i region, V2i gridOrigin, V2i gridSize )
 }
 
 
+// Pool of threads used to read tile batches ahead of them being requested by
+// `OpenImageIOReader::compute()`. These are deliberately not TBB workers, so
+// that threads stalled on slow I/O don't starve the rest of the graph of
+// workers for compute. The number of threads may be changed at any time, and
+// a value of 0 disables reading ahead entirely.
+class ReadAheadPool
+{
+
+	public :
+
+		static ReadAheadPool &instance()
+		{
+			// Deliberately leaked, so that we don't have to join threads
+			// during static destruction.
+			static ReadAheadPool *p = new ReadAheadPool;
+			return *p;
+		}
+
+		void setNumThreads( size_t numThreads )
+		{
+			{
+				std::lock_guard<std::mutex> lock( m_mutex );
+				m_targetNumThreads = numThreads;
+				while( m_numThreads < m_targetNumThreads )
+				{
+					std::thread( &ReadAheadPool::worker, this ).detach();
+					m_numThreads++;
+				}
+				if( !m_targetNumThreads )
+				{
+					m_queue.clear();
+				}
+			}
+			// Wake any surplus threads so that they can exit.
+			m_condition.notify_all();
+			m_idleCondition.notify_all();
+		}
+
+		size_t getNumThreads()
+		{
+			std::lock_guard<std::mutex> lock( m_mutex );
+			return m_targetNumThreads;
+		}
+
+		void waitForIdle()
+		{
+			std::unique_lock<std::mutex> lock( m_mutex );
+			m_idleCondition.wait( lock, [this] { return m_queue.empty() && !m_numBusy; } );
+		}
+
+		// Returns false if the function could not be queued because
+		// reading ahead is disabled.
+		bool enqueue( std::function<void ()> &&f )
+		{
+			{
+				std::lock_guard<std::mutex> lock( m_mutex );
+				if( !m_targetNumThreads )
+				{
+					return false;
+				}
+				m_queue.push_back( std::move( f ) );
+			}
+			m_condition.notify_one();
+			return true;
+		}
+
+	private :
+
+		ReadAheadPool()
+			:	m_numThreads( 0 ), m_targetNumThreads( 0 ), m_numBusy( 0 )
+		{
+		}
+
+		void worker()
+		{
+			std::unique_lock<std::mutex> lock( m_mutex );
+			while( true )
+			{
+				m_condition.wait( lock, [this] { return m_queue.size() || m_numThreads > m_targetNumThreads; } );
+				if( m_numThreads > m_targetNumThreads )
+				{
+					m_numThreads--;
+					return;
+				}
+
+				std::function<void ()> f = std::move( m_queue.front() );
+				m_queue.pop_front();
+				m_numBusy++;
+
+				lock.unlock();
+				f();
+				// Destroy `f` before reacquiring the lock, since it may hold
+				// the last reference to a File.
+				f = nullptr;
+				lock.lock();
+
+				m_numBusy--;
+				if( m_queue.empty() && !m_numBusy )
+				{
+					m_idleCondition.notify_all();
+				}
+			}
+		}
+
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
+		std::condition_variable m_idleCondition;
+		std::deque<std::function<void ()>> m_queue;
+		size_t m_numThreads;
+		size_t m_targetNumThreads;
+		size_t m_numBusy;
+
+};
+
+// The maximum number of batches that may be read ahead for a single file
+// without being claimed by a compute. This bounds the memory held outside of
+// the compute cache. When the limit is reached, the oldest unclaimed batches
+// are discarded to make room for new ones.
+const size_t g_maxReadAheadBatches = 4;
+
+// The number of recently computed batches we remember for each file, so that
+// we don't read them ahead again.
+const size_t g_maxRecentBatches = 256;
+
+std::atomic<uint64_t> g_readAheadClaimCount( 0 );
+
 // This class handles storing a file handle, and reading data from it in a way compatible with how we want
 // to store it on plugs.
 //
@@ -733,9 +876,17 @@ Box2i expandToGrid( Box2i region, V2i gridOrigin, V2i gridSize )
 // Tile batches are selected using V3i "tileBatchOrigin".  The Z component is the subimage to load channels from.
 // The X and Y components are the pixel coordinates of the origin of the first tile.
 //
-class File
+// When the ReadAheadPool has threads, each read of a tile batch also schedules reads of the spatially adjacent
+// batches, so that their I/O overlaps with the compute of the current batch rather than stalling the
+// compute threads when they are requested in turn.
+//
+class File : public std::enable_shared_from_this<File>
 {
 
+	private :
+
+		struct View;
+
 	public:
 
 		// Create a File handle object for an image input and image spec
@@ -949,12 +1100,37 @@ class File
 					}
 					else
 					{
-						channelView->channelMap[ channelName ] = ChannelMapEntry( subImageIndex, &n - &currentSpec.channelnames[0] );
+						channelView->channelMap[ channelName ] = ChannelMapEntry( subImageIndex, &n - &currentSpec.channelnames[0], currentSpec.nchannels );
 						channelView->channelNames.push_back( channelName );
 					}
 				}
 			}
 
+			// Find the range of channels occupied by each layer within each subimage, so that
+			// layers can be read without converting the channels of other layers.
+			for( auto &[viewName, view] : m_views )
+			{
+				std::map<std::pair<int, std::string>, V2i> layerRanges;
+				for( const auto &[channelName, entry] : view->channelMap )
+				{
+					const auto [it, inserted] = layerRanges.try_emplace(
+						std::make_pair( entry.subImage, ImageAlgo::layerName( channelName ) ),
+						V2i( entry.channelIndex, entry.channelIndex + 1 )
+					);
+					it->second.x = std::min( it->second.x, entry.channelIndex );
+					it->second.y = std::max( it->second.y, entry.channelIndex + 1 );
+				}
+				for( auto &[channelName, entry] : view->channelMap )
+				{
+					entry.layerChannels = layerRanges.at( std::make_pair( entry.subImage, ImageAlgo::layerName( channelName ) ) );
+				}
+			}
+
+			for( auto &[viewName, view] : m_views )
+			{
+				initialiseMipLevels( *view );
+			}
+
 			if( channelNaming != ImageReader::ChannelInterpretation::Specification && viewNames.size() == 1 && viewNames[0] == "main" )
 			{
 				// When Nuke writes images without specific views to EXR, it creates a single view named "main".
@@ -967,14 +1143,79 @@ class File
 			}
 		}
 
-		// Read a chunk of data from the file, formatted as a tile batch that will be stored on the tile batch plug
-		ConstObjectVectorPtr readTileBatch( const Context *c, V3i tileBatchOrigin )
+		~File()
+		{
+			if( m_bytesDecoded > m_bytesUsed )
+			{
+				IECore::msg(
+					IECore::Msg::Debug, "OpenImageIOReader",
+					fmt::format(
+						"Decoded {} bytes from \"{}\" to use {} bytes. Consider writing layers to separate parts, which can be read independently.",
+						m_bytesDecoded.load(), m_filePath, m_bytesUsed.load()
+					)
+				);
+			}
+		}
+
+		// Read a chunk of data from the file, formatted as a tile batch that will be stored on the tile batch plug.
+		// Only the half-open range of channels specified by `channels` is read.
+		ConstObjectVectorPtr readTileBatch( const Context *c, V3i tileBatchOrigin, V2i channels )
 		{
 			const View& view = lookupView( c );
 
-			const ImageSpec spec = m_imageInput->spec( tileBatchOrigin.z, 0 );
+			ConstObjectVectorPtr result = claimReadAhead( view, tileBatchOrigin, channels );
+			if( !result )
+			{
+				result = readTileBatch( view, tileBatchOrigin, channels );
+			}
 
-			const int tileBatchNumTileChannels = spec.nchannels * view.tileBatchSize.y * view.tileBatchSize.x;
+			scheduleReadAhead( view, tileBatchOrigin, channels );
+			return result;
+		}
+
+		ConstObjectVectorPtr readTileBatch( const View &view, V3i tileBatchOrigin, V2i channels )
+		{
+			ImageSpec spec = m_imageInput->spec( tileBatchOrigin.z, view.mipLevel );
+			if( view.mipLevel )
+			{
+				// OpenEXR stores a single display window for all MIP levels, so
+				// we use the reduced one computed by `initialiseMipLevels()`.
+				spec.full_x = view.imageSpec.full_x;
+				spec.full_y = view.imageSpec.full_y;
+				spec.full_width = view.imageSpec.full_width;
+				spec.full_height = view.imageSpec.full_height;
+			}
+
+			if( spec.deep )
+			{
+				// We need all channels to compute the sample offsets.
+				channels = V2i( 0, spec.nchannels );
+			}
+			else if(
+				channels.y - channels.x < spec.nchannels &&
+				spec.tile_width == 0 && spec.get_string_attribute( "compression", "none" ) != "none" &&
+				!m_warnedPartialSubImageRead.exchange( true )
+			)
+			{
+				// OpenEXR compresses all the channels of a scanline block together, so reading a subset still
+				// requires decompressing all of them. We save the conversion and storage of the unused channels,
+				// but the file would be much more efficient if the layers had been written as separate parts.
+				// Uncompressed files can be read selectively, and tiled files are read a tile at a time, so we
+				// don't warn about those.
+				const size_t channelBytes = spec.channelformats.size() ? spec.channelformats[channels.x].size() : spec.format.size();
+				IECore::msg(
+					IECore::Msg::Warning, "OpenImageIOReader",
+					fmt::format(
+						"Reading {} of {} channels from subimage {} of \"{}\" requires decoding all {} bytes per pixel to use {}. "
+						"Consider writing layers to separate parts, which can be read independently.",
+						channels.y - channels.x, spec.nchannels, tileBatchOrigin.z, m_filePath,
+						spec.pixel_bytes( /* native = */ true ), ( channels.y - channels.x ) * channelBytes
+					)
+				);
+			}
+
+			const int numChannels = channels.y - channels.x;
+			const int tileBatchNumTileChannels = numChannels * view.tileBatchSize.y * view.tileBatchSize.x;
 			const int tileBatchNumTiles = view.tileBatchSize.y * view.tileBatchSize.x;
 
 			ObjectVectorPtr resultChannels = new ObjectVector();
@@ -1064,6 +1305,11 @@ class File
 			);
 			const Box2i fileTargetRegion = flopDisplayWindow( targetRegion, view.imageSpec );
 
+			if( !spec.deep && !BufferAlgo::empty( targetRegion ) )
+			{
+				recordBytesRead( spec, channels, (size_t)targetRegion.size().x * targetRegion.size().y );
+			}
+
 			// It would probably be more efficient if we just did two separate traversals of the input regions,
 			// with the first one setting EXR_DECODE_SAMPLE_DATA_ONLY, rather than decoding everything up front,
 			// and having to hold it in memory while we compute our sample offsets before we can actually use it.
@@ -1102,7 +1348,7 @@ class File
 
 				std::vector<float> buffer;
 				processFileRegionScanline(
-					spec, tileBatchOrigin, fileTargetRegion, buffer,
+					spec, tileBatchOrigin, view.mipLevel, channels, fileTargetRegion, buffer,
 					view.tileBatchSize, tileChannelPointers, tileDataWindows,
 					deepRectsData.size() ? &deepRectsData[0] : nullptr,
 					deepRects.size() ? &deepRects[0] : nullptr, tileOffsetPointers
@@ -1165,7 +1411,7 @@ class File
 							);
 
 							processFileRegionScanline(
-								spec, tileBatchOrigin, batchRect, buffer,
+								spec, tileBatchOrigin, view.mipLevel, channels, batchRect, buffer,
 								view.tileBatchSize, tileChannelPointers, tileDataWindows,
 								deepRectsData.size() ? &deepRectsData[i] : nullptr,
 								deepRects.size() ? &deepRects[i] : nullptr, tileOffsetPointers
@@ -1190,7 +1436,7 @@ class File
 
 				std::vector<float> buffer;
 				processFileRegionTiled(
-					spec, tileBatchOrigin, BufferAlgo::intersection( fileTileRegion, fileDataWindow ), buffer,
+					spec, tileBatchOrigin, view.mipLevel, channels, BufferAlgo::intersection( fileTileRegion, fileDataWindow ), buffer,
 					view.tileBatchSize, tileChannelPointers, tileDataWindows,
 					deepRectsData.size() ? &deepRectsData[0] : nullptr,
 					deepRects.size() ? &deepRects[0] : nullptr, tileOffsetPointers
@@ -1229,7 +1475,7 @@ class File
 							) );
 
 							processFileRegionTiled(
-								spec, tileBatchOrigin, batchRect, buffer,
+								spec, tileBatchOrigin, view.mipLevel, channels, batchRect, buffer,
 								view.tileBatchSize, tileChannelPointers, tileDataWindows,
 								deepRectsData.size() ? &deepRectsData[i] : nullptr,
 								deepRects.size() ? &deepRects[i] : nullptr, tileOffsetPointers
@@ -1312,9 +1558,10 @@ class File
 		}
 
 		// Given a channelName and tileOrigin, return the information necessary to look up the data for this tile.
-		// The tileBatchOrigin is used to find a tileBatch, and then the tileBatchSubIndex tells you the index
-		// within that tile to use
-		void findTile( const Context *c, const std::string &channelName, const Imath::V2i &tileOrigin, V3i &batchOrigin, int &batchSubIndex ) const
+		// The tileBatchOrigin and batchChannels are used to find a tileBatch, and then the tileBatchSubIndex tells
+		// you the index within that tile to use. If `readLayersSeparately` is true, the tile batch will contain
+		// only the channels from the same layer, otherwise it contains all the channels of the subimage.
+		void findTile( const Context *c, const std::string &channelName, const Imath::V2i &tileOrigin, bool readLayersSeparately, V3i &batchOrigin, V2i &batchChannels, int &batchSubIndex ) const
 		{
 			const View& view = lookupView( c );
 			if( !channelName.size() )
@@ -1322,6 +1569,7 @@ class File
 				// For computing sample offsets
 				// This is a bit of a weird interface, I should probably fix it
 				batchOrigin = tileBatchOrigin( view, view.firstSubImage, tileOrigin );
+				batchChannels = V2i( 0, view.imageSpec.nchannels );
 				batchSubIndex = tileBatchSubIndex( view, 0, tileOrigin - V2i( batchOrigin.x, batchOrigin.y ) );
 			}
 			else
@@ -1333,12 +1581,15 @@ class File
 				}
 				ChannelMapEntry channelMapEntry = findIt->second;
 				batchOrigin = tileBatchOrigin( view, channelMapEntry.subImage, tileOrigin );
-				batchSubIndex = tileBatchSubIndex( view, channelMapEntry.channelIndex, tileOrigin - V2i( batchOrigin.x, batchOrigin.y ) );
+				// Deep tile batches always contain all channels, since they are needed
+				// to compute sample offsets.
+				batchChannels = readLayersSeparately && !view.imageSpec.deep ? channelMapEntry.layerChannels : channelMapEntry.subImageChannels;
+				batchSubIndex = tileBatchSubIndex( view, channelMapEntry.channelIndex - batchChannels.x, tileOrigin - V2i( batchOrigin.x, batchOrigin.y ) );
 			}
 		}
 
 		void processFileRegionScanline(
-			const ImageSpec &spec, const V3i &tileBatchOrigin, const Box2i &regionRect, std::vector<float> &buffer,
+			const ImageSpec &spec, const V3i &tileBatchOrigin, int mipLevel, const V2i &channels, const Box2i &regionRect, std::vector<float> &buffer,
 			const V2i &tileBatchSize, std::vector< float* > &tileChannelPointers,
 			const std::vector< Box2i > &tileDataWindows,
 			OIIO::DeepData *deepRectData, Box2i *deepRect, std::vector< int* > &tileOffsetPointers
@@ -1348,14 +1599,15 @@ class File
 
 			if( !spec.deep )
 			{
+				const int numChannels = channels.y - channels.x;
 				podVectorResizeUninitialized<float>(
-					buffer, spec.nchannels * regionRect.size().x * regionRect.size().y
+					buffer, numChannels * regionRect.size().x * regionRect.size().y
 				);
 
 				// Tell OIIO to do the actual read/decompress to the temp buffer
 				if( !m_imageInput->read_scanlines(
-					tileBatchOrigin.z, 0,
-					regionRect.min.y, regionRect.max.y, 0, 0, spec.nchannels, TypeDesc::FLOAT, &buffer[0]
+					tileBatchOrigin.z, mipLevel,
+					regionRect.min.y, regionRect.max.y, 0, channels.x, channels.y, TypeDesc::FLOAT, &buffer[0]
 				) )
 				{
 					handleOIIOError( "Failed to read scanlines", gafferRegionRect );
@@ -1363,7 +1615,7 @@ class File
 
 				// Copy the data from the temp buffer to whatever tiles it belongs in
 				blitOIIORectToTileBatch(
-					spec.nchannels, &buffer[0], gafferRegionRect,
+					numChannels, &buffer[0], gafferRegionRect,
 					tileBatchSize, tileBatchOrigin, tileChannelPointers,
 					tileDataWindows
 				);
@@ -1394,7 +1646,7 @@ class File
 		}
 
 		void processFileRegionTiled(
-			const ImageSpec &spec, const V3i &tileBatchOrigin, const Box2i &regionRect, std::vector<float> &buffer,
+			const ImageSpec &spec, const V3i &tileBatchOrigin, int mipLevel, const V2i &channels, const Box2i &regionRect, std::vector<float> &buffer,
 			const V2i &tileBatchSize, std::vector< float* > &tileChannelPointers,
 			const std::vector< Box2i > &tileDataWindows,
 			OIIO::DeepData *deepRectData, Box2i *deepRect, std::vector< int* > &tileOffsetPointers
@@ -1404,15 +1656,16 @@ class File
 
 			if( !spec.deep )
 			{
+				const int numChannels = channels.y - channels.x;
 				podVectorResizeUninitialized<float>(
-					buffer, spec.nchannels * regionRect.size().x * regionRect.size().y
+					buffer, numChannels * regionRect.size().x * regionRect.size().y
 				);
 
 				// Tell OIIO to do the actual read/decompress to the temp buffer
 				if( ! m_imageInput->read_tiles(
-					tileBatchOrigin.z, 0,
+					tileBatchOrigin.z, mipLevel,
 					regionRect.min.x, regionRect.max.x, regionRect.min.y, regionRect.max.y,
-					0, 1, 0, spec.nchannels, TypeDesc::FLOAT, &buffer[0]
+					0, 1, channels.x, channels.y, TypeDesc::FLOAT, &buffer[0]
 				) )
 				{
 					handleOIIOError( "Failed to read tiles", gafferRegionRect );
@@ -1420,7 +1673,7 @@ class File
 
 				// Copy the data from the temp buffer to whatever tiles it belongs in
 				blitOIIORectToTileBatch(
-					spec.nchannels, &buffer[0], gafferRegionRect,
+					numChannels, &buffer[0], gafferRegionRect,
 					tileBatchSize, tileBatchOrigin, tileChannelPointers,
 					tileDataWindows
 				);
@@ -1451,9 +1704,18 @@ class File
 			}
 		}
 
-		const ImageSpec &imageSpec( const Context *c ) const
+		// Returns the spec for the view specified by the context. If `useProxyLevel` is true,
+		// the spec is for the MIP level requested by `ImageReader::proxyLevelContextName`.
+		const ImageSpec &imageSpec( const Context *c, bool useProxyLevel = true ) const
 		{
-			return lookupView( c ).imageSpec;
+			return lookupView( c, useProxyLevel ).imageSpec;
+		}
+
+		// Returns the MIP level that will actually be read for the proxy level requested
+		// by the context, taking into account the levels available in the file.
+		int mipLevel( const Context *c ) const
+		{
+			return lookupView( c ).mipLevel;
 		}
 
 		std::string formatName() const
@@ -1478,6 +1740,240 @@ class File
 
 	private:
 
+		using ReadAheadKey = std::tuple<const View *, int, int, int, int, int>;
+
+		static ReadAheadKey readAheadKey( const View &view, const V3i &tileBatchOrigin, const V2i &channels )
+		{
+			return ReadAheadKey( &view, tileBatchOrigin.x, tileBatchOrigin.y, tileBatchOrigin.z, channels.x, channels.y );
+		}
+
+		enum class ReadAheadState
+		{
+			Queued,
+			Reading,
+			Ready
+		};
+
+		// Allows computes that need a batch which is currently being read
+		// ahead to wait for it by participating in TBB tasks, rather than by
+		// blocking. This is the same approach taken by `TaskMutex`.
+		struct ReadAheadExecution
+		{
+			tbb::task_arena arena;
+			tbb::task_group taskGroup;
+		};
+
+		struct ReadAheadEntry
+		{
+			ReadAheadState state = ReadAheadState::Queued;
+			// Valid while `state == Reading`.
+			std::shared_ptr<ReadAheadExecution> execution;
+			ConstObjectVectorPtr tileBatch;
+			// Order in which entries were scheduled, used to
+			// discard the oldest entries first.
+			uint64_t sequence = 0;
+		};
+
+		// Returns the result of a previous read-ahead of this batch, waiting for the read to
+		// complete if it is already in progress. Returns null if there is no read-ahead to use,
+		// in which case the caller is responsible for reading the batch itself.
+		ConstObjectVectorPtr claimReadAhead( const View &view, const V3i &tileBatchOrigin, const V2i &channels )
+		{
+			const ReadAheadKey key = readAheadKey( view, tileBatchOrigin, channels );
+
+			std::unique_lock<std::mutex> lock( m_readAheadMutex );
+			if( m_batchesRead.insert( key ).second )
+			{
+				m_batchesReadOrder.push_back( key );
+				if( m_batchesReadOrder.size() > g_maxRecentBatches )
+				{
+					m_batchesRead.erase( m_batchesReadOrder.front() );
+					m_batchesReadOrder.pop_front();
+				}
+			}
+
+			auto it = m_readAhead.find( key );
+			if( it == m_readAhead.end() )
+			{
+				return nullptr;
+			}
+
+			while( it->second.state == ReadAheadState::Reading )
+			{
+				// The read task is guaranteed to be in the task group by the
+				// time the entry is `Reading`, and it updates the entry before
+				// completing. So once `wait()` returns, the read is done.
+				std::shared_ptr<ReadAheadExecution> execution = it->second.execution;
+				lock.unlock();
+				execution->arena.execute( [&execution] { execution->taskGroup.wait(); } );
+				lock.lock();
+
+				it = m_readAhead.find( key );
+				if( it == m_readAhead.end() )
+				{
+					// The read-ahead failed.
+					return nullptr;
+				}
+			}
+
+			// If the read is still queued, we remove it so that the pool
+			// skips it, and the caller reads the batch instead.
+			ConstObjectVectorPtr result = it->second.tileBatch;
+			m_readAhead.erase( it );
+			if( result )
+			{
+				g_readAheadClaimCount++;
+			}
+			return result;
+		}
+
+		// Makes room for a new read-ahead by discarding the oldest entry that
+		// isn't currently being read. Returns false if all entries are being
+		// read. Must be called with `m_readAheadMutex` locked.
+		bool discardOldestReadAhead()
+		{
+			auto oldest = m_readAhead.end();
+			for( auto it = m_readAhead.begin(); it != m_readAhead.end(); ++it )
+			{
+				if( it->second.state != ReadAheadState::Reading && ( oldest == m_readAhead.end() || it->second.sequence < oldest->second.sequence ) )
+				{
+					oldest = it;
+				}
+			}
+
+			if( oldest == m_readAhead.end() )
+			{
+				return false;
+			}
+
+			// If the entry is still queued, the pool will find it missing
+			// and skip it.
+			m_readAhead.erase( oldest );
+			return true;
+		}
+
+		void scheduleReadAhead( const View &view, const V3i &tileBatchOrigin, const V2i &channels )
+		{
+			ReadAheadPool &pool = ReadAheadPool::instance();
+			if( !pool.getNumThreads() )
+			{
+				return;
+			}
+
+			// Scanline batches are full width, so the neighbours are the batches above
+			// and below. For tiled images we read along the row.
+			const V2i step = view.tiled ? V2i( view.tileBatchSize.x * ImagePlug::tileSize(), 0 ) : V2i( 0, ImagePlug::tileSize() );
+
+			const V2i fileDataOrigin( view.imageSpec.x, view.imageSpec.y );
+			const Box2i gafferDataWindow = flopDisplayWindow(
+				Box2i( fileDataOrigin, fileDataOrigin + V2i( view.imageSpec.width, view.imageSpec.height ) ),
+				view.imageSpec
+			);
+
+			for( int direction : { 1, -1 } )
+			{
+				const V3i neighbour = tileBatchOrigin + V3i( step.x * direction, step.y * direction, 0 );
+				const V2i neighbourXY( neighbour.x, neighbour.y );
+				if( !BufferAlgo::intersects( gafferDataWindow, Box2i( neighbourXY, neighbourXY + view.tileBatchSize * ImagePlug::tileSize() ) ) )
+				{
+					continue;
+				}
+
+				const ReadAheadKey key = readAheadKey( view, neighbour, channels );
+				{
+					std::lock_guard<std::mutex> lock( m_readAheadMutex );
+					if( m_batchesRead.count( key ) || m_readAhead.count( key ) )
+					{
+						continue;
+					}
+					if( m_readAhead.size() >= g_maxReadAheadBatches && !discardOldestReadAhead() )
+					{
+						continue;
+					}
+					m_readAhead[key].sequence = m_readAheadSequence++;
+				}
+
+				const bool queued = pool.enqueue(
+					[file = shared_from_this(), view = &view, neighbour, channels] {
+						file->readAhead( *view, neighbour, channels );
+					}
+				);
+
+				if( !queued )
+				{
+					std::lock_guard<std::mutex> lock( m_readAheadMutex );
+					m_readAhead.erase( key );
+				}
+			}
+		}
+
+		// Called on a ReadAheadPool thread.
+		void readAhead( const View &view, const V3i &tileBatchOrigin, const V2i &channels )
+		{
+			const ReadAheadKey key = readAheadKey( view, tileBatchOrigin, channels );
+			std::shared_ptr<ReadAheadExecution> execution;
+			{
+				std::lock_guard<std::mutex> lock( m_readAheadMutex );
+				auto it = m_readAhead.find( key );
+				if( it == m_readAhead.end() || it->second.state != ReadAheadState::Queued )
+				{
+					// Claimed by a compute before we got to it.
+					return;
+				}
+				it->second.state = ReadAheadState::Reading;
+				execution = std::make_shared<ReadAheadExecution>();
+				it->second.execution = execution;
+				// Spawn the read while holding the lock, so that any compute that
+				// sees the `Reading` state will find the task in the group.
+				execution->arena.execute(
+					[&] {
+						execution->taskGroup.run(
+							[this, &view, tileBatchOrigin, channels] {
+								readAheadTask( view, tileBatchOrigin, channels );
+							}
+						);
+					}
+				);
+			}
+
+			// Perform the read ourselves, unless a waiting compute has already
+			// taken the task.
+			execution->arena.execute( [&execution] { execution->taskGroup.wait(); } );
+		}
+
+		void readAheadTask( const View &view, const V3i &tileBatchOrigin, const V2i &channels )
+		{
+			const ReadAheadKey key = readAheadKey( view, tileBatchOrigin, channels );
+
+			ConstObjectVectorPtr tileBatch;
+			try
+			{
+				tileBatch = readTileBatch( view, tileBatchOrigin, channels );
+			}
+			catch( ... )
+			{
+				// Errors will be reported when the batch is read by
+				// a compute, so there is nothing more to do here.
+			}
+
+			{
+				// Entries are never removed while `Reading`, so this lookup
+				// is guaranteed to succeed.
+				std::lock_guard<std::mutex> lock( m_readAheadMutex );
+				auto it = m_readAhead.find( key );
+				if( tileBatch )
+				{
+					it->second.state = ReadAheadState::Ready;
+					it->second.execution.reset();
+					it->second.tileBatch = tileBatch;
+				}
+				else
+				{
+					m_readAhead.erase( it );
+				}
+			}
+		}
+
 		struct View
 		{
 			View( const ImageSpec &spec, int firstSubImage ) :
@@ -1497,6 +1993,11 @@ class File
 			std::vector< std::string > &channelNames;
 			std::map<std::string, ChannelMapEntry> channelMap;
 			int firstSubImage;
+			// The MIP level this view reads from, and views for the lower resolution
+			// levels, starting with level 1. These are only populated for the full
+			// resolution view.
+			int mipLevel = 0;
+			std::vector<std::unique_ptr<View>> mipLevels;
 
 		private:
 
@@ -1553,7 +2054,21 @@ class File
 			return channelIndex * tilePlaneSize + subXY.y * view.tileBatchSize.x + subXY.x;
 		}
 
-		inline const View &lookupView( const Context *c ) const
+		inline const View &lookupView( const Context *c, bool useProxyLevel = true ) const
+		{
+			const View &view = lookupFullResolutionView( c );
+			if( useProxyLevel && view.mipLevels.size() )
+			{
+				const int level = std::min( c->get<int>( ImageReader::proxyLevelContextName, 0 ), (int)view.mipLevels.size() );
+				if( level > 0 )
+				{
+					return *view.mipLevels[level-1];
+				}
+			}
+			return view;
+		}
+
+		inline const View &lookupFullResolutionView( const Context *c ) const
 		{
 			std::string viewName = c->get<std::string>( ImagePlug::viewNameContextName, ImagePlug::defaultViewName );
 			try
@@ -1574,6 +2089,68 @@ class File
 			throw IECore::Exception( "OpenImageIOReader : Error in downstream node - incorrect request for invalid view \"" + viewName + "\"" );
 		}
 
+		// Adds a view for each MIP level that is available in all the subimages used by `view`.
+		// OpenEXR stores a single data window and display window for all levels, so we only
+		// support images where these match, allowing us to reduce them both consistently.
+		void initialiseMipLevels( View &view )
+		{
+			const ImageSpec &spec = view.imageSpec;
+			if(
+				spec.deep ||
+				spec.x != spec.full_x || spec.y != spec.full_y ||
+				spec.width != spec.full_width || spec.height != spec.full_height
+			)
+			{
+				return;
+			}
+
+			std::set<int> subImages = { view.firstSubImage };
+			for( const auto &[channelName, entry] : view.channelMap )
+			{
+				subImages.insert( entry.subImage );
+			}
+
+			for( int subImage : subImages )
+			{
+				const ImageSpec subImageSpec = m_imageInput->spec( subImage, 0 );
+				if( subImageSpec.x != spec.x || subImageSpec.y != spec.y || subImageSpec.width != spec.width || subImageSpec.height != spec.height )
+				{
+					return;
+				}
+			}
+
+			const float pixelAspect = spec.get_float_attribute( "PixelAspectRatio", 1.0f );
+			for( int level = 1; ; ++level )
+			{
+				ImageSpec levelSpec = m_imageInput->spec( view.firstSubImage, level );
+				if( levelSpec.format == TypeUnknown )
+				{
+					return;
+				}
+
+				for( int subImage : subImages )
+				{
+					const ImageSpec subImageSpec = m_imageInput->spec( subImage, level );
+					if( subImageSpec.format == TypeUnknown || subImageSpec.width != levelSpec.width || subImageSpec.height != levelSpec.height )
+					{
+						return;
+					}
+				}
+
+				levelSpec.full_x = levelSpec.x;
+				levelSpec.full_y = levelSpec.y;
+				levelSpec.full_width = levelSpec.width;
+				levelSpec.full_height = levelSpec.height;
+				levelSpec.attribute( "PixelAspectRatio", pixelAspect );
+
+				auto levelView = std::make_unique<View>( levelSpec, view.firstSubImage );
+				levelView->mipLevel = level;
+				levelView->channelMap = view.channelMap;
+				levelView->channelNames = view.channelNames;
+				view.mipLevels.push_back( std::move( levelView ) );
+			}
+		}
+
 		void handleOIIOError( const std::string &description, const Box2i &bound )
 		{
 			std::string error;
@@ -1600,10 +2177,46 @@ class File
 			);
 		}
 
+		// Records the bytes decoded and used by a read of `numPixels` pixels
+		// from a flat image. These are reported when the file is closed.
+		void recordBytesRead( const ImageSpec &spec, const V2i &channels, size_t numPixels )
+		{
+			size_t bytesPerPixelUsed = 0;
+			for( int c = channels.x; c < channels.y; ++c )
+			{
+				bytesPerPixelUsed += spec.channelformats.size() ? spec.channelformats[c].size() : spec.format.size();
+			}
+
+			// See the warning in `readTileBatch()` for the cases where we must
+			// decode all channels.
+			const bool decodesAllChannels =
+				channels.y - channels.x < spec.nchannels &&
+				spec.tile_width == 0 && spec.get_string_attribute( "compression", "none" ) != "none"
+			;
+			const size_t bytesPerPixelDecoded = decodesAllChannels ? spec.pixel_bytes( /* native = */ true ) : bytesPerPixelUsed;
+
+			m_bytesUsed += bytesPerPixelUsed * numPixels;
+			m_bytesDecoded += bytesPerPixelDecoded * numPixels;
+		}
+
 		std::unique_ptr<ImageInput> m_imageInput;
 		std::string m_filePath;
 		StringVectorDataPtr m_viewNamesData;
 		std::map<std::string, std::unique_ptr< View > > m_views;
+
+		std::mutex m_readAheadMutex;
+		std::map<ReadAheadKey, ReadAheadEntry> m_readAhead;
+		uint64_t m_readAheadSequence = 0;
+		// Batches that have recently been requested by a compute. We don't read
+		// these ahead, since they are likely to still be in the compute cache.
+		// `m_batchesReadOrder` records insertion order so that we can bound
+		// the size of the set.
+		std::set<ReadAheadKey> m_batchesRead;
+		std::deque<ReadAheadKey> m_batchesReadOrder;
+
+		std::atomic_bool m_warnedPartialSubImageRead{ false };
+		std::atomic<uint64_t> m_bytesDecoded{ 0 };
+		std::atomic<uint64_t> m_bytesUsed{ 0 };
 };
 
 using FilePtr = std::shared_ptr<File>;
@@ -1703,6 +2316,7 @@ OpenImageIOReader::OpenImageIOReader( const std::string &name )
 	addChild( new IntVectorDataPlug( "availableFrames", Plug::Out, new IntVectorData ) );
 	addChild( new BoolPlug( "fileValid", Plug::Out ) );
 	addChild( new IntPlug( "channelInterpretation", Plug::In, (int)ImageReader::ChannelInterpretation::Default, /* min */ (int)ImageReader::ChannelInterpretation::Legacy, /* max */ (int)ImageReader::ChannelInterpretation::Specification ) );
+	addChild( new BoolPlug( "readLayersSeparately" ) );
 	addChild( new ObjectVectorPlug( "__tileBatch", Plug::Out, new ObjectVector ) );
 
 	plugSetSignal().connect( boost::bind( &OpenImageIOReader::plugSet, this, ::_1 ) );
@@ -1772,14 +2386,24 @@ const Gaffer::IntPlug *OpenImageIOReader::channelInterpretationPlug() const
 	return getChild<IntPlug>( g_firstPlugIndex + 5 );
 }
 
+Gaffer::BoolPlug *OpenImageIOReader::readLayersSeparatelyPlug()
+{
+	return getChild<BoolPlug>( g_firstPlugIndex + 6 );
+}
+
+const Gaffer::BoolPlug *OpenImageIOReader::readLayersSeparatelyPlug() const
+{
+	return getChild<BoolPlug>( g_firstPlugIndex + 6 );
+}
+
 Gaffer::ObjectVectorPlug *OpenImageIOReader::tileBatchPlug()
 {
-	return getChild<ObjectVectorPlug>( g_firstPlugIndex + 6 );
+	return getChild<ObjectVectorPlug>( g_firstPlugIndex + 7 );
 }
 
 const Gaffer::ObjectVectorPlug *OpenImageIOReader::tileBatchPlug() const
 {
-	return getChild<ObjectVectorPlug>( g_firstPlugIndex + 6 );
+	return getChild<ObjectVectorPlug>( g_firstPlugIndex + 7 );
 }
 
 void OpenImageIOReader::setOpenFilesLimit( size_t maxOpenFiles )
@@ -1792,6 +2416,32 @@ size_t OpenImageIOReader::getOpenFilesLimit()
 	return fileCache()->getMaxCost();
 }
 
+void OpenImageIOReader::setReadAheadThreads( size_t numThreads )
+{
+	ReadAheadPool::instance().setNumThreads( numThreads );
+}
+
+size_t OpenImageIOReader::getReadAheadThreads()
+{
+	return ReadAheadPool::instance().getNumThreads();
+}
+
+
+uint64_t GafferImage::Private::ReadAhead::claimCount()
+{
+	return g_readAheadClaimCount;
+}
+
+void GafferImage::Private::ReadAhead::resetClaimCount()
+{
+	g_readAheadClaimCount = 0;
+}
+
+void GafferImage::Private::ReadAhead::waitForIdle()
+{
+	ReadAheadPool::instance().waitForIdle();
+}
+
 size_t OpenImageIOReader::supportedExtensions( std::vector<std::string> &extensions )
 {
 	std::string attr;
@@ -1863,10 +2513,13 @@ void OpenImageIOReader::hash( const ValuePlug *output, const Context *context, I
 	else if( output == tileBatchPlug() )
 	{
 		h.append( context->get<V3i>( g_tileBatchOriginContextName ) );
+		h.append( context->get<V2i>( g_tileBatchChannelsContextName ) );
 		h.append( context->get<std::string>( ImagePlug::viewNameContextName, ImagePlug::defaultViewName ) );
+		h.append( context->get<int>( ImageReader::proxyLevelContextName, 0 ) );
 
 		Gaffer::Context::EditableScope c( context );
 		c.remove( g_tileBatchOriginContextName );
+		c.remove( g_tileBatchChannelsContextName );
 
 		hashFileName( c.context(), h );
 		refreshCountPlug()->hash( h );
@@ -1928,9 +2581,11 @@ void OpenImageIOReader::compute( ValuePlug *output, const Context *context ) con
 	else if( output == tileBatchPlug() )
 	{
 		V3i tileBatchOrigin = context->get<V3i>( g_tileBatchOriginContextName );
+		V2i tileBatchChannels = context->get<V2i>( g_tileBatchChannelsContextName );
 
 		Gaffer::Context::EditableScope c( context );
 		c.remove( g_tileBatchOriginContextName );
+		c.remove( g_tileBatchChannelsContextName );
 
 		FilePtr file = std::static_pointer_cast<File>( retrieveFile( c.context() ) );
 
@@ -1940,7 +2595,7 @@ void OpenImageIOReader::compute( ValuePlug *output, const Context *context ) con
 		}
 
 		static_cast<ObjectVectorPlug *>( output )->setValue(
-			file->readTileBatch( context, tileBatchOrigin )
+			file->readTileBatch( context, tileBatchOrigin, tileBatchChannels )
 		);
 	}
 	else
@@ -2010,6 +2665,7 @@ void OpenImageIOReader::hashFormat( const GafferImage::ImagePlug *output, const
 	h.append( format.getDisplayWindow() );
 	h.append( format.getPixelAspect() );
 	h.append( context->get<std::string>( ImagePlug::viewNameContextName, ImagePlug::defaultViewName ) );
+	h.append( proxyLevel( context, /* holdForBlack = */ true ) );
 }
 
 GafferImage::Format OpenImageIOReader::computeFormat( const Gaffer::Context *context, const ImagePlug *parent ) const
@@ -2039,6 +2695,7 @@ void OpenImageIOReader::hashDataWindow( const GafferImage::ImagePlug *output, co
 	refreshCountPlug()->hash( h );
 	missingFrameModePlug()->hash( h );
 	h.append( context->get<std::string>( ImagePlug::viewNameContextName, ImagePlug::defaultViewName ) );
+	h.append( proxyLevel( context ) );
 }
 
 Imath::Box2i OpenImageIOReader::computeDataWindow( const Gaffer::Context *context, const ImagePlug *parent ) const
@@ -2075,7 +2732,7 @@ IECore::ConstCompoundDataPtr OpenImageIOReader::computeMetadata( const Gaffer::C
 		result->writable()["fileValid"] = new BoolData( false );
 		return result;
 	}
-	const ImageSpec &spec = file->imageSpec( context );
+	const ImageSpec &spec = file->imageSpec( context, /* useProxyLevel = */ false );
 
 	// Add data type
 
@@ -2208,11 +2865,13 @@ IECore::ConstIntVectorDataPtr OpenImageIOReader::computeSampleOffsets( const Ima
 		}
 
 		V3i tileBatchOrigin;
+		V2i tileBatchChannels;
 		int subIndex;
 		std::string channelName(""); // TODO - should have better interface for selecting sampleOffsets
-		file->findTile( context, channelName, tileOrigin, tileBatchOrigin, subIndex );
+		file->findTile( context, channelName, tileOrigin, /* readLayersSeparately = */ false, tileBatchOrigin, tileBatchChannels, subIndex );
 
 		c.set( g_tileBatchOriginContextName, &tileBatchOrigin );
+		c.set( g_tileBatchChannelsContextName, &tileBatchChannels );
 
 		ConstObjectVectorPtr tileBatch = tileBatchPlug()->getValue();
 
@@ -2234,6 +2893,7 @@ void OpenImageIOReader::hashChannelData( const GafferImage::ImagePlug *output, c
 		refreshCountPlug()->hash( h );
 		missingFrameModePlug()->hash( h );
 		channelInterpretationPlug()->hash( h );
+		h.append( proxyLevel( context ) );
 	}
 }
 
@@ -2260,11 +2920,22 @@ IECore::ConstFloatVectorDataPtr OpenImageIOReader::computeChannelData( const std
 		);
 	}
 
+	// The choice of tile batch doesn't affect the result, so `readLayersSeparatelyPlug()`
+	// is deliberately omitted from `hashChannelData()`.
+	const bool readLayersSeparately = readLayersSeparatelyPlug()->getValue();
+
 	V3i tileBatchOrigin;
+	V2i tileBatchChannels;
 	int subIndex;
-	file->findTile( context, channelName, tileOrigin, tileBatchOrigin, subIndex );
+	file->findTile( context, channelName, tileOrigin, readLayersSeparately, tileBatchOrigin, tileBatchChannels, subIndex );
+
+	// Requests for levels beyond those in the file are clamped, so we pass on the level
+	// actually used, so that all such requests share the same tile batches.
+	const int mipLevel = file->mipLevel( context );
 
 	c.set( g_tileBatchOriginContextName, &tileBatchOrigin );
+	c.set( g_tileBatchChannelsContextName, &tileBatchChannels );
+	c.set( ImageReader::proxyLevelContextName, &mipLevel );
 
 	ConstObjectVectorPtr tileBatch = tileBatchPlug()->getValue();
 	ConstObjectPtr curTileChannel = IECore::runTimeCast< const ObjectVector >(
@@ -2284,6 +2955,18 @@ void OpenImageIOReader::plugSet( Gaffer::Plug *plug )
 	}
 }
 
+int OpenImageIOReader::proxyLevel( const Gaffer::Context *context, bool holdForBlack ) const
+{
+	if( context->get<int>( ImageReader::proxyLevelContextName, 0 ) <= 0 )
+	{
+		// Avoid retrieving the file in the common case.
+		return 0;
+	}
+
+	FilePtr file = std::static_pointer_cast<File>( retrieveFile( context, holdForBlack ) );
+	return file ? file->mipLevel( context ) : 0;
+}
+
 // Returns the file handle container for the current context, by evaluating the appropriate plugs.
 // Throws if the file is invalid, and returns null if the filename is empty.
 std::shared_ptr<void> OpenImageIOReader::retrieveFile( const Context *context, bool holdForBlack ) const
@@ -134,6 +134,10 @@ void GafferImageModule::bindIO()
 			.staticmethod( "setOpenFilesLimit" )
 			.def( "getOpenFilesLimit", &OpenImageIOReader::getOpenFilesLimit )
 			.staticmethod( "getOpenFilesLimit" )
+			.def( "setReadAheadThreads", &OpenImageIOReader::setReadAheadThreads )
+			.staticmethod( "setReadAheadThreads" )
+			.def( "getReadAheadThreads", &OpenImageIOReader::getReadAheadThreads )
+			.staticmethod( "getReadAheadThreads" )
 			.def( "supportedExtensions", &supportedExtensions<OpenImageIOReader> )
 			.staticmethod( "supportedExtensions" )
 		;
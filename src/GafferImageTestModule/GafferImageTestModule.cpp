@@ -45,6 +45,7 @@
 #include "GafferImage/ImagePlug.h"
 #include "GafferImage/Format.h"
 #include "GafferImage/Sampler.h"
+#include "GafferImage/Private/ReadAhead.h"
 
 #include "Gaffer/Node.h"
 
@@ -158,6 +159,12 @@ void validateVisitPixels( GafferImage::Sampler &sampler, const Imath::Box2i &reg
 	}
 }
 
+void waitForReadAheads()
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	GafferImage::Private::ReadAhead::waitForIdle();
+}
+
 } // namespace
 
 BOOST_PYTHON_MODULE( _GafferImageTest )
@@ -170,4 +177,7 @@ BOOST_PYTHON_MODULE( _GafferImageTest )
 	def( "connectProcessTilesToPlugDirtiedSignal", &connectProcessTilesToPlugDirtiedSignal );
 	def( "testEditableScopeForFormat", &testEditableScopeForFormat );
 	def( "validateVisitPixels", &validateVisitPixels );
+	def( "readAheadClaimCount", &GafferImage::Private::ReadAhead::claimCount );
+	def( "resetReadAheadClaimCount", &GafferImage::Private::ReadAhead::resetClaimCount );
+	def( "waitForReadAheads", &waitForReadAheads );
 }
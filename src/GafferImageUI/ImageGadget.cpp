@@ -38,6 +38,7 @@
 
 #include "GafferImage/ImageAlgo.h"
 #include "GafferImage/ImagePlug.h"
+#include "GafferImage/ImageReader.h"
 #include "GafferImage/OpenColorIOTransform.h"
 
 #include "GafferUI/Style.h"
@@ -65,6 +66,8 @@
 #include "boost/bind/bind.hpp"
 #include "boost/lexical_cast.hpp"
 
+#include "tbb/task_arena.h"
+
 #include <regex>
 
 using namespace std;
@@ -855,7 +858,15 @@ ImageGadget::ImageGadget()
 		m_labelsVisible( true ),
 		m_paused( false ),
 		m_wipeEnabled( false ),
+		m_maxProxyLevel( 0 ),
+		m_proxyLevel( 0 ),
+		m_proxyScale( 1 ),
+		m_proxyOffset( 0 ),
 		m_dirtyFlags( AllDirty ),
+		m_prefetchFrames( 0 ),
+		m_prefetchMemoryLimit( 1024 * 1024 * 1024 ),
+		m_prefetchFrameStep( 1.0f ),
+		m_previousFrame( 0.0f ),
 		m_renderRequestPending( false ),
 		m_blendMode( BlendMode::Over ),
 		m_highlightID( 0 ),
@@ -912,6 +923,7 @@ void ImageGadget::setContext( Gaffer::ConstContextPtr context )
 	}
 
 	m_context = context;
+	m_previousFrame = m_context->getFrame();
 	m_contextChangedConnection = const_cast<Context *>( m_context.get() )->changedSignal().connect(
 		boost::bind( &ImageGadget::contextChanged, this, ::_2 )
 	);
@@ -1120,6 +1132,44 @@ float ImageGadget::getWipeAngle() const
 	return m_wipeAngle;
 }
 
+void ImageGadget::setMaxProxyLevel( int maxProxyLevel )
+{
+	maxProxyLevel = std::max( maxProxyLevel, 0 );
+	if( maxProxyLevel == m_maxProxyLevel )
+	{
+		return;
+	}
+
+	m_maxProxyLevel = maxProxyLevel;
+	// The proxy level itself is updated on the next render.
+	Gadget::dirty( DirtyType::Render );
+}
+
+int ImageGadget::getMaxProxyLevel() const
+{
+	return m_maxProxyLevel;
+}
+
+void ImageGadget::setPrefetchFrames( int prefetchFrames )
+{
+	m_prefetchFrames = std::max( prefetchFrames, 0 );
+}
+
+int ImageGadget::getPrefetchFrames() const
+{
+	return m_prefetchFrames;
+}
+
+void ImageGadget::setPrefetchMemoryLimit( size_t prefetchMemoryLimit )
+{
+	m_prefetchMemoryLimit = prefetchMemoryLimit;
+}
+
+size_t ImageGadget::getPrefetchMemoryLimit() const
+{
+	return m_prefetchMemoryLimit;
+}
+
 void ImageGadget::setSelectedIDs( const std::vector<uint32_t> &ids )
 {
 	m_selectedIDs = ids;
@@ -1170,7 +1220,9 @@ void ImageGadget::plugDirtied( const Gaffer::Plug *plug )
 {
 	if( plug == m_image->formatPlug() )
 	{
-		dirty( FormatDirty );
+		// The data window depends on the format when
+		// mapping from proxy coordinates.
+		dirty( FormatDirty | DataWindowDirty );
 	}
 	else if( plug == m_image->dataWindowPlug() )
 	{
@@ -1188,6 +1240,15 @@ void ImageGadget::plugDirtied( const Gaffer::Plug *plug )
 
 void ImageGadget::contextChanged( const IECore::InternedString &name )
 {
+	// Track the direction of playback, so that we know
+	// which frames to prefetch.
+	const float frame = m_context->getFrame();
+	if( frame != m_previousFrame )
+	{
+		m_prefetchFrameStep = frame > m_previousFrame ? 1.0f : -1.0f;
+		m_previousFrame = frame;
+	}
+
 	dirty( AllDirty );
 }
 
@@ -1231,13 +1292,26 @@ const Imath::Box2i &ImageGadget::dataWindow() const
 {
 	if( m_dirtyFlags & DataWindowDirty )
 	{
+		m_proxyScale = V2f( 1 );
+		m_proxyOffset = V2f( 0 );
 		if( !m_image )
 		{
 			m_dataWindow = Box2i();
 		}
 		else
 		{
-			Context::Scope scopedContext( m_context.get() );
+			Context::EditableScope scopedContext( m_context.get() );
+			if( m_proxyLevel )
+			{
+				scopedContext.set( ImageReader::proxyLevelContextName, &m_proxyLevel );
+				const Box2i &displayWindow = format().getDisplayWindow();
+				const Box2i proxyDisplayWindow = m_image->formatPlug()->getValue().getDisplayWindow();
+				if( !BufferAlgo::empty( displayWindow ) && !BufferAlgo::empty( proxyDisplayWindow ) )
+				{
+					m_proxyScale = V2f( displayWindow.size() ) / V2f( proxyDisplayWindow.size() );
+					m_proxyOffset = V2f( displayWindow.min ) - V2f( proxyDisplayWindow.min ) * m_proxyScale;
+				}
+			}
 			m_dataWindow = m_image->dataWindowPlug()->getValue();
 		}
 		m_dirtyFlags &= ~DataWindowDirty;
@@ -1500,7 +1574,8 @@ void ImageGadget::updateTiles()
 	// Do the actual work of generating the tiles asynchronously,
 	// in the background.
 
-	auto tileFunctor = [this, channelsToCompute] ( const ImagePlug *image, const V2i &tileOrigin ) {
+	const int proxyLevel = m_proxyLevel;
+	auto tileFunctor = [this, channelsToCompute, proxyLevel] ( const ImagePlug *image, const V2i &tileOrigin ) {
 
 		try
 		{
@@ -1508,7 +1583,7 @@ void ImageGadget::updateTiles()
 			ImagePlug::ChannelDataScope channelScope( Context::current() );
 			for( auto &channelName : channelsToCompute )
 			{
-				Tile &tile = m_tiles[TileIndex(tileOrigin, channelName)];
+				Tile &tile = m_tiles[TileIndex(tileOrigin, channelName, proxyLevel)];
 				if( channelName == g_idChannelInternalName )
 				{
 					channelScope.setChannelName( &m_idChannel.string() );
@@ -1542,25 +1617,39 @@ void ImageGadget::updateTiles()
 			// the active flag for each tile.
 			for( auto &channelName : channelsToCompute )
 			{
-				m_tiles[TileIndex(tileOrigin, channelName)].resetActive();
+				m_tiles[TileIndex(tileOrigin, channelName, proxyLevel)].resetActive();
 			}
 			throw;
 		}
 
 	};
 
-	Context::Scope scopedContext( m_context.get() );
+	// The background thread takes a copy of the current context,
+	// so it is safe to reference `proxyLevel` here.
+	Context::EditableScope scopedContext( m_context.get() );
+	if( proxyLevel )
+	{
+		scopedContext.set( ImageReader::proxyLevelContextName, &proxyLevel );
+	}
+
+	const int prefetchFrames = m_prefetchFrames;
+	const float prefetchFrameStep = m_prefetchFrameStep;
+	const size_t prefetchMemoryLimit = m_prefetchMemoryLimit;
+	const Box2i prefetchRegion = prefetchFrames ? this->prefetchRegion( dataWindow ) : Box2i();
+
 	m_tilesTask = ParallelAlgo::callOnBackgroundThread(
 		// Subject
 		m_image.get(),
 		// OK to capture `this` via raw pointer, because ~ImageGadget waits for
 		// the background process to complete.
-		[ this, channelsToCompute, dataWindow, tileFunctor ] {
+		[ this, channelsToCompute, dataWindow, tileFunctor, prefetchFrames, prefetchFrameStep, prefetchMemoryLimit, prefetchRegion ] {
 
+			bool complete = false;
 			try
 			{
 				ImageAlgo::parallelProcessTiles( m_image.get(), tileFunctor, dataWindow );
 				m_dirtyFlags &= ~TilesDirty;
+				complete = true;
 			}
 			catch( const Gaffer::ProcessException & )
 			{
@@ -1584,11 +1673,120 @@ void ImageGadget::updateTiles()
 				);
 			}
 
+			if( complete && prefetchFrames )
+			{
+				// We continue on the same task, so that prefetching is
+				// cancelled by anything that dirties the tiles, such as
+				// the user scrubbing to a different frame.
+				prefetch( channelsToCompute, prefetchRegion, prefetchFrames, prefetchFrameStep, prefetchMemoryLimit );
+			}
+
 		}
 	);
 
 }
 
+Imath::Box2i ImageGadget::prefetchRegion( const Imath::Box2i &dataWindow ) const
+{
+	const ViewportGadget *viewport = ancestor<ViewportGadget>();
+	if( !viewport )
+	{
+		return dataWindow;
+	}
+
+	// Find the region of the image visible in the viewport, in the
+	// pixel space of the current proxy level.
+
+	const float pixelAspect = format().getPixelAspect();
+	Box2f visible;
+	for( const V2f &rasterCorner : { V2f( 0 ), V2f( viewport->getViewport() ) } )
+	{
+		const V3f gadgetCorner = viewport->rasterToGadgetSpace( rasterCorner, this ).p0;
+		const V2f fullCorner( gadgetCorner.x / pixelAspect, gadgetCorner.y );
+		visible.extendBy( ( fullCorner - m_proxyOffset ) / m_proxyScale );
+	}
+
+	// Add a margin of a tile, so that small pans during playback
+	// are still likely to hit the cache.
+
+	const V2i margin( ImagePlug::tileSize() );
+	return BufferAlgo::intersection(
+		dataWindow,
+		Box2i(
+			V2i( (int)floorf( visible.min.x ), (int)floorf( visible.min.y ) ) - margin,
+			V2i( (int)ceilf( visible.max.x ), (int)ceilf( visible.max.y ) ) + margin
+		)
+	);
+}
+
+void ImageGadget::prefetch( const std::vector<std::string> &channelNames, const Imath::Box2i &region, int frames, float frameStep, size_t memoryLimit ) const
+{
+	if( BufferAlgo::empty( region ) )
+	{
+		return;
+	}
+
+	vector<string> channelsToPrefetch;
+	for( const auto &channelName : channelNames )
+	{
+		channelsToPrefetch.push_back( channelName == g_idChannelInternalName ? m_idChannel.string() : channelName );
+	}
+
+	// Prefetching is speculative, so we limit it to half of the available
+	// threads, leaving the rest free for computes that are needed now. It
+	// remains cancellable via the context of the background task we are
+	// running on.
+	tbb::task_arena arena( std::max( 1, tbb::this_task_arena::max_concurrency() / 2 ) );
+	const ThreadState &threadState = ThreadState::current();
+
+	arena.execute(
+		[&] {
+
+			ThreadState::Scope threadStateScope( threadState );
+			Context::EditableScope frameScope( Context::current() );
+			const float currentFrame = frameScope.context()->getFrame();
+			std::atomic<size_t> memory( 0 );
+
+			try
+			{
+				for( int i = 1; i <= frames && memory < memoryLimit; ++i )
+				{
+					frameScope.setFrame( currentFrame + frameStep * i );
+
+					const Box2i dataWindow = m_image->dataWindowPlug()->getValue();
+					ConstStringVectorDataPtr availableChannelsData = m_image->channelNamesPlug()->getValue();
+					const vector<string> &availableChannels = availableChannelsData->readable();
+
+					vector<string> frameChannels;
+					for( const auto &channelName : channelsToPrefetch )
+					{
+						if( find( availableChannels.begin(), availableChannels.end(), channelName ) != availableChannels.end() )
+						{
+							frameChannels.push_back( channelName );
+						}
+					}
+
+					ImageAlgo::parallelProcessTiles(
+						m_image.get(), frameChannels,
+						[&memory] ( const ImagePlug *image, const string &channelName, const V2i &tileOrigin ) {
+							ConstFloatVectorDataPtr channelData = image->channelDataPlug()->getValue();
+							memory += channelData->readable().size() * sizeof( float );
+						},
+						BufferAlgo::intersection( dataWindow, region )
+					);
+				}
+			}
+			catch( ... )
+			{
+				// Prefetching is purely an optimisation, so we ignore errors
+				// and cancellation. Errors will be reported when the frame is
+				// actually viewed.
+			}
+
+		}
+	);
+}
+
 void ImageGadget::removeOutOfBoundsTiles() const
 {
 	// In theory, any given tile we hold could turn out to be valid
@@ -1597,7 +1795,8 @@ void ImageGadget::removeOutOfBoundsTiles() const
 	// we don't want to accumulate unbounded numbers of tiles either,
 	// so here we prune out any tiles that we know can't be useful for
 	// the current image, because they either have an invalid channel
-	// name or are outside the data window.
+	// name, are outside the data window, or are for a different proxy
+	// level.
 	const Box2i &dw = dataWindow();
 	const vector<string> &ch = channelNames();
 	for( Tiles::iterator it = m_tiles.begin(); it != m_tiles.end(); )
@@ -1605,7 +1804,11 @@ void ImageGadget::removeOutOfBoundsTiles() const
 		const Box2i tileBound( it->first.tileOrigin, it->first.tileOrigin + V2i( ImagePlug::tileSize() ) );
 
 		const std::string &effectiveChannelName = it->first.channelName.string() == g_idChannelInternalName ? m_idChannel.string() : it->first.channelName.string();
-		if( !BufferAlgo::intersects( dw, tileBound ) || find( ch.begin(), ch.end(), effectiveChannelName ) == ch.end() )
+		if(
+			it->first.proxyLevel != m_proxyLevel ||
+			!BufferAlgo::intersects( dw, tileBound ) ||
+			find( ch.begin(), ch.end(), effectiveChannelName ) == ch.end()
+		)
 		{
 			it = m_tiles.unsafe_erase( it );
 		}
@@ -1635,7 +1838,7 @@ void ImageGadget::renderTiles( bool ids ) const
 
 	std::variant<std::monostate, TileShader::ScopedBinding, TileShaderSelectedIDs::ScopedBinding> shaderBinding;
 
-	V2f effectiveWipePos = m_wipeEnabled ? m_wipePos : V2f( dataWindow.min.x, dataWindow.min.y );
+	V2f effectiveWipePos = m_wipeEnabled ? m_wipePos : proxyToFull( V2f( dataWindow.min.x, dataWindow.min.y ) );
 	V2f effectiveWipeDir = m_wipeEnabled ? V2f( cosf( radians ), sinf( radians ) ) : V2f( -1, 0 );
 
 	if( !ids )
@@ -1690,7 +1893,7 @@ void ImageGadget::renderTiles( bool ids ) const
 				for( int i = 0; i < 4; ++i )
 				{
 					const InternedString channelName = ( m_soloChannel < 0 || i == 3 ) ? m_rgbaChannels[i] : m_rgbaChannels[m_soloChannel];
-					Tiles::const_iterator it = m_tiles.find( TileIndex( tileOrigin, channelName ) );
+					Tiles::const_iterator it = m_tiles.find( TileIndex( tileOrigin, channelName, m_proxyLevel ) );
 					if( it != m_tiles.end() )
 					{
 						channelTextures[i] = it->second.texture( active );
@@ -1705,7 +1908,7 @@ void ImageGadget::renderTiles( bool ids ) const
 			else
 			{
 				IECoreGL::ConstTexturePtr idTexture;
-				Tiles::const_iterator it = m_tiles.find( TileIndex( tileOrigin, g_idChannelInternalName ) );
+				Tiles::const_iterator it = m_tiles.find( TileIndex( tileOrigin, g_idChannelInternalName, m_proxyLevel ) );
 				if( it != m_tiles.end() )
 				{
 					bool unusedActive = false; // We don't have activity indicators for the id AOV
@@ -1732,23 +1935,27 @@ void ImageGadget::renderTiles( bool ids ) const
 				)
 			);
 
+			// Full resolution pixel coordinates, which differ from `validBound`
+			// when we are displaying a proxy.
+			const Box2f pixelBound( proxyToFull( V2f( validBound.min ) ), proxyToFull( V2f( validBound.max ) ) );
+
 			glBegin( GL_QUADS );
 
 				glTexCoord2f( uvBound.min.x, uvBound.min.y );
-				glMultiTexCoord2f( GL_TEXTURE1, validBound.min.x, validBound.min.y );
-				glVertex2f( validBound.min.x * pixelAspect, validBound.min.y );
+				glMultiTexCoord2f( GL_TEXTURE1, pixelBound.min.x, pixelBound.min.y );
+				glVertex2f( pixelBound.min.x * pixelAspect, pixelBound.min.y );
 
 				glTexCoord2f( uvBound.min.x, uvBound.max.y );
-				glMultiTexCoord2f( GL_TEXTURE1, validBound.min.x, validBound.max.y );
-				glVertex2f( validBound.min.x * pixelAspect, validBound.max.y );
+				glMultiTexCoord2f( GL_TEXTURE1, pixelBound.min.x, pixelBound.max.y );
+				glVertex2f( pixelBound.min.x * pixelAspect, pixelBound.max.y );
 
 				glTexCoord2f( uvBound.max.x, uvBound.max.y );
-				glMultiTexCoord2f( GL_TEXTURE1, validBound.max.x, validBound.max.y );
-				glVertex2f( validBound.max.x * pixelAspect, validBound.max.y );
+				glMultiTexCoord2f( GL_TEXTURE1, pixelBound.max.x, pixelBound.max.y );
+				glVertex2f( pixelBound.max.x * pixelAspect, pixelBound.max.y );
 
 				glTexCoord2f( uvBound.max.x, uvBound.min.y );
-				glMultiTexCoord2f( GL_TEXTURE1, validBound.max.x, validBound.min.y );
-				glVertex2f( validBound.max.x * pixelAspect, validBound.min.y );
+				glMultiTexCoord2f( GL_TEXTURE1, pixelBound.max.x, pixelBound.min.y );
+				glVertex2f( pixelBound.max.x * pixelAspect, pixelBound.min.y );
 
 			glEnd();
 
@@ -1784,11 +1991,12 @@ void ImageGadget::renderLayer( Layer layer, const GafferUI::Style *style, Render
 	// there are any computation errors.
 
 	Format format;
-	Box2i dataWindow;
+	Box2i proxyDataWindow;
 	try
 	{
+		updateProxyLevel();
 		format = this->format();
-		dataWindow = this->dataWindow();
+		proxyDataWindow = this->dataWindow();
 		const_cast<ImageGadget *>( this )->updateTiles();
 	}
 	catch( ... )
@@ -1796,6 +2004,20 @@ void ImageGadget::renderLayer( Layer layer, const GafferUI::Style *style, Render
 		return;
 	}
 
+	// If we're displaying a proxy, convert the data window
+	// back to full resolution pixel coordinates.
+
+	Box2i dataWindow = proxyDataWindow;
+	if( m_proxyLevel && !BufferAlgo::empty( proxyDataWindow ) )
+	{
+		const V2f min = proxyToFull( V2f( proxyDataWindow.min ) );
+		const V2f max = proxyToFull( V2f( proxyDataWindow.max ) );
+		dataWindow = Box2i(
+			V2i( (int)roundf( min.x ), (int)roundf( min.y ) ),
+			V2i( (int)roundf( max.x ), (int)roundf( max.y ) )
+		);
+	}
+
 	// Early out if the image has no size.
 
 	const Box2i &displayWindow = format.getDisplayWindow();
@@ -1923,6 +2145,37 @@ void ImageGadget::renderLayer( Layer layer, const GafferUI::Style *style, Render
 	}
 }
 
+void ImageGadget::updateProxyLevel() const
+{
+	int proxyLevel = 0;
+	const ViewportGadget *viewport = ancestor<ViewportGadget>();
+	if( m_maxProxyLevel > 0 && viewport )
+	{
+		// Choose the lowest resolution that still provides at
+		// least one image pixel per screen pixel. We measure in Y
+		// so that pixel aspect doesn't need to be accounted for.
+		const float rasterPixelsPerImagePixel = (
+			viewport->gadgetToRasterSpace( V3f( 0, 1, 0 ), this ) -
+			viewport->gadgetToRasterSpace( V3f( 0 ), this )
+		).length();
+		if( rasterPixelsPerImagePixel > 0.0f )
+		{
+			proxyLevel = std::clamp( (int)floorf( log2f( 1.0f / rasterPixelsPerImagePixel ) ), 0, m_maxProxyLevel );
+		}
+	}
+
+	if( proxyLevel != m_proxyLevel )
+	{
+		m_proxyLevel = proxyLevel;
+		const_cast<ImageGadget *>( this )->dirty( DataWindowDirty | TilesDirty );
+	}
+}
+
+Imath::V2f ImageGadget::proxyToFull( const Imath::V2f &p ) const
+{
+	return p * m_proxyScale + m_proxyOffset;
+}
+
 unsigned ImageGadget::layerMask() const
 {
 	return (unsigned)Layer::Back | Layer::Main | Layer::Front;
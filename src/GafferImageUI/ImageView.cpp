@@ -468,6 +468,11 @@ ImageView::ImageView( Gaffer::ScriptNodePtr scriptNode )
 	channelsDefaultData->writable() = { "R", "G", "B", "A" };
 	addChild( new StringVectorDataPlug( "channels", Plug::In, channelsDefaultData ) );
 
+	PlugPtr prefetchParent = new Plug( "prefetch" );
+	addChild( prefetchParent );
+	prefetchParent->addChild( new IntPlug( "frames", Plug::In, 0, 0 ) );
+	prefetchParent->addChild( new IntPlug( "memoryLimit", Plug::In, 1024, 0 ) );
+
 	[[maybe_unused]] auto displayTransform = new DisplayTransform( this );
 	assert( displayTransform->parent() == this );
 
@@ -511,6 +516,7 @@ ImageView::ImageView( Gaffer::ScriptNodePtr scriptNode )
 
 	contextChangedSignal().connect( boost::bind( &ImageView::contextChanged, this ) );
 	plugSetSignal().connect( boost::bind( &ImageView::plugSet, this, ::_1 ) );
+	plugDirtiedSignal().connect( boost::bind( &ImageView::plugDirtied, this, ::_1 ) );
 	viewportGadget()->keyPressSignal().connect( boost::bind( &ImageView::keyPress, this, ::_2 ) );
 	viewportGadget()->preRenderSignal().connect( boost::bind( &ImageView::preRender, this ) );
 
@@ -677,6 +683,26 @@ const Gaffer::StringPlug *ImageView::compareCatalogueOutputPlug() const
 	return getChild<Plug>( "compare" )->getChild<StringPlug>( "catalogueOutput" );
 }
 
+Gaffer::IntPlug *ImageView::prefetchFramesPlug()
+{
+	return getChild<Plug>( "prefetch" )->getChild<IntPlug>( "frames" );
+}
+
+const Gaffer::IntPlug *ImageView::prefetchFramesPlug() const
+{
+	return getChild<Plug>( "prefetch" )->getChild<IntPlug>( "frames" );
+}
+
+Gaffer::IntPlug *ImageView::prefetchMemoryLimitPlug()
+{
+	return getChild<Plug>( "prefetch" )->getChild<IntPlug>( "memoryLimit" );
+}
+
+const Gaffer::IntPlug *ImageView::prefetchMemoryLimitPlug() const
+{
+	return getChild<Plug>( "prefetch" )->getChild<IntPlug>( "memoryLimit" );
+}
+
 ImageGadget *ImageView::imageGadget()
 {
 	return m_imageGadgets[0].get();
@@ -771,6 +797,25 @@ void ImageView::plugSet( Gaffer::Plug *plug )
 	}
 }
 
+void ImageView::plugDirtied( Gaffer::Plug *plug )
+{
+	// We use `plugDirtied()` rather than `plugSet()` because the prefetch
+	// plugs are typically connected to the Viewer preferences, and
+	// `plugSetSignal()` isn't emitted for changes made via an input.
+	if( plug == prefetchFramesPlug() )
+	{
+		const int frames = prefetchFramesPlug()->getValue();
+		m_imageGadgets[0]->setPrefetchFrames( frames );
+		m_imageGadgets[1]->setPrefetchFrames( frames );
+	}
+	else if( plug == prefetchMemoryLimitPlug() )
+	{
+		const size_t memoryLimit = (size_t)prefetchMemoryLimitPlug()->getValue() * 1024 * 1024;
+		m_imageGadgets[0]->setPrefetchMemoryLimit( memoryLimit );
+		m_imageGadgets[1]->setPrefetchMemoryLimit( memoryLimit );
+	}
+}
+
 void ImageView::setWipeActive( bool active )
 {
 	if( active && !m_wipeHandle->getVisible() )
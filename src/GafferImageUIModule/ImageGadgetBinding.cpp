@@ -127,6 +127,12 @@ void GafferImageUIModule::bindImageGadget()
 		.def( "getWipePosition", &getWipePosition )
 		.def( "setWipeAngle", &ImageGadget::setWipeAngle )
 		.def( "getWipeAngle", &ImageGadget::getWipeAngle )
+		.def( "setMaxProxyLevel", &ImageGadget::setMaxProxyLevel )
+		.def( "getMaxProxyLevel", &ImageGadget::getMaxProxyLevel )
+		.def( "setPrefetchFrames", &ImageGadget::setPrefetchFrames )
+		.def( "getPrefetchFrames", &ImageGadget::getPrefetchFrames )
+		.def( "setPrefetchMemoryLimit", &ImageGadget::setPrefetchMemoryLimit )
+		.def( "getPrefetchMemoryLimit", &ImageGadget::getPrefetchMemoryLimit )
 	;
 
 	enum_<ImageGadget::State>( "State" )
@@ -121,3 +121,8 @@ IECore::ConstCompoundObjectPtr AttributeProcessor::computeAttributes( const Scen
 		return inPlug()->attributesPlug()->getValue();
 	}
 }
+
+bool AttributeProcessor::affectedPaths( const Gaffer::Plug *input, const Gaffer::ValuePlug *output, IECore::PathMatcher &paths ) const
+{
+	return filteredAffectedPaths( input, paths );
+}
@@ -46,6 +46,8 @@
 
 #include "IECore/NullObject.h"
 
+#include "tbb/parallel_for.h"
+#include "tbb/parallel_reduce.h"
 #include "tbb/spin_mutex.h"
 
 #include "fmt/format.h"
@@ -276,6 +278,19 @@ class BranchCreator::BranchesData : public IECore::Data
 				m_root.get()
 			);
 
+			// Build a flat index of the destinations, so that set computations
+			// can visit them in parallel.
+			visitLocationsWalk(
+				[this] ( const ScenePlug::ScenePath &path, Location *location ) {
+					if( location->sourcePaths )
+					{
+						m_destinations.push_back( { path, location->sourcePaths.get() } );
+					}
+				},
+				ScenePath(),
+				m_root.get()
+			);
+
 		}
 
 		static bool affectedBy( const BranchCreator *branchCreator, const Plug *input )
@@ -352,16 +367,21 @@ class BranchCreator::BranchesData : public IECore::Data
 		template<typename F>
 		void visitDestinations( F &&f ) const
 		{
-			visitLocationsWalk(
-				[ &f ] ( const ScenePlug::ScenePath &path, const Location *location ) {
-					if( location->sourcePaths )
-					{
-						f( path, *location->sourcePaths );
-					}
-				},
-				ScenePath(),
-				m_root.get()
-			);
+			for( const auto &destination : m_destinations )
+			{
+				f( destination.path, *destination.sourcePaths );
+			}
+		}
+
+		struct DestinationEntry
+		{
+			ScenePlug::ScenePath path;
+			const Location::SourcePaths *sourcePaths;
+		};
+
+		const std::vector<DestinationEntry> &destinations() const
+		{
+			return m_destinations;
 		}
 
 	private :
@@ -449,6 +469,7 @@ class BranchCreator::BranchesData : public IECore::Data
 
 		tbb::spin_mutex m_mutex;
 		Location::Ptr m_root;
+		std::vector<DestinationEntry> m_destinations;
 
 };
 
@@ -1067,20 +1088,40 @@ void BranchCreator::hashSet( const IECore::InternedString &setName, const Gaffer
 	FilteredSceneProcessor::hashSet( setName, context, parent, h );
 	inPlug()->setPlug()->hash( h );
 
-	/// \todo Parallelise.
-	branches->visitDestinations(
-		[&setName, &context, &h, this] ( const ScenePath &destination, const BranchesData::Location::SourcePaths &sourcePaths ) {
-			for( const auto &sourcePath : sourcePaths )
+	// Hash each destination in parallel, and then combine the results
+	// serially so that the final hash doesn't depend on scheduling.
+
+	const auto &destinations = branches->destinations();
+	vector<MurmurHash> destinationHashes( destinations.size() );
+
+	const ThreadState &threadState = ThreadState::current();
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, destinations.size() ),
+		[&] ( const tbb::blocked_range<size_t> &range ) {
+			ThreadState::Scope threadStateScope( threadState );
+			for( size_t i = range.begin(); i != range.end(); ++i )
 			{
-				MurmurHash branchSetHash;
-				hashBranchSet( sourcePath, setName, context, branchSetHash );
-				h.append( branchSetHash );
+				const BranchesData::DestinationEntry &destination = destinations[i];
+				MurmurHash &destinationHash = destinationHashes[i];
+				for( const auto &sourcePath : *destination.sourcePaths )
+				{
+					MurmurHash branchSetHash;
+					hashBranchSet( sourcePath, setName, context, branchSetHash );
+					destinationHash.append( branchSetHash );
+				}
+				ScenePlug::PathScope pathScope( context, &destination.path );
+				mappingPlug()->hash( destinationHash );
+				destinationHash.append( destination.path.data(), destination.path.size() );
 			}
-			ScenePlug::PathScope pathScope( context, &destination );
-			mappingPlug()->hash( h );
-			h.append( destination.data(), destination.size() );
-		}
+		},
+		taskGroupContext
 	);
+
+	for( const auto &destinationHash : destinationHashes )
+	{
+		h.append( destinationHash );
+	}
 }
 
 IECore::ConstPathMatcherDataPtr BranchCreator::computeSet( const IECore::InternedString &setName, const Gaffer::Context *context, const ScenePlug *parent ) const
@@ -1093,37 +1134,50 @@ IECore::ConstPathMatcherDataPtr BranchCreator::computeSet( const IECore::Interne
 		return inputSetData;
 	}
 
-	PathMatcherDataPtr outputSetData = inputSetData->copy();
-	PathMatcher &outputSet = outputSetData->writable();
+	// Remap the branch sets for each destination in parallel, adding them
+	// to per-task sets that are merged as the tasks complete.
+
+	const auto &destinations = branches->destinations();
 
-	/// \todo Parallelise.
-	branches->visitDestinations(
-		[&setName, &context, &outputSet, this] ( const ScenePath &destination, const BranchesData::Location::SourcePaths &sourcePaths ) {
-			vector<ConstPathMatcherDataPtr> branchSets = { nullptr };
-			for( const auto &sourcePath : sourcePaths )
+	const ThreadState &threadState = ThreadState::current();
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	const PathMatcher branchesSet = tbb::parallel_reduce(
+		tbb::blocked_range<size_t>( 0, destinations.size() ),
+		PathMatcher(),
+		[&] ( const tbb::blocked_range<size_t> &range, const PathMatcher &x ) {
+			ThreadState::Scope threadStateScope( threadState );
+			PathMatcher result = x;
+			for( size_t i = range.begin(); i != range.end(); ++i )
 			{
-				branchSets.push_back( computeBranchSet( sourcePath, setName, context ) );
+				const BranchesData::DestinationEntry &destination = destinations[i];
+				vector<ConstPathMatcherDataPtr> branchSets = { nullptr };
+				for( const auto &sourcePath : *destination.sourcePaths )
+				{
+					branchSets.push_back( computeBranchSet( sourcePath, setName, context ) );
+				}
+				ScenePlug::PathScope pathScope( context, &destination.path );
+				Private::ConstChildNamesMapPtr mapping = boost::static_pointer_cast<const Private::ChildNamesMap>( mappingPlug()->getValue() );
+				result.addPaths( mapping->set( branchSets ), destination.path );
 			}
-			ScenePlug::PathScope pathScope( context, &destination );
-			Private::ConstChildNamesMapPtr mapping = boost::static_pointer_cast<const Private::ChildNamesMap>( mappingPlug()->getValue() );
-			outputSet.addPaths( mapping->set( branchSets ), destination );
-		}
+			return result;
+		},
+		[] ( const PathMatcher &x, const PathMatcher &y ) {
+			PathMatcher result = x;
+			result.addPaths( y );
+			return result;
+		},
+		taskGroupContext
 	);
 
+	PathMatcherDataPtr outputSetData = inputSetData->copy();
+	outputSetData->writable().addPaths( branchesSet );
+
 	return outputSetData;
 }
 
 Gaffer::ValuePlug::CachePolicy BranchCreator::hashCachePolicy( const Gaffer::ValuePlug *output ) const
 {
-	if( output == outPlug()->setPlug() )
-	{
-		// Technically we do not _need_ TaskIsolation because we have not yet
-		// multithreaded `hashSet()`. But we still benefit from requesting it
-		// because it means the hash is stored in the global cache, where it is
-		// shared between all threads and is almost guaranteed not to be evicted.
-		return ValuePlug::CachePolicy::TaskIsolation;
-	}
-	else if( output == branchesPlug() )
+	if( output == outPlug()->setPlug() || output == branchesPlug() )
 	{
 		return ValuePlug::CachePolicy::TaskCollaboration;
 	}
@@ -1132,7 +1186,7 @@ Gaffer::ValuePlug::CachePolicy BranchCreator::hashCachePolicy( const Gaffer::Val
 
 Gaffer::ValuePlug::CachePolicy BranchCreator::computeCachePolicy( const Gaffer::ValuePlug *output ) const
 {
-	if( output == branchesPlug() )
+	if( output == outPlug()->setPlug() || output == branchesPlug() )
 	{
 		return ValuePlug::CachePolicy::TaskCollaboration;
 	}
@@ -270,6 +270,38 @@ IECore::CompoundDataPtr parseManifestFromMetadataAndSidecar( const std::string &
 	return parseManifestFromSidecarFile( p.generic_string() );
 }
 
+// Manifest index
+// ==============
+//
+// The index stores the manifest paths in normalised form, sorted so that each
+// location is immediately followed by all of its descendants. The matte value for
+// each path is stored in a parallel array, so that it only needs to be computed
+// once per manifest.
+
+const IECore::InternedString g_pathsName( "paths" );
+const IECore::InternedString g_valuesName( "values" );
+
+std::string normalisedPath( const std::string &name )
+{
+	return GafferScene::ScenePlug::pathToString( GafferScene::ScenePlug::stringToPath( name ) );
+}
+
+bool pathLess( const std::string &a, const std::string &b )
+{
+	return std::lexicographical_compare(
+		a.begin(), a.end(), b.begin(), b.end(),
+		[] ( char x, char y ) {
+			// Order '/' before all other characters, so that `/a/b/c` sorts
+			// before siblings such as `/a/b-c`.
+			if( x == '/' )
+			{
+				return y != '/';
+			}
+			return y != '/' && (unsigned char)x < (unsigned char)y;
+		}
+	);
+}
+
 const std::regex g_nameMetadataRegex( R"((cryptomatte/[^/]{1,7})/name)" );
 
 IECore::CompoundDataPtr parseManifestFromFirstMetadataEntry( const std::string &cryptomatteLayer, ConstCompoundDataPtr metadata, const std::string &manifestDirectory )
@@ -380,6 +412,7 @@ Cryptomatte::Cryptomatte( const std::string &name )
 	addChild( new PathMatcherDataPlug( "__manifestPaths", Gaffer::Plug::Out, new PathMatcherData ) );
 	addChild( new ScenePlug( "manifestScene", Gaffer::Plug::Out ) );
 	addChild( new FloatVectorDataPlug( "__matteChannelData", Gaffer::Plug::Out, GafferImage::ImagePlug::blackTile() ) );
+	addChild( new AtomicCompoundDataPlug( "__manifestIndex", Gaffer::Plug::Out, new CompoundData() ) );
 
 	outPlug()->formatPlug()->setInput( inPlug()->formatPlug() );
 	outPlug()->metadataPlug()->setInput( inPlug()->metadataPlug() );
@@ -500,6 +533,16 @@ const Gaffer::FloatVectorDataPlug *Cryptomatte::matteChannelDataPlug() const
 	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 10 );
 }
 
+Gaffer::AtomicCompoundDataPlug *Cryptomatte::manifestIndexPlug()
+{
+	return getChild<AtomicCompoundDataPlug>( g_firstPlugIndex + 11 );
+}
+
+const Gaffer::AtomicCompoundDataPlug *Cryptomatte::manifestIndexPlug() const
+{
+	return getChild<AtomicCompoundDataPlug>( g_firstPlugIndex + 11 );
+}
+
 void Cryptomatte::affects(const Gaffer::Plug *input, AffectedPlugsContainer &outputs) const
 {
 	FlatImageProcessor::affects(input, outputs);
@@ -533,7 +576,7 @@ void Cryptomatte::affects(const Gaffer::Plug *input, AffectedPlugsContainer &out
 	}
 
 	if( input == matteNamesPlug() ||
-		input == manifestPlug() )
+		input == manifestIndexPlug() )
 	{
 		outputs.push_back( matteValuesPlug() );
 	}
@@ -541,6 +584,7 @@ void Cryptomatte::affects(const Gaffer::Plug *input, AffectedPlugsContainer &out
 	if( input == manifestPlug() )
 	{
 		outputs.push_back( manifestPathDataPlug() );
+		outputs.push_back( manifestIndexPlug() );
 	}
 
 	if( input == manifestPathDataPlug() )
@@ -581,10 +625,10 @@ void Cryptomatte::hash( const Gaffer::ValuePlug *output, const Gaffer::Context *
 	}
 	else if( output == matteValuesPlug() )
 	{
-		manifestPlug()->hash( h );
+		manifestIndexPlug()->hash( h );
 		matteNamesPlug()->hash( h );
 	}
-	else if( output == manifestPathDataPlug() )
+	else if( output == manifestPathDataPlug() || output == manifestIndexPlug() )
 	{
 		manifestPlug()->hash( h );
 	}
@@ -678,6 +722,43 @@ void Cryptomatte::compute( Gaffer::ValuePlug *output, const Gaffer::Context *con
 			static_cast<AtomicCompoundDataPlug *>( output )->setToDefault();
 		}
 	}
+	else if( output == manifestIndexPlug() )
+	{
+		ConstCompoundDataPtr manifest = manifestPlug()->getValue();
+
+		std::vector<std::pair<std::string, float>> entries;
+		entries.reserve( manifest->readable().size() );
+		for( const auto &manifestEntry : manifest->readable() )
+		{
+			const std::string &matteName = static_cast<IECore::StringData *>( manifestEntry.second.get() )->readable();
+			entries.emplace_back( normalisedPath( matteName ), matteNameToValue( matteName ) );
+		}
+
+		std::sort(
+			entries.begin(), entries.end(),
+			[] ( const std::pair<std::string, float> &a, const std::pair<std::string, float> &b ) {
+				return pathLess( a.first, b.first );
+			}
+		);
+
+		StringVectorDataPtr pathsData = new StringVectorData;
+		std::vector<std::string> &paths = pathsData->writable();
+		paths.reserve( entries.size() );
+		FloatVectorDataPtr valuesData = new FloatVectorData;
+		std::vector<float> &values = valuesData->writable();
+		values.reserve( entries.size() );
+		for( auto &[path, value] : entries )
+		{
+			paths.push_back( std::move( path ) );
+			values.push_back( value );
+		}
+
+		CompoundDataPtr resultData = new CompoundData;
+		resultData->writable()[g_pathsName] = pathsData;
+		resultData->writable()[g_valuesName] = valuesData;
+
+		static_cast<AtomicCompoundDataPlug *>( output )->setValue( resultData );
+	}
 	else if( output == matteValuesPlug() )
 	{
 		FloatVectorDataPtr resultData = new IECore::FloatVectorData();
@@ -685,9 +766,18 @@ void Cryptomatte::compute( Gaffer::ValuePlug *output, const Gaffer::Context *con
 		std::unordered_set<float> matteValues;
 
 		ConstStringVectorDataPtr matteNames = matteNamesPlug()->getValue();
-		ConstCompoundDataPtr manifest = manifestPlug()->getValue();
-
-		IECore::PathMatcher pathMatcher;
+		ConstCompoundDataPtr manifestIndex = manifestIndexPlug()->getValue();
+
+		const StringVectorData *pathsData = manifestIndex->member<StringVectorData>( g_pathsName );
+		const FloatVectorData *valuesData = manifestIndex->member<FloatVectorData>( g_valuesName );
+		const std::vector<std::string> emptyPaths;
+		const std::vector<float> emptyValues;
+		const std::vector<std::string> &paths = pathsData ? pathsData->readable() : emptyPaths;
+		const std::vector<float> &values = valuesData ? valuesData->readable() : emptyValues;
+
+		// Wildcard patterns must be tested against every manifest entry, so we gather
+		// them into a PathMatcher and only pay for that if we have any.
+		IECore::PathMatcher wildcardMatcher;
 		for( const auto &name : matteNames->readable() )
 		{
 			if( name.size() > 0 && name.front() == '<' && name.back() == '>' )
@@ -702,29 +792,41 @@ void Cryptomatte::compute( Gaffer::ValuePlug *output, const Gaffer::Context *con
 					continue;
 				}
 			}
-			else
+			else if( StringAlgo::hasWildcards( name ) || name.find( "..." ) != string::npos )
 			{
-				if( manifest )
-				{
-					pathMatcher.addPath( name );
-				}
-
+				wildcardMatcher.addPath( name );
 				if( !StringAlgo::hasWildcards( name ) || name.find( "..." ) == string::npos )
 				{
 					// Hash names without wildcards directly. This allows them to still be matched if no manifest exists or has been truncated by the renderer
 					matteValues.insert( matteNameToValue( name ) );
 				}
 			}
+			else
+			{
+				matteValues.insert( matteNameToValue( name ) );
+
+				// The index is sorted so that a location is immediately followed by all its
+				// descendants, so exact and ancestor matches form a contiguous range.
+				const std::string path = normalisedPath( name );
+				const std::string prefix = path == "/" ? path : path + "/";
+				for( auto it = std::lower_bound( paths.begin(), paths.end(), path, pathLess ); it != paths.end(); ++it )
+				{
+					if( *it != path && it->compare( 0, prefix.size(), prefix ) != 0 )
+					{
+						break;
+					}
+					matteValues.insert( values[it - paths.begin()] );
+				}
+			}
 		}
 
-		if( manifest )
+		if( !wildcardMatcher.isEmpty() )
 		{
-			for( const auto &manifestEntry : manifest->readable() )
+			for( size_t i = 0, e = paths.size(); i < e; ++i )
 			{
-				const std::string &matteName = static_cast<IECore::StringData *>( manifestEntry.second.get() )->readable();
-				if( pathMatcher.match( matteName ) & ( IECore::PathMatcher::ExactMatch | IECore::PathMatcher::AncestorMatch ) )
+				if( wildcardMatcher.match( paths[i] ) & ( IECore::PathMatcher::ExactMatch | IECore::PathMatcher::AncestorMatch ) )
 				{
-					matteValues.insert( matteNameToValue( matteName ) );
+					matteValues.insert( values[i] );
 				}
 			}
 		}
@@ -812,6 +914,12 @@ void Cryptomatte::compute( Gaffer::ValuePlug *output, const Gaffer::Context *con
 
 		const std::vector<std::string> &channelNames = channelNamesData->readable();
 		const std::vector<float> &matteValues = matteValuesData->readable();
+		if( matteValues.empty() )
+		{
+			// Nothing can match, so there's no need to read any channel data.
+			static_cast<FloatVectorDataPlug *>( output )->setValue( resultData );
+			return;
+		}
 
 		boost::regex channelNameRegex( fmt::format( g_cryptomatteChannelPattern, cryptomatteLayer ) );
 		GafferImage::ImagePlug::ChannelDataScope channelDataScope( context );
@@ -839,11 +947,23 @@ void Cryptomatte::compute( Gaffer::ValuePlug *output, const Gaffer::Context *con
 				ConstFloatVectorDataPtr alphaData = inPlug()->channelDataPlug()->getValue();
 				const std::vector<float> &alpha = alphaData->readable();
 
+				// Neighbouring pixels very often belong to the same object, so we
+				// remember the result for the previous ID rather than searching
+				// the (potentially very large) list of matte values for every pixel.
+				float previousValue = value.front();
+				bool previousMatched = std::binary_search( matteValues.begin(), matteValues.end(), previousValue );
+
 				std::vector<float>::const_iterator vIt = value.begin();
 				std::vector<float>::const_iterator aIt = alpha.begin();
 				for( std::vector<float>::iterator it = result.begin(), eIt = result.end(); it != eIt; ++it, ++vIt, ++aIt )
 				{
-					if( std::binary_search( matteValues.begin(), matteValues.end(), *vIt ) )
+					if( *vIt != previousValue )
+					{
+						previousValue = *vIt;
+						previousMatched = std::binary_search( matteValues.begin(), matteValues.end(), previousValue );
+					}
+
+					if( previousMatched )
 					{
 						*it += *aIt;
 					}
@@ -859,7 +979,8 @@ Gaffer::ValuePlug::CachePolicy Cryptomatte::computeCachePolicy( const Gaffer::Va
 {
 	if( output == matteValuesPlug() ||
 		output == manifestPlug() ||
-		output == manifestPathDataPlug() )
+		output == manifestPathDataPlug() ||
+		output == manifestIndexPlug() )
 	{
 		// Request blocking compute to avoid concurrent threads computing the manifest redundantly.
 		return ValuePlug::CachePolicy::Standard;
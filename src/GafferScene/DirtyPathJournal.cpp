@@ -0,0 +1,163 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2026, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "GafferScene/Private/DirtyPathJournal.h"
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+using namespace IECore;
+using namespace Gaffer;
+
+//////////////////////////////////////////////////////////////////////////
+// Internal implementation
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+struct Entry
+{
+	// The dirty count of the plug at the time the entry was recorded.
+	uint64_t dirtyCount;
+	bool known;
+	PathMatcher paths;
+};
+
+std::atomic_int g_observers( 0 );
+std::mutex g_mutex;
+std::unordered_map<const ValuePlug *, Entry> g_entries;
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// Public API
+//////////////////////////////////////////////////////////////////////////
+
+namespace GafferScene::Private::DirtyPathJournal
+{
+
+Observer::Observer()
+{
+	g_observers++;
+}
+
+Observer::~Observer()
+{
+	if( --g_observers == 0 )
+	{
+		std::lock_guard<std::mutex> lock( g_mutex );
+		g_entries.clear();
+	}
+}
+
+bool observed()
+{
+	return g_observers > 0;
+}
+
+void record( const Gaffer::ValuePlug *plug, const IECore::PathMatcher *paths )
+{
+	std::lock_guard<std::mutex> lock( g_mutex );
+
+	auto [it, inserted] = g_entries.try_emplace( plug );
+	Entry &entry = it->second;
+	if( inserted || entry.dirtyCount != plug->dirtyCount() )
+	{
+		entry.dirtyCount = plug->dirtyCount();
+		entry.known = true;
+		entry.paths.clear();
+	}
+
+	if( !paths )
+	{
+		entry.known = false;
+		entry.paths.clear();
+	}
+	else if( entry.known )
+	{
+		entry.paths.addPaths( *paths );
+	}
+}
+
+void inputChanged( const Gaffer::ValuePlug *plug )
+{
+	std::lock_guard<std::mutex> lock( g_mutex );
+
+	// Dirty propagation follows immediately, incrementing the dirty count,
+	// so we key the entry to the count that the dirtying will produce.
+	Entry &entry = g_entries[plug];
+	entry.dirtyCount = plug->dirtyCount() + 1;
+	entry.known = false;
+	entry.paths.clear();
+}
+
+bool affectedPaths( const Gaffer::ValuePlug *plug, IECore::PathMatcher &paths )
+{
+	std::lock_guard<std::mutex> lock( g_mutex );
+
+	while( plug )
+	{
+		auto it = g_entries.find( plug );
+		if( it != g_entries.end() && it->second.dirtyCount == plug->dirtyCount() )
+		{
+			if( !it->second.known )
+			{
+				return false;
+			}
+			paths.addPaths( it->second.paths );
+			return true;
+		}
+		plug = plug->getInput<ValuePlug>();
+	}
+
+	return false;
+}
+
+void erase( const Gaffer::ValuePlug *plug )
+{
+	std::lock_guard<std::mutex> lock( g_mutex );
+	g_entries.erase( plug );
+}
+
+void clear()
+{
+	std::lock_guard<std::mutex> lock( g_mutex );
+	g_entries.clear();
+}
+
+} // namespace GafferScene::Private::DirtyPathJournal
@@ -43,7 +43,9 @@
 #include "IECore/NullObject.h"
 #include "IECore/StringAlgo.h"
 
-#include <unordered_map>
+#include "tbb/parallel_for.h"
+
+#include "fmt/format.h"
 
 using namespace std;
 using namespace IECore;
@@ -86,27 +88,43 @@ class Duplicate::DuplicatesData : public IECore::Data
 			}
 
 			// Generate names, and at the same time, the transforms associated with them.
+			// Names are generated in parallel, since interning them is the dominant cost
+			// for large numbers of copies. Transforms are accumulated serially into a flat
+			// array, so that they match the result of repeatedly applying `matrix`.
 
 			m_names = new InternedStringVectorData;
 			std::vector<InternedString> &names = m_names->writable();
-			names.reserve( copies );
+			names.resize( copies );
+			m_transforms.resize( copies );
 
 			const Imath::M44f matrix = node->transformPlug()->matrix();
 
+			m_firstSuffix = suffix;
 			if( suffix == -1 )
 			{
 				assert( copies == 1 );
-				names.push_back( stem );
-				m_transforms[stem] = matrix;
+				names[0] = stem;
+				m_transforms[0] = matrix;
 			}
 			else
 			{
+				tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+				tbb::parallel_for(
+					tbb::blocked_range<int>( 0, copies, 1000 ),
+					[&]( const tbb::blocked_range<int> &range )
+					{
+						for( int i = range.begin(); i != range.end(); ++i )
+						{
+							names[i] = stem + std::to_string( suffix + i );
+						}
+					},
+					taskGroupContext
+				);
+
 				Imath::M44f m = matrix;
 				for( int i = 0; i < copies; ++i )
 				{
-					InternedString name = stem + std::to_string( suffix++ );
-					names.push_back( name );
-					m_transforms[name] = m;
+					m_transforms[i] = m;
 					m = m * matrix;
 				}
 			}
@@ -144,13 +162,34 @@ class Duplicate::DuplicatesData : public IECore::Data
 
 		const Imath::M44f &transform( const IECore::InternedString &name ) const
 		{
-			return m_transforms.at( name );
+			return m_transforms[index( name )];
 		}
 
 	private :
 
+		// Names have consecutive numeric suffixes, so we can recover the index
+		// of a copy from its name without needing to store a map.
+		size_t index( const IECore::InternedString &name ) const
+		{
+			const std::vector<InternedString> &names = m_names->readable();
+			size_t i = 0;
+			if( m_firstSuffix != -1 )
+			{
+				const int suffix = StringAlgo::numericSuffix( name.string() );
+				i = suffix >= m_firstSuffix ? suffix - m_firstSuffix : names.size();
+			}
+
+			if( i >= names.size() || names[i] != name )
+			{
+				throw IECore::Exception( fmt::format( "Invalid copy name \"{}\"", name.string() ) );
+			}
+
+			return i;
+		}
+
 		InternedStringVectorDataPtr m_names;
-		unordered_map<InternedString, Imath::M44f> m_transforms;
+		int m_firstSuffix;
+		std::vector<Imath::M44f> m_transforms;
 
 };
 
@@ -246,6 +285,16 @@ void Duplicate::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outp
 	}
 }
 
+Gaffer::ValuePlug::CachePolicy Duplicate::computeCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == duplicatesPlug() )
+	{
+		// Names are generated in parallel.
+		return ValuePlug::CachePolicy::TaskCollaboration;
+	}
+	return BranchCreator::computeCachePolicy( output );
+}
+
 void Duplicate::hash( const ValuePlug *output, const Context *context, IECore::MurmurHash &h ) const
 {
 	BranchCreator::hash( output, context, h );
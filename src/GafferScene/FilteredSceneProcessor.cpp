@@ -37,6 +37,9 @@
 
 #include "GafferScene/FilteredSceneProcessor.h"
 
+#include "GafferScene/PathFilter.h"
+#include "GafferScene/Private/DirtyPathJournal.h"
+
 #include "Gaffer/Context.h"
 
 using namespace IECore;
@@ -101,3 +104,45 @@ IECore::PathMatcher::Result FilteredSceneProcessor::filterValue( const Gaffer::C
 	FilterPlug::SceneScope sceneScope( context, inPlug() );
 	return (IECore::PathMatcher::Result)filterPlug()->getValue();
 }
+
+bool FilteredSceneProcessor::filteredAffectedPaths( const Gaffer::Plug *input, IECore::PathMatcher &paths ) const
+{
+	if( input == filterPlug() || input == enabledPlug() )
+	{
+		return false;
+	}
+
+	const Plug *filterSource = filterPlug()->source();
+	if( filterSource == filterPlug() )
+	{
+		// No filter, so we match either everything or nothing.
+		if( filterPlug()->defaultValue() & PathMatcher::ExactMatch )
+		{
+			return false;
+		}
+	}
+	else
+	{
+		const PathFilter *pathFilter = runTimeCast<const PathFilter>( filterSource->node() );
+		if(
+			!pathFilter || filterSource != pathFilter->outPlug() ||
+			pathFilter->pathsPlug()->getInput() || pathFilter->rootsPlug()->getInput()
+		)
+		{
+			return false;
+		}
+
+		ConstStringVectorDataPtr filterPaths = pathFilter->pathsPlug()->getValue();
+		for( const auto &path : filterPaths->readable() )
+		{
+			paths.addPath( path );
+		}
+	}
+
+	if( input->parent() == inPlug() )
+	{
+		return Private::DirtyPathJournal::affectedPaths( static_cast<const ValuePlug *>( input ), paths );
+	}
+
+	return true;
+}
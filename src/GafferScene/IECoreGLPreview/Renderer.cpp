@@ -66,6 +66,7 @@
 #include "IECore/PathMatcherData.h"
 #include "IECore/SimpleTypedData.h"
 #include "IECore/StringAlgo.h"
+#include "IECore/VectorTypedData.h"
 #include "IECore/Writer.h"
 
 #include "Imath/ImathBoxAlgo.h"
@@ -77,6 +78,7 @@
 
 #include "fmt/format.h"
 
+#include <algorithm>
 #include <functional>
 #include <unordered_map>
 #include <vector>
@@ -150,14 +152,16 @@ void renderMatchingVisualisations( Visualisation::ColorSpace colorSpace, Visuali
 	}
 }
 
+// When `framing` is false, the bound includes all visualisations, and is made
+// infinite if any of them can't be bounded. This is suitable for culling.
 template <class... Vs>
-void accumulateVisualisationBounds( Box3f &target, Visualisation::Scale scale, Visualisation::Category category, const M44f &transform, const Vs & ... visualisations )
+void accumulateVisualisationBounds( Box3f &target, bool framing, Visualisation::Scale scale, Visualisation::Category category, const M44f &transform, const Vs & ... visualisations )
 {
 	for( auto vs : { visualisations... } )
 	{
 		for( auto v : vs )
 		{
-			if( !v.affectsFramingBound || v.scale != scale || !(v.category & category) )
+			if( ( framing && !v.affectsFramingBound ) || v.scale != scale || !(v.category & category) )
 			{
 				continue;
 			}
@@ -167,6 +171,10 @@ void accumulateVisualisationBounds( Box3f &target, Visualisation::Scale scale, V
 			{
 				target.extendBy( Imath::transform( b, transform ) );
 			}
+			else if( !framing )
+			{
+				target.makeInfinite();
+			}
 		}
 	}
 }
@@ -526,11 +534,26 @@ class OpenGLObject : public IECoreScenePreview::Renderer::ObjectInterface
 			}
 		}
 
+		// Constructs an instance of `prototype`, sharing its converted
+		// renderable and visualisations.
+		OpenGLObject( const std::string &name, const OpenGLObject &prototype, const Imath::M44f &transform )
+			:	m_objectType( prototype.m_objectType ),
+				m_transform( transform ),
+				m_transformSansScale( sansScalingAndShear( transform, false ) ),
+				m_attributes( prototype.m_attributes ),
+				m_renderable( prototype.m_renderable ),
+				m_objectVisualisations( prototype.m_objectVisualisations ),
+				m_editQueue( prototype.m_editQueue )
+		{
+			IECore::StringAlgo::tokenize( name, '/', m_name );
+		}
+
 		void transform( const Imath::M44f &transform ) override
 		{
 			m_editQueue.push( [this, transform]() {
 				m_transform = transform;
 				m_transformSansScale = sansScalingAndShear( transform, false );
+				m_boundsDirty = true;
 			} );
 		}
 
@@ -544,6 +567,7 @@ class OpenGLObject : public IECoreScenePreview::Renderer::ObjectInterface
 			ConstOpenGLAttributesPtr openGLAttributes = static_cast<const OpenGLAttributes *>( attributes );
 			m_editQueue.push( [this, openGLAttributes]() {
 				m_attributes = openGLAttributes;
+				m_boundsDirty = true;
 			} );
 			return true;
 		}
@@ -568,7 +592,25 @@ class OpenGLObject : public IECoreScenePreview::Renderer::ObjectInterface
 			// need for instance ids.
 		}
 
-		Box3f transformedBound() const
+		/// Bound used for framing, as returned by the `gl:queryBound` command.
+		/// Cached, so must only be called on the render thread.
+		const Box3f &framingBound() const
+		{
+			updateBounds();
+			return m_framingBound;
+		}
+
+		/// Conservative bound for everything drawn by the object, used for
+		/// culling and spatial queries. Infinite if the object can't be
+		/// bounded, in which case it must never be culled. Cached, so must
+		/// only be called on the render thread.
+		const Box3f &cullingBound() const
+		{
+			updateBounds();
+			return m_cullingBound;
+		}
+
+		Box3f transformedBound( bool framing = true ) const
 		{
 			Box3f b;
 
@@ -591,10 +633,10 @@ class OpenGLObject : public IECoreScenePreview::Renderer::ObjectInterface
 
 			const Visualisations &attrVis = visualisations( *m_attributes );
 
-			accumulateVisualisationBounds( b, Visualisation::Scale::None, categories, m_transformSansScale, attrVis, m_objectVisualisations );
-			accumulateVisualisationBounds( b, Visualisation::Scale::Local, categories, m_transform, attrVis, m_objectVisualisations );
-			accumulateVisualisationBounds( b, Visualisation::Scale::Visualiser, categories, visualiserTransform( false ), attrVis, m_objectVisualisations );
-			accumulateVisualisationBounds( b, Visualisation::Scale::LocalAndVisualiser, categories, visualiserTransform( true ), attrVis, m_objectVisualisations );
+			accumulateVisualisationBounds( b, framing, Visualisation::Scale::None, categories, m_transformSansScale, attrVis, m_objectVisualisations );
+			accumulateVisualisationBounds( b, framing, Visualisation::Scale::Local, categories, m_transform, attrVis, m_objectVisualisations );
+			accumulateVisualisationBounds( b, framing, Visualisation::Scale::Visualiser, categories, visualiserTransform( false ), attrVis, m_objectVisualisations );
+			accumulateVisualisationBounds( b, framing, Visualisation::Scale::LocalAndVisualiser, categories, visualiserTransform( true ), attrVis, m_objectVisualisations );
 			return b;
 		}
 
@@ -716,6 +758,16 @@ class OpenGLObject : public IECoreScenePreview::Renderer::ObjectInterface
 			return t;
 		}
 
+		void updateBounds() const
+		{
+			if( m_boundsDirty )
+			{
+				m_framingBound = transformedBound( /* framing = */ true );
+				m_cullingBound = transformedBound( /* framing = */ false );
+				m_boundsDirty = false;
+			}
+		}
+
 		IECore::TypeId m_objectType;
 		M44f m_transform;
 		M44f m_transformSansScale;
@@ -725,10 +777,55 @@ class OpenGLObject : public IECoreScenePreview::Renderer::ObjectInterface
 		vector<InternedString> m_name;
 		EditQueue &m_editQueue;
 
+		mutable Box3f m_framingBound;
+		mutable Box3f m_cullingBound;
+		mutable bool m_boundsDirty = true;
+
 };
 
 IE_CORE_FORWARDDECLARE( OpenGLObject )
 
+// Handle returned by `OpenGLRenderer::instances()`.
+class OpenGLInstanceArray : public IECoreScenePreview::Renderer::ObjectInterface
+{
+
+	public :
+
+		void transform( const Imath::M44f &transform ) override
+		{
+		}
+
+		void transform( const std::vector<Imath::M44f> &samples, const std::vector<float> &times ) override
+		{
+		}
+
+		bool attributes( const IECoreScenePreview::Renderer::AttributesInterface *attributes ) override
+		{
+			for( auto &o : objects )
+			{
+				o->attributes( attributes );
+			}
+			return true;
+		}
+
+		void link( const IECore::InternedString &type, const IECoreScenePreview::Renderer::ConstObjectSetPtr &objects ) override
+		{
+		}
+
+		void assignID( uint32_t id ) override
+		{
+		}
+
+		void assignInstanceID( uint32_t instanceID ) override
+		{
+		}
+
+		std::vector<OpenGLObjectPtr> objects;
+
+};
+
+IE_CORE_DECLAREPTR( OpenGLInstanceArray )
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////////
@@ -838,6 +935,239 @@ class OpenGLLightFilter : public OpenGLObject
 IE_CORE_FORWARDDECLARE( OpenGLLightFilter )
 
 } // namespace
+//////////////////////////////////////////////////////////////////////////
+// BoundingVolumeHierarchy
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Hierarchy of bounding boxes for the objects in the renderer, used to
+// accelerate culling and spatial queries on the CPU. Entries are referred
+// to by their index in the vector of bounds passed to `build()`.
+class BoundingVolumeHierarchy
+{
+
+	public :
+
+		// Builds from scratch. Entries with empty or infinite bounds are
+		// omitted, and it is up to the caller to deal with them separately.
+		void build( const vector<Box3f> &bounds )
+		{
+			m_nodes.clear();
+			m_indices.clear();
+			for( uint32_t i = 0, e = bounds.size(); i < e; ++i )
+			{
+				if( included( bounds[i] ) )
+				{
+					m_indices.push_back( i );
+				}
+			}
+
+			if( m_indices.empty() )
+			{
+				return;
+			}
+
+			m_nodes.reserve( m_indices.size() );
+			buildWalk( bounds, 0, m_indices.size() );
+		}
+
+		// Updates the node bounds to account for changes to `bounds`, without
+		// changing the structure of the hierarchy. Returns false if this is not
+		// possible because entries need to be added or removed, in which case
+		// `build()` must be called instead.
+		bool refit( const vector<Box3f> &bounds )
+		{
+			size_t numIncluded = 0;
+			for( const auto &b : bounds )
+			{
+				numIncluded += included( b );
+			}
+			if( numIncluded != m_indices.size() )
+			{
+				return false;
+			}
+
+			// Children always follow their parent, so by iterating in reverse
+			// we visit children before parents.
+			for( size_t i = m_nodes.size(); i-- > 0; )
+			{
+				Node &node = m_nodes[i];
+				node.bound = Box3f();
+				if( node.count )
+				{
+					for( uint32_t j = node.first, e = node.first + node.count; j < e; ++j )
+					{
+						const Box3f &b = bounds[m_indices[j]];
+						if( !included( b ) )
+						{
+							return false;
+						}
+						node.bound.extendBy( b );
+					}
+				}
+				else
+				{
+					node.bound.extendBy( m_nodes[i+1].bound );
+					node.bound.extendBy( m_nodes[node.first].bound );
+				}
+			}
+
+			return true;
+		}
+
+		Box3f bound() const
+		{
+			return m_nodes.size() ? m_nodes[0].bound : Box3f();
+		}
+
+		// Calls `f( index )` for each entry whose bound passes `test( bound )`.
+		// The test is also applied to the bounds of the internal nodes, so
+		// must be conservative.
+		template<typename Test, typename F>
+		void visit( Test &&test, F &&f ) const
+		{
+			if( m_nodes.empty() )
+			{
+				return;
+			}
+
+			vector<uint32_t> stack = { 0 };
+			while( stack.size() )
+			{
+				const Node &node = m_nodes[stack.back()];
+				const uint32_t nodeIndex = stack.back();
+				stack.pop_back();
+				if( !test( node.bound ) )
+				{
+					continue;
+				}
+
+				if( node.count )
+				{
+					for( uint32_t j = node.first, e = node.first + node.count; j < e; ++j )
+					{
+						f( m_indices[j] );
+					}
+				}
+				else
+				{
+					stack.push_back( node.first );
+					stack.push_back( nodeIndex + 1 );
+				}
+			}
+		}
+
+		static bool included( const Box3f &b )
+		{
+			return !b.isEmpty() && !b.isInfinite();
+		}
+
+	private :
+
+		static constexpr uint32_t g_maxLeafSize = 4;
+
+		struct Node
+		{
+			Box3f bound;
+			// For leaf nodes, the range of entries in `m_indices`. For
+			// internal nodes, `count` is 0 and `first` is the index of the
+			// second child. The first child immediately follows the parent.
+			uint32_t first;
+			uint32_t count;
+		};
+
+		uint32_t buildWalk( const vector<Box3f> &bounds, uint32_t begin, uint32_t end )
+		{
+			const uint32_t nodeIndex = m_nodes.size();
+			m_nodes.push_back( { Box3f(), begin, end - begin } );
+
+			Box3f bound;
+			Box3f centroidBound;
+			for( uint32_t i = begin; i < end; ++i )
+			{
+				const Box3f &b = bounds[m_indices[i]];
+				bound.extendBy( b );
+				centroidBound.extendBy( b.center() );
+			}
+			m_nodes[nodeIndex].bound = bound;
+
+			if( end - begin <= g_maxLeafSize )
+			{
+				return nodeIndex;
+			}
+
+			// Split at the median along the longest axis of the centroids.
+
+			const int axis = centroidBound.majorAxis();
+			const uint32_t mid = begin + ( end - begin ) / 2;
+			std::nth_element(
+				m_indices.begin() + begin, m_indices.begin() + mid, m_indices.begin() + end,
+				[&bounds, axis] ( uint32_t a, uint32_t b ) {
+					return bounds[a].min[axis] + bounds[a].max[axis] < bounds[b].min[axis] + bounds[b].max[axis];
+				}
+			);
+
+			buildWalk( bounds, begin, mid );
+			const uint32_t secondChild = buildWalk( bounds, mid, end );
+			m_nodes[nodeIndex].first = secondChild;
+			m_nodes[nodeIndex].count = 0;
+
+			return nodeIndex;
+		}
+
+		vector<Node> m_nodes;
+		vector<uint32_t> m_indices;
+
+};
+
+// Clipping planes extracted from a world-to-clip matrix, as used for
+// culling against the current GL view.
+class Frustum
+{
+
+	public :
+
+		Frustum( const M44f &worldToClip )
+		{
+			const M44f &m = worldToClip;
+			auto column = [&m] ( int c ) { return V4f( m[0][c], m[1][c], m[2][c], m[3][c] ); };
+			m_planes[0] = column( 3 ) + column( 0 );
+			m_planes[1] = column( 3 ) - column( 0 );
+			m_planes[2] = column( 3 ) + column( 1 );
+			m_planes[3] = column( 3 ) - column( 1 );
+			m_planes[4] = column( 3 ) + column( 2 );
+			m_planes[5] = column( 3 ) - column( 2 );
+		}
+
+		// Conservative test : may return true for some boxes which
+		// are actually outside the frustum.
+		bool intersects( const Box3f &box ) const
+		{
+			for( const auto &p : m_planes )
+			{
+				const V3f corner(
+					p.x >= 0 ? box.max.x : box.min.x,
+					p.y >= 0 ? box.max.y : box.min.y,
+					p.z >= 0 ? box.max.z : box.min.z
+				);
+				if( p.x * corner.x + p.y * corner.y + p.z * corner.z + p.w < 0 )
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+	private :
+
+		V4f m_planes[6];
+
+};
+
+} // namespace
+
 //////////////////////////////////////////////////////////////////////////
 // OpenGLRenderer
 //////////////////////////////////////////////////////////////////////////
@@ -1000,6 +1330,37 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 			return object( name, samples.front(), attributes );
 		}
 
+		ObjectInterfacePtr instances( const std::string &name, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times, const IECore::CompoundObject *attributes, const InstanceArray &instances ) override
+		{
+			if( instances.attributes.size() || !m_renderObjects )
+			{
+				// Per-instance attributes require separate OpenGLAttributes for every
+				// instance, so there is nothing to be gained over the default expansion.
+				return Renderer::instances( name, samples, times, attributes, instances );
+			}
+
+			IECore::MessageHandler::Scope s( m_messageHandler.get() );
+
+			// Convert the prototype once, and share the result between all instances.
+			AttributesInterfacePtr openGLAttributes = this->attributes( attributes );
+			ConstOpenGLObjectPtr prototype = new OpenGLObject( name, samples.front(), static_cast<const OpenGLAttributes *>( openGLAttributes.get() ), m_editQueue );
+
+			OpenGLInstanceArrayPtr result = new OpenGLInstanceArray;
+			result->objects.reserve( instances.ids.size() );
+			const std::vector<M44f> &transforms = instances.transforms.front();
+			const std::string &namePrefix = instances.instanceNamePrefix.size() ? instances.instanceNamePrefix : name;
+			for( size_t i = 0; i < instances.ids.size(); ++i )
+			{
+				result->objects.push_back( new OpenGLObject( namePrefix + "/" + std::to_string( instances.ids[i] ), *prototype, transforms[i] ) );
+			}
+
+			// Add all the instances in a single edit, rather than one per instance.
+			m_editQueue.push( [this, result]() {
+				m_objects.insert( m_objects.end(), result->objects.begin(), result->objects.end() );
+			} );
+			return result;
+		}
+
 		void render() override
 		{
 			IECore::MessageHandler::Scope s( m_messageHandler.get() );
@@ -1041,6 +1402,14 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 			{
 				return querySelectedObjects( parameters );
 			}
+			else if( name == "gl:queryRay" )
+			{
+				return queryRay( parameters );
+			}
+			else if( name == "gl:queryFrustum" )
+			{
+				return queryFrustum( parameters );
+			}
 			else if( name == "gl:renderToCurrentContext" )
 			{
 				renderToCurrentContext( parameters );
@@ -1135,6 +1504,7 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 			// we do this using SceneView::deleteObjectFilter, but here, instead of setting up a filter,
 			// we just delete the camera from the list of things to render.
 			m_objects.erase( std::remove( m_objects.begin(), m_objects.end(), camera), m_objects.end() );
+			m_bvhDirty = true;
 
 			const V2i resolution = camera->getResolution();
 			IECoreGL::FrameBufferPtr frameBuffer = new FrameBuffer;
@@ -1178,6 +1548,7 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 			while( m_editQueue.try_pop( edit ) )
 			{
 				edit();
+				m_bvhDirty = true;
 			}
 		}
 
@@ -1203,6 +1574,7 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 				}
 			}
 
+			const size_t numObjects = m_objects.size();
 			m_objects.erase(
 				remove_if(
 					m_objects.begin(),
@@ -1211,6 +1583,7 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 				),
 				m_objects.end()
 			);
+			m_bvhDirty = m_bvhDirty || m_objects.size() != numObjects;
 
 			m_attributes.erase(
 				remove_if(
@@ -1226,17 +1599,83 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 		{
 			IECoreGL::Selector *selector = IECoreGL::Selector::currentSelector();
 
-			GLuint i = 1;
-			for( const auto &o : m_objects )
+			// Cull against the current view. Selectors restrict the projection
+			// to the region being selected, so this also accelerates selection.
+
+			M44f modelView;
+			M44f projection;
+			glGetFloatv( GL_MODELVIEW_MATRIX, modelView.getValue() );
+			glGetFloatv( GL_PROJECTION_MATRIX, projection.getValue() );
+			const vector<bool> visible = visibleObjects( Frustum( modelView * projection ) );
+
+			for( size_t i = 0, e = m_objects.size(); i < e; ++i )
 			{
+				if( !visible[i] )
+				{
+					continue;
+				}
 				if( selector )
 				{
-					selector->loadName( i++ );
+					// Names must match indices in `m_objects`, as expected by
+					// `querySelectedObjects()`.
+					selector->loadName( i + 1 );
 				}
-				o->render( currentState, m_selection, colorSpace );
+				m_objects[i]->render( currentState, m_selection, colorSpace );
 			}
 		}
 
+		// Updates `m_bvh` to reflect any edits made since the last call.
+		void updateBVH()
+		{
+			if( !m_bvhDirty )
+			{
+				return;
+			}
+
+			m_objectBounds.resize( m_objects.size() );
+			m_unboundedObjects.clear();
+			for( size_t i = 0, e = m_objects.size(); i < e; ++i )
+			{
+				m_objectBounds[i] = m_objects[i]->cullingBound();
+				if( !BoundingVolumeHierarchy::included( m_objectBounds[i] ) )
+				{
+					m_unboundedObjects.push_back( i );
+				}
+			}
+
+			// Refitting is much cheaper than rebuilding, and is sufficient
+			// when only transforms and attributes have been edited. When
+			// objects have been added or removed we must rebuild.
+			if( m_bvhNumObjects != m_objects.size() || !m_bvh.refit( m_objectBounds ) )
+			{
+				m_bvh.build( m_objectBounds );
+				m_bvhNumObjects = m_objects.size();
+			}
+
+			m_bvhDirty = false;
+		}
+
+		vector<bool> visibleObjects( const Frustum &frustum )
+		{
+			updateBVH();
+
+			vector<bool> result( m_objects.size(), false );
+			m_bvh.visit(
+				[&frustum] ( const Box3f &b ) { return frustum.intersects( b ); },
+				[&result] ( uint32_t i ) { result[i] = true; }
+			);
+
+			// Objects without a useful bound are never culled. Empty bounds
+			// are included in this, in case a renderable doesn't report its
+			// bound accurately.
+			for( auto i : m_unboundedObjects )
+			{
+				result[i] = true;
+			}
+
+			return result;
+		}
+
 		void writeOutputs( const FrameBuffer *frameBuffer )
 		{
 			IECore::MessageHandler::Scope s( m_messageHandler.get() );
@@ -1306,33 +1745,84 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 					continue;
 				}
 
-				result.extendBy( o->transformedBound() );
+				result.extendBy( o->framingBound() );
 			}
 			return new Box3fData( result );
 		}
 
-		DataPtr querySelectedObjects( const CompoundDataMap &parameters )
+		DataPtr queryRay( const CompoundDataMap &parameters )
 		{
-			ConstUIntVectorDataPtr names;
-			CompoundDataMap::const_iterator it = parameters.find( "selection" );
-			if( it != parameters.end() )
-			{
-				names = runTimeCast<const UIntVectorData>( it->second );
-			}
-			if( !names )
+			const V3f origin = parameter<V3f>( parameters, "origin", V3f( 0 ) );
+			const V3f direction = parameter<V3f>( parameters, "direction", V3f( 0, 0, -1 ) ).normalized();
+			const vector<IECore::TypeId> mask = maskTypeIds( parameters );
+
+			processQueue();
+			removeDeletedObjects();
+			updateBVH();
+
+			const Line3f ray( origin, origin + direction );
+			vector<std::pair<float, uint32_t>> hits;
+			m_bvh.visit(
+				[&ray] ( const Box3f &b ) { return Imath::intersects( b, ray ); },
+				[&] ( uint32_t i ) {
+					V3f hitPoint;
+					if( matchesMask( m_objects[i].get(), mask ) && Imath::intersects( m_objectBounds[i], ray, hitPoint ) )
+					{
+						hits.push_back( { ( hitPoint - origin ).dot( direction ), i } );
+					}
+				}
+			);
+
+			std::sort( hits.begin(), hits.end() );
+
+			StringVectorDataPtr pathsData = new StringVectorData;
+			FloatVectorDataPtr distancesData = new FloatVectorData;
+			for( const auto &[distance, i] : hits )
 			{
-				throw InvalidArgumentException( "Expected UIntVectorData \"selection\" parameter" );
+				pathsData->writable().push_back( GafferScene::ScenePlug::pathToString( m_objects[i]->name() ) );
+				distancesData->writable().push_back( distance );
 			}
 
-			vector<IECore::TypeId> maskTypeIds;
-			it = parameters.find( "mask" );
+			CompoundDataPtr result = new CompoundData;
+			result->writable()["paths"] = pathsData;
+			result->writable()["distances"] = distancesData;
+			return result;
+		}
+
+		DataPtr queryFrustum( const CompoundDataMap &parameters )
+		{
+			const Frustum frustum( parameter<M44f>( parameters, "worldToClip", M44f() ) );
+			const vector<IECore::TypeId> mask = maskTypeIds( parameters );
+
+			processQueue();
+			removeDeletedObjects();
+			updateBVH();
+
+			PathMatcherDataPtr result = new PathMatcherData;
+			m_bvh.visit(
+				[&frustum] ( const Box3f &b ) { return frustum.intersects( b ); },
+				[&] ( uint32_t i ) {
+					if( matchesMask( m_objects[i].get(), mask ) && frustum.intersects( m_objectBounds[i] ) )
+					{
+						result->writable().addPath( m_objects[i]->name() );
+					}
+				}
+			);
+
+			return result;
+		}
+
+		static vector<IECore::TypeId> maskTypeIds( const CompoundDataMap &parameters )
+		{
+			vector<IECore::TypeId> result;
+			auto it = parameters.find( "mask" );
 			if( it != parameters.end() )
 			{
 				if( ConstStringVectorDataPtr typeNames = runTimeCast<const StringVectorData>( it->second ) )
 				{
 					for( const auto &n : typeNames->readable() )
 					{
-						maskTypeIds.push_back( RunTimeTyped::typeIdFromTypeName( n.c_str() ) );
+						result.push_back( RunTimeTyped::typeIdFromTypeName( n.c_str() ) );
 					}
 				}
 				else
@@ -1342,20 +1832,45 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 			}
 			else
 			{
-				maskTypeIds.push_back( IECore::ObjectTypeId );
+				result.push_back( IECore::ObjectTypeId );
+			}
+			return result;
+		}
+
+		static bool matchesMask( const OpenGLObject *o, const vector<IECore::TypeId> &mask )
+		{
+			for( auto t : mask )
+			{
+				if( t == o->objectType() || RunTimeTyped::inheritsFrom( o->objectType(), t ) )
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		DataPtr querySelectedObjects( const CompoundDataMap &parameters )
+		{
+			ConstUIntVectorDataPtr names;
+			CompoundDataMap::const_iterator it = parameters.find( "selection" );
+			if( it != parameters.end() )
+			{
+				names = runTimeCast<const UIntVectorData>( it->second );
+			}
+			if( !names )
+			{
+				throw InvalidArgumentException( "Expected UIntVectorData \"selection\" parameter" );
 			}
 
+			const vector<IECore::TypeId> mask = maskTypeIds( parameters );
+
 			PathMatcher result;
 			for( auto i : names->readable() )
 			{
 				const OpenGLObject *o = m_objects[i-1].get();
-				for( auto t : maskTypeIds )
+				if( matchesMask( o, mask ) )
 				{
-					if( t == o->objectType() || RunTimeTyped::inheritsFrom( o->objectType(), t ) )
-					{
-						result.addPath( o->name() );
-						break;
-					}
+					result.addPath( o->name() );
 				}
 			}
 
@@ -1401,6 +1916,15 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 		using OpenGLAttributesVector = std::vector<OpenGLAttributesPtr>;
 		OpenGLAttributesVector m_attributes;
 
+		// Acceleration structure for culling and spatial queries, updated
+		// lazily by `updateBVH()`. `m_objectBounds` holds the culling bound
+		// for each entry in `m_objects`.
+		bool m_bvhDirty = true;
+		size_t m_bvhNumObjects = 0;
+		vector<Box3f> m_objectBounds;
+		vector<size_t> m_unboundedObjects;
+		BoundingVolumeHierarchy m_bvh;
+
 		// Registration with factory
 		static Renderer::TypeDescription<OpenGLRenderer> g_typeDescription;
 
@@ -41,6 +41,8 @@
 
 #include "fmt/format.h"
 
+#include <algorithm>
+
 using namespace std;
 using namespace IECore;
 using namespace IECoreScenePreview;
@@ -92,6 +94,16 @@ const CapturingRenderer::CapturedObject *CapturingRenderer::capturedObject( cons
 	return nullptr;
 }
 
+std::vector<std::string> CapturingRenderer::capturedInstanceArrayNames() const
+{
+	std::vector<std::string> result;
+	for( auto &i : m_capturedInstanceArrays )
+	{
+		result.push_back( i.first );
+	}
+	return result;
+}
+
 IECore::InternedString CapturingRenderer::name() const
 {
 	return "Capturing";
@@ -177,6 +189,46 @@ Renderer::ObjectInterfacePtr CapturingRenderer::object( const std::string &name,
 	return result;
 }
 
+Renderer::ObjectInterfacePtr CapturingRenderer::instances( const std::string &name, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times, const IECore::CompoundObject *attributes, const InstanceArray &instances )
+{
+	checkPaused();
+
+	// Validate the array, so that tests catch malformed arrays even though
+	// the default expansion might tolerate them.
+
+	const size_t size = instances.ids.size();
+	const size_t numTransforms = std::max<size_t>( instances.transformTimes.size(), 1 );
+	if( instances.transforms.size() != numTransforms )
+	{
+		throw IECore::Exception( fmt::format( "Instance array \"{}\" has {} transform samples but expected {}", name, instances.transforms.size(), numTransforms ) );
+	}
+	for( const auto &t : instances.transforms )
+	{
+		if( t.size() != size )
+		{
+			throw IECore::Exception( fmt::format( "Instance array \"{}\" has {} transforms but {} ids", name, t.size(), size ) );
+		}
+	}
+	if( instances.attributes.size() && instances.attributeIndices.size() != size )
+	{
+		throw IECore::Exception( fmt::format( "Instance array \"{}\" has {} attribute indices but {} ids", name, instances.attributeIndices.size(), size ) );
+	}
+	if( instances.instanceIDs.size() && instances.instanceIDs.size() != size )
+	{
+		throw IECore::Exception( fmt::format( "Instance array \"{}\" has {} instance IDs but {} ids", name, instances.instanceIDs.size(), size ) );
+	}
+
+	{
+		InstanceArrayMap::accessor a;
+		m_capturedInstanceArrays.insert( a, name );
+		a->second += size;
+	}
+
+	// Capture the instances as individual objects, so they can be
+	// introspected in the usual way.
+	return Renderer::instances( name, samples, times, attributes, instances );
+}
+
 void CapturingRenderer::render()
 {
 	IECore::MessageHandler::Scope s( m_messageHandler.get() );
@@ -407,6 +407,16 @@ Renderer::ObjectInterfacePtr CompoundRenderer::object( const std::string &name,
 	return result;
 }
 
+Renderer::ObjectInterfacePtr CompoundRenderer::instances( const std::string &name, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times, const IECore::CompoundObject *attributes, const InstanceArray &instances )
+{
+	CompoundObjectInterfacePtr result = new CompoundObjectInterface;
+	for( size_t i = 0; i < m_renderers.size(); ++i )
+	{
+		result->objects[i] = m_renderers[i]->instances( name, samples, times, attributes, instances );
+	}
+	return result;
+}
+
 void CompoundRenderer::render()
 {
 	for( auto &r : m_renderers )
@@ -39,6 +39,9 @@
 #include "IECoreScene/PrimitiveVariable.h"
 #include "IECoreScene/MeshPrimitive.h"
 
+#include "Gaffer/Private/CacheRegistry.h"
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
+
 #include "IECore/DataAlgo.h"
 #include "IECore/TypeTraits.h"
 
@@ -47,8 +50,10 @@
 #include <opensubdiv/bfr/tessellation.h>
 #include <opensubdiv/far/topologyDescriptor.h>
 
-#include <unordered_map>
+#include <algorithm>
 #include <numeric>
+#include <optional>
+#include <unordered_map>
 
 #include "fmt/format.h"
 
@@ -561,6 +566,181 @@ struct MutexWriteGuard
 using SurfaceFactoryCache = OSDB::SurfaceFactoryCacheThreaded<tbb::spin_rw_mutex, MutexReadGuard, MutexWriteGuard>;
 using SurfaceFactory = OSDB::RefinerSurfaceFactory<SurfaceFactoryCache>;
 
+// The tessellation rate for each edge of the mesh. For uniform tessellation this is the same
+// for every edge, but for adaptive tessellation it varies. In both cases, the rate belongs to
+// the edge rather than to the faces on either side of it, so the faces agree on the number of
+// points along it, and the output is watertight.
+struct TessellationRates
+{
+
+	TessellationRates( int uniformRate )
+		:	uniformRate( uniformRate )
+	{
+	}
+
+	bool uniform() const
+	{
+		return edgeRates.empty();
+	}
+
+	int edgeRate( OSDF::Index edgeIndex ) const
+	{
+		return edgeRates.empty() ? uniformRate : edgeRates[edgeIndex];
+	}
+
+	// Initialises `pattern` for the face with the specified edges.
+	void initTessellation(
+		std::optional<OSDB::Tessellation> &pattern, const OSDB::Parameterization &parameterization,
+		const OSDF::ConstIndexArray &fEdges, const OSDB::Tessellation::Options &options,
+		std::vector<int> &faceRates
+	) const
+	{
+		pattern.reset();
+		if( uniform() )
+		{
+			pattern.emplace( parameterization, uniformRate, options );
+		}
+		else
+		{
+			faceRates.resize( fEdges.size() );
+			for( int i = 0; i < fEdges.size(); ++i )
+			{
+				faceRates[i] = edgeRates[fEdges[i]];
+			}
+			pattern.emplace( parameterization, (int)faceRates.size(), faceRates.data(), options );
+		}
+	}
+
+	// Maximum rate when `edgeRates` is used.
+	const int uniformRate;
+	std::vector<int> edgeRates;
+
+};
+
+// Control mesh angle at which adaptive tessellation reaches the maximum rate.
+const float g_adaptiveMaxAngle = M_PI / 4.0f;
+
+// Computes edge rates for adaptive tessellation, according to the curvature of the
+// control mesh. Curvature is measured at each vertex as the greatest angle between
+// the normals of faces sharing an edge with the vertex, and each edge uses the greater
+// curvature of its two vertices. This accounts for the full neighbourhood that influences
+// the limit surface near the edge.
+std::vector<int> adaptiveEdgeRates( const OSDF::TopologyLevel &level, const PrimitiveVariable &pVariable, int maxRate, const IECore::Canceller *canceller )
+{
+	const PrimitiveVariable::IndexedView<Imath::V3f> p( pVariable );
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+
+	const int numFaces = level.GetNumFaces();
+	std::vector<Imath::V3f> faceNormals( numFaces );
+	tbb::parallel_for(
+		tbb::blocked_range<int>( 0, numFaces ),
+		[&]( const tbb::blocked_range<int> &range )
+		{
+			for( int faceIndex = range.begin(); faceIndex != range.end(); ++faceIndex )
+			{
+				Canceller::check( canceller );
+				if( level.IsFaceHole( faceIndex ) )
+				{
+					faceNormals[faceIndex] = Imath::V3f( 0 );
+					continue;
+				}
+				// Newell's method, which is robust for non-planar polygons.
+				const OSDF::ConstIndexArray fVerts = level.GetFaceVertices( faceIndex );
+				Imath::V3f n( 0 );
+				for( int i = 0; i < fVerts.size(); ++i )
+				{
+					const Imath::V3f &p0 = p[fVerts[i]];
+					const Imath::V3f &p1 = p[fVerts[( i + 1 ) % fVerts.size()]];
+					n.x += ( p0.y - p1.y ) * ( p0.z + p1.z );
+					n.y += ( p0.z - p1.z ) * ( p0.x + p1.x );
+					n.z += ( p0.x - p1.x ) * ( p0.y + p1.y );
+				}
+				const float length = n.length();
+				faceNormals[faceIndex] = length > 0.0f ? n / length : Imath::V3f( 0 );
+			}
+		},
+		taskGroupContext
+	);
+
+	const int numEdges = level.GetNumEdges();
+	std::vector<float> edgeAngles( numEdges );
+	tbb::parallel_for(
+		tbb::blocked_range<int>( 0, numEdges ),
+		[&]( const tbb::blocked_range<int> &range )
+		{
+			for( int edgeIndex = range.begin(); edgeIndex != range.end(); ++edgeIndex )
+			{
+				Canceller::check( canceller );
+				const OSDF::ConstIndexArray eFaces = level.GetEdgeFaces( edgeIndex );
+				float angle = 0.0f;
+				for( int i = 1; i < eFaces.size(); ++i )
+				{
+					const Imath::V3f &n0 = faceNormals[eFaces[0]];
+					const Imath::V3f &n1 = faceNormals[eFaces[i]];
+					if( n0 != Imath::V3f( 0 ) && n1 != Imath::V3f( 0 ) )
+					{
+						angle = std::max( angle, std::acos( std::clamp( n0.dot( n1 ), -1.0f, 1.0f ) ) );
+					}
+				}
+				edgeAngles[edgeIndex] = angle;
+			}
+		},
+		taskGroupContext
+	);
+
+	const int numVertices = level.GetNumVertices();
+	std::vector<float> vertexAngles( numVertices );
+	tbb::parallel_for(
+		tbb::blocked_range<int>( 0, numVertices ),
+		[&]( const tbb::blocked_range<int> &range )
+		{
+			for( int vertexIndex = range.begin(); vertexIndex != range.end(); ++vertexIndex )
+			{
+				Canceller::check( canceller );
+				float angle = 0.0f;
+				for( OSDF::Index e : level.GetVertexEdges( vertexIndex ) )
+				{
+					angle = std::max( angle, edgeAngles[e] );
+				}
+				vertexAngles[vertexIndex] = angle;
+			}
+		},
+		taskGroupContext
+	);
+
+	std::vector<int> result( numEdges );
+	tbb::parallel_for(
+		tbb::blocked_range<int>( 0, numEdges ),
+		[&]( const tbb::blocked_range<int> &range )
+		{
+			for( int edgeIndex = range.begin(); edgeIndex != range.end(); ++edgeIndex )
+			{
+				const OSDF::ConstIndexArray eVerts = level.GetEdgeVertices( edgeIndex );
+				const float angle = std::max( vertexAngles[eVerts[0]], vertexAngles[eVerts[1]] );
+				const float t = std::min( 1.0f, angle / g_adaptiveMaxAngle );
+				result[edgeIndex] = 1 + (int)std::ceil( ( maxRate - 1 ) * t );
+			}
+		},
+		taskGroupContext
+	);
+
+	return result;
+}
+
+// Counts the quads which OpenSubdiv will output as triangles, by setting one of their
+// vertex indices to -1. This is only needed for adaptive tessellation; see
+// `numDegenerateQuadsInTessellation()` for the uniform case.
+int countDegenerateQuads( const OSDB::Tessellation &tessPattern, std::vector<int> &buffer )
+{
+	if( tessPattern.GetFacetSize() != 4 )
+	{
+		return 0;
+	}
+	buffer.resize( tessPattern.GetNumFacets() * 4 );
+	tessPattern.GetFacets( buffer.data() );
+	return std::count( buffer.begin(), buffer.end(), -1 );
+}
+
 
 // In order to output a watertight mesh, we need to share output vertices and edges where the input vertices
 // and edges are shared. To do this, we assign each edge and vertex one of the faces it touches as its owner.
@@ -604,7 +784,7 @@ struct PrimvarTopology
 		m_edgeOwners.resize( m_mesh.GetNumEdges(), { -1, -1, false } );
 	}
 
-	inline void addFace( int faceIndex, const OSDB::Tessellation &tessPattern, const OSDF::ConstIndexArray &fVerts, const OSDF::ConstIndexArray &fEdges, int tessUniformRate )
+	inline void addFace( int faceIndex, const OSDB::Tessellation &tessPattern, const OSDF::ConstIndexArray &fVerts, const OSDF::ConstIndexArray &fEdges, const TessellationRates &rates )
 	{
 		OSDF::ConstIndexArray fvarValues;
 		if( m_faceVaryingChannel != -1 )
@@ -669,7 +849,7 @@ struct PrimvarTopology
 			}
 
 			OSDF::Index edgeIndex = fEdges[i];
-			int edgeRate = tessUniformRate;
+			int edgeRate = rates.edgeRate( edgeIndex );
 			if( edgeRate > 1 )
 			{
 				int pointsPerEdge = edgeRate - 1;
@@ -786,7 +966,7 @@ template <class T>
 void tessellateVariable(
 	const OSDB::Surface<float> &surface, int faceIndex,
 	const OSDF::ConstIndexArray &fVerts, const OSDF::ConstIndexArray &fEdges,
-	int tessUniformRate, const OSDB::Tessellation &tessPattern, const std::vector< Imath::V2f > &coords,
+	const TessellationRates &rates, const OSDB::Tessellation &tessPattern, const std::vector< Imath::V2f > &coords,
 	const PrimvarTopology &primvarTopology,
 	TessellationTempBuffers &buffers,
 	PrimvarSetup &setup,
@@ -907,7 +1087,7 @@ void tessellateVariable(
 		boundaryIndex++;
 
 		OSDF::Index edgeIndex = fEdges[i];
-		int edgeRate = tessUniformRate;
+		int edgeRate = rates.edgeRate( edgeIndex );
 
 		// Now handle an edge
 
@@ -998,9 +1178,12 @@ void tessellateVariable(
 
 		// If we are writing out quad facets, but the face is irregular, and the tessellation rate is odd,
 		// then OpenSubDiv will write out some quad facets that are actually triangles, labelled with one vert
-		// set to -1. In order to output accurate topology, we need to collapse this list, removing -1s, and
+		// set to -1. The same applies to the transitions between differing rates in adaptive tessellation.
+		// In order to output accurate topology, we need to collapse this list, removing -1s, and
 		// adjusting the vertex counts of corresponding faces.
-		const bool needsCollapse = tessPattern.GetFacetSize() == 4 && fVerts.size() != 4 && ( tessUniformRate & 1 );
+		const bool needsCollapse = tessPattern.GetFacetSize() == 4 && (
+			!rates.uniform() || ( fVerts.size() != 4 && ( rates.uniformRate & 1 ) )
+		);
 
 		int *outIndices;
 		if( needsCollapse )
@@ -1065,7 +1248,7 @@ void tessellateVariable(
 void tessellateVariables(
 	const SurfaceFactory &meshSurfaceFactory, const OSDB::Tessellation &tessPattern,
 	int faceIndex, OSDF::ConstIndexArray fVerts, OSDF::ConstIndexArray fEdges,
-	int tessUniformRate, const std::vector<Imath::V2f> &tessCoords,
+	const TessellationRates &rates, const std::vector<Imath::V2f> &tessCoords,
 	std::vector<int> &outVerticesPerFace, int faceFacetOffset, int faceFacetVertexOffset,
 	const PrimvarTopology &vertexTopology, const OSDB::Surface<float> &vertexSurface,
 	PrimvarSetup &posPrimvarSetup, std::vector<Imath::V3f> &outNormals,
@@ -1078,7 +1261,7 @@ void tessellateVariables(
 	const int numFacets = tessPattern.GetNumFacets();
 
 	tessellateVariable<Imath::V3f>(
-		vertexSurface, faceIndex, fVerts, fEdges, tessUniformRate, tessPattern, tessCoords,
+		vertexSurface, faceIndex, fVerts, fEdges, rates, tessPattern, tessCoords,
 		vertexTopology,
 		buffers,
 		posPrimvarSetup, canceller, faceFacetVertexOffset,
@@ -1094,7 +1277,7 @@ void tessellateVariables(
 				using ElementType = typename std::remove_pointer_t< decltype( typedData ) >::ValueType::value_type;
 
 				tessellateVariable<ElementType>(
-					vertexSurface, faceIndex, fVerts, fEdges, tessUniformRate, tessPattern, tessCoords,
+					vertexSurface, faceIndex, fVerts, fEdges, rates, tessPattern, tessCoords,
 					vertexTopology,
 					buffers,
 					setup, canceller, faceFacetVertexOffset
@@ -1125,7 +1308,7 @@ void tessellateVariables(
 			{
 				using ElementType = typename std::remove_pointer_t< decltype( typedData ) >::ValueType::value_type;
 				tessellateVariable<ElementType>(
-					buffers.faceVaryingSurface, faceIndex, fVerts, fEdges, tessUniformRate, tessPattern, tessCoords,
+					buffers.faceVaryingSurface, faceIndex, fVerts, fEdges, rates, tessPattern, tessCoords,
 					faceVaryingTopologies[i],
 					buffers,
 					faceVaryingPrimvarSetups[i], canceller, faceFacetVertexOffset
@@ -1136,12 +1319,10 @@ void tessellateVariables(
 }
 
 // When OpenSubdiv outputs quads, it sometimes actually makes a triangle by setting one of the 4 vertex indices
-// of a quad to -1. We can currently predict exactly when this happens using these heuristics.
+// of a quad to -1. For uniform tessellation we can predict exactly when this happens using these heuristics.
 //
-// Once we support adaptive subdivision, this logic gets a lot more complicated, and OpenSubdiv doesn't offer
-// a way to query it without getting the full list of facet vertex indices - we'll probably need to either
-// get the facet vertex indices an extra time during the first pass ( or get them and store them for later reuse ),
-// and manually count how many -1s are in the list.
+// For adaptive tessellation this logic gets a lot more complicated, and OpenSubdiv doesn't offer a way to
+// query it without getting the full list of facet vertex indices, so we use `countDegenerateQuads()` instead.
 int numDegenerateQuadsInTessellation( int tessFacetSize, int nVerts, int tessUniformRate )
 {
 	if( tessFacetSize != 4 )
@@ -1234,13 +1415,107 @@ OpenSubdiv::Sdc::Options::TriangleSubdivision triangleSubdivisionFromString( con
 	}
 }
 
+// Topology cache
+// ==============
+//
+// Creating the TopologyRefiner and SurfaceFactory depends only on the topology
+// of the mesh, so we cache them for reuse by subsequent tessellations of the same
+// topology. This is particularly beneficial for deforming meshes, where the topology
+// is the same on every frame, and it also preserves the SurfaceFactory's cache of
+// irregular patches, which can be expensive to compute.
+
+struct Refiner
+{
+	std::unique_ptr<OSDF::TopologyRefiner> topologyRefiner;
+	std::unique_ptr<SurfaceFactory> surfaceFactory;
+};
+
+using ConstRefinerPtr = std::shared_ptr<const Refiner>;
+
+struct RefinerCacheGetterKey
+{
+
+	RefinerCacheGetterKey( const OSDF::TopologyDescriptor &descriptor, OpenSubdiv::Sdc::SchemeType scheme, const OpenSubdiv::Sdc::Options &options )
+		:	descriptor( descriptor ), scheme( scheme ), options( options )
+	{
+		const int numFaceVertices = std::accumulate( descriptor.numVertsPerFace, descriptor.numVertsPerFace + descriptor.numFaces, 0 );
+
+		hash.append( descriptor.numVertices );
+		hash.append( descriptor.numVertsPerFace, descriptor.numFaces );
+		hash.append( descriptor.vertIndicesPerFace, numFaceVertices );
+		hash.append( descriptor.numCorners );
+		hash.append( descriptor.cornerVertexIndices, descriptor.numCorners );
+		hash.append( descriptor.cornerWeights, descriptor.numCorners );
+		hash.append( descriptor.numCreases );
+		hash.append( descriptor.creaseVertexIndexPairs, descriptor.numCreases * 2 );
+		hash.append( descriptor.creaseWeights, descriptor.numCreases );
+		hash.append( descriptor.numFVarChannels );
+		for( int i = 0; i < descriptor.numFVarChannels; ++i )
+		{
+			hash.append( descriptor.fvarChannels[i].numValues );
+			hash.append( descriptor.fvarChannels[i].valueIndices, numFaceVertices );
+		}
+		hash.append( (int)scheme );
+		hash.append( (int)options.GetVtxBoundaryInterpolation() );
+		hash.append( (int)options.GetFVarLinearInterpolation() );
+		hash.append( (int)options.GetTriangleSubdivision() );
+	}
+
+	operator const IECore::MurmurHash & () const
+	{
+		return hash;
+	}
+
+	IECore::MurmurHash hash;
+	const OSDF::TopologyDescriptor &descriptor;
+	const OpenSubdiv::Sdc::SchemeType scheme;
+	const OpenSubdiv::Sdc::Options options;
+
+};
+
+const size_t g_refinerBytesPerFaceVertex = 64;
+
+ConstRefinerPtr refinerCacheGetter( const RefinerCacheGetterKey &key, size_t &cost, const IECore::Canceller *canceller )
+{
+	using Factory = OSDF::TopologyRefinerFactory<OSDF::TopologyDescriptor>;
+
+	auto result = std::make_shared<Refiner>();
+	Canceller::check( canceller );
+	result->topologyRefiner.reset( Factory::Create( key.descriptor, Factory::Options( key.scheme, key.options ) ) );
+	if( !result->topologyRefiner )
+	{
+		throw IECore::Exception( "Unable to create OpenSubdiv topology refiner" );
+	}
+
+	Canceller::check( canceller );
+	result->surfaceFactory = std::make_unique<SurfaceFactory>( *result->topologyRefiner, SurfaceFactory::Options() );
+
+	// The refiner stores several relations for each face-vertex (face-vertices,
+	// vertex-faces, edges and their inverses), so we estimate its memory usage
+	// from the number of face-vertices.
+	cost = sizeof( Refiner ) + result->topologyRefiner->GetLevel( 0 ).GetNumFaceVertices() * g_refinerBytesPerFaceVertex;
+	return result;
+}
+
+using RefinerCache = IECorePreview::LRUCache<IECore::MurmurHash, ConstRefinerPtr, IECorePreview::LRUCachePolicy::Parallel, RefinerCacheGetterKey>;
+
+RefinerCache &refinerCache()
+{
+	static RefinerCache *g_cache = [] {
+		auto cache = new RefinerCache( refinerCacheGetter, 0, RefinerCache::RemovalCallback(), /* cacheErrors = */ false );
+		Gaffer::Private::registerCache( cache, 1.0f / 16.0f );
+		return cache;
+	}();
+	return *g_cache;
+}
+
 } // namespace
 
 MeshPrimitivePtr MeshAlgo::tessellateMesh(
 	const MeshPrimitive &inputMesh, int divisions,
 	bool calculateNormals, IECore::InternedString scheme,
 	IECore::InternedString interpolateBoundary, IECore::InternedString faceVaryingLinearInterpolation,
-	IECore::InternedString triangleSubdivisionRule,
+	IECore::InternedString triangleSubdivisionRule, bool adaptive,
 	const IECore::Canceller *canceller
 )
 {
@@ -1249,8 +1524,6 @@ MeshPrimitivePtr MeshAlgo::tessellateMesh(
 		return inputMesh.copy();
 	}
 
-	const int tessUniformRate = divisions + 1;
-
 	if( !scheme.string().size() )
 	{
 		scheme = inputMesh.interpolation();
@@ -1355,14 +1628,11 @@ MeshPrimitivePtr MeshAlgo::tessellateMesh(
 	}
 	desc.fvarChannels = channels.data();
 
-	// Instantiate a FarTopologyRefiner from the descriptor
-	Canceller::check( canceller );
-	std::unique_ptr<OSDF::TopologyRefiner> refiner( OSDF::TopologyRefinerFactory<Descriptor>::Create(desc, OSDF::TopologyRefinerFactory<Descriptor>::Options(osScheme, options)) );
-
-	SurfaceFactory::Options surfaceOptions;
-
+	// Get a FarTopologyRefiner for the descriptor, reusing a previous one if
+	// we've already seen this topology.
 	Canceller::check( canceller );
-	SurfaceFactory meshSurfaceFactory( *refiner, surfaceOptions);
+	ConstRefinerPtr refiner = refinerCache().get( RefinerCacheGetterKey( desc, osScheme, options ), canceller );
+	const SurfaceFactory &meshSurfaceFactory = *refiner->surfaceFactory;
 
 	OSDB::Tessellation::Options tessOptions;
 	// We use quads except for Loop subdivision which uses tris.
@@ -1373,10 +1643,14 @@ MeshPrimitivePtr MeshAlgo::tessellateMesh(
 	// baseLevel gives us our original mesh back, but with all the adjacency information computed that OpenSubdiv
 	// requires. Since OpenSubdiv needs the adjacency information anyway, we might as well use that when we're
 	// figuring out shared vertices.
-	OSDF::TopologyLevel const & baseLevel = refiner->GetLevel(0);
+	OSDF::TopologyLevel const & baseLevel = refiner->topologyRefiner->GetLevel(0);
 
-	// If we were doing adaptive tessellation, here would be the place to prepare a list of tessellation rates
-	// per edge that would be referenced below in place of tessUniformRate, to ensure consistency.
+	// Rates are stored per edge, and referenced by all faces sharing the edge, to ensure consistency.
+	TessellationRates rates( divisions + 1 );
+	if( adaptive && rates.uniformRate > 1 )
+	{
+		rates.edgeRates = adaptiveEdgeRates( baseLevel, inputMesh.variables.at( "P" ), rates.uniformRate, canceller );
+	}
 
 	const int numFaces = baseLevel.GetNumFaces();
 
@@ -1418,6 +1692,9 @@ MeshPrimitivePtr MeshAlgo::tessellateMesh(
 		[&]( tbb::blocked_range<int> &range )
 		{
 			OSDB::Surface<float> faceSurface;
+			std::optional<OSDB::Tessellation> tessPattern;
+			std::vector<int> faceRates;
+			std::vector<int> facetsBuffer;
 
 			for( int faceIndex = range.begin(); faceIndex != range.end(); ++faceIndex )
 			{
@@ -1439,20 +1716,21 @@ MeshPrimitivePtr MeshAlgo::tessellateMesh(
 				OSDF::ConstIndexArray fVerts = baseLevel.GetFaceVertices(faceIndex);
 				OSDF::ConstIndexArray fEdges = baseLevel.GetFaceEdges(faceIndex);
 
-				OSDB::Tessellation tessPattern(
-					faceSurface.GetParameterization(), tessUniformRate, tessOptions
-				);
+				rates.initTessellation( tessPattern, faceSurface.GetParameterization(), fEdges, tessOptions, faceRates );
 
-				faceFacetOffsets[ faceIndex ] = tessPattern.GetNumFacets();
+				faceFacetOffsets[ faceIndex ] = tessPattern->GetNumFacets();
 				faceFacetVertexOffsets[ faceIndex ] =
-					tessPattern.GetNumFacets() * tessFacetSize -
-					numDegenerateQuadsInTessellation( tessFacetSize, fVerts.size(), tessUniformRate );
+					tessPattern->GetNumFacets() * tessFacetSize - (
+						rates.uniform() ?
+						numDegenerateQuadsInTessellation( tessFacetSize, fVerts.size(), rates.uniformRate ) :
+						countDegenerateQuads( *tessPattern, facetsBuffer )
+					);
 
-				vertexTopology.addFace( faceIndex, tessPattern, fVerts, fEdges, tessUniformRate );
+				vertexTopology.addFace( faceIndex, *tessPattern, fVerts, fEdges, rates );
 
 				for( PrimvarTopology &t : faceVaryingTopologies )
 				{
-					t.addFace( faceIndex, tessPattern, fVerts, fEdges, tessUniformRate );
+					t.addFace( faceIndex, *tessPattern, fVerts, fEdges, rates );
 				}
 			}
 		},
@@ -1518,6 +1796,8 @@ MeshPrimitivePtr MeshAlgo::tessellateMesh(
 		{
 			OSDB::Surface<float> vertexSurface;
 			std::vector<Imath::V2f> tessCoords;
+			std::optional<OSDB::Tessellation> tessPattern;
+			std::vector<int> faceRates;
 
 			TessellationTempBuffers tessellationTempBuffers;
 
@@ -1533,18 +1813,19 @@ MeshPrimitivePtr MeshAlgo::tessellateMesh(
 				}
 
 				//
-				// Declare a simple uniform Tessellation for the Parameterization
-				// of this face and identify coordinates of the points to evaluate:
+				// Declare a Tessellation for the Parameterization of this face
+				// and identify coordinates of the points to evaluate:
 				//
-				OSDB::Tessellation tessPattern( vertexSurface.GetParameterization(), tessUniformRate, tessOptions );
+				const OSDF::ConstIndexArray fEdges = baseLevel.GetFaceEdges( faceIndex );
+				rates.initTessellation( tessPattern, vertexSurface.GetParameterization(), fEdges, tessOptions, faceRates );
 
-				tessCoords.resize( tessPattern.GetNumCoords() );
-				tessPattern.GetCoords( (float*)tessCoords.data() );
+				tessCoords.resize( tessPattern->GetNumCoords() );
+				tessPattern->GetCoords( (float*)tessCoords.data() );
 
 				tessellateVariables(
-					meshSurfaceFactory, tessPattern,
-					faceIndex, baseLevel.GetFaceVertices( faceIndex ), baseLevel.GetFaceEdges( faceIndex ),
-					tessUniformRate, tessCoords,
+					meshSurfaceFactory, *tessPattern,
+					faceIndex, baseLevel.GetFaceVertices( faceIndex ), fEdges,
+					rates, tessCoords,
 					outVerticesPerFace, faceFacetOffsets[faceIndex], faceFacetVertexOffsets[faceIndex],
 					vertexTopology, vertexSurface, posPrimvarSetup, outNormals,
 					vertexPrimvarSetups, uniformPrimvarSetups,
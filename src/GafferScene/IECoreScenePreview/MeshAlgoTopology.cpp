@@ -0,0 +1,112 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2026, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "GafferScene/Private/IECoreScenePreview/MeshAlgo.h"
+
+#include "Gaffer/Private/CacheRegistry.h"
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
+
+using namespace IECore;
+using namespace IECoreScene;
+using namespace IECoreScenePreview;
+
+namespace
+{
+
+struct TopologyDataCacheGetterKey
+{
+
+	TopologyDataCacheGetterKey( const MeshPrimitive &mesh, const IECore::MurmurHash &key, const MeshAlgo::TopologyDataFunction &function )
+		:	hash( MeshAlgo::topologyHash( mesh ) ), mesh( mesh ), function( function )
+	{
+		hash.append( key );
+	}
+
+	operator const IECore::MurmurHash & () const
+	{
+		return hash;
+	}
+
+	IECore::MurmurHash hash;
+	const MeshPrimitive &mesh;
+	const MeshAlgo::TopologyDataFunction &function;
+
+};
+
+ConstDataPtr topologyDataCacheGetter( const TopologyDataCacheGetterKey &key, size_t &cost, const IECore::Canceller *canceller )
+{
+	ConstDataPtr result = key.function( key.mesh, canceller );
+	if( !result )
+	{
+		throw IECore::Exception( "Topology data function returned null" );
+	}
+	cost = result->memoryUsage();
+	return result;
+}
+
+// TopologyDataFunctions are free to use TBB internally.
+using TopologyDataCache = IECorePreview::LRUCache<IECore::MurmurHash, ConstDataPtr, IECorePreview::LRUCachePolicy::TaskParallel, TopologyDataCacheGetterKey>;
+
+TopologyDataCache &topologyDataCache()
+{
+	static TopologyDataCache *g_cache = [] {
+		auto cache = new TopologyDataCache( topologyDataCacheGetter, 0, TopologyDataCache::RemovalCallback(), /* cacheErrors = */ false );
+		Gaffer::Private::registerCache( cache, 1.0f / 16.0f );
+		return cache;
+	}();
+	return *g_cache;
+}
+
+} // namespace
+
+IECore::MurmurHash MeshAlgo::topologyHash( const MeshPrimitive &mesh )
+{
+	// The hashes for the data are cached internally by IECore, so this
+	// is cheap for meshes whose topology data is shared between frames.
+	IECore::MurmurHash result;
+	result.append( (uint64_t)mesh.variableSize( PrimitiveVariable::Vertex ) );
+	mesh.verticesPerFace()->hash( result );
+	mesh.vertexIds()->hash( result );
+	return result;
+}
+
+IECore::ConstDataPtr MeshAlgo::cachedTopologyData(
+	const MeshPrimitive &mesh, const IECore::MurmurHash &key,
+	const TopologyDataFunction &function, const IECore::Canceller *canceller
+)
+{
+	return topologyDataCache().get( TopologyDataCacheGetterKey( mesh, key, function ), canceller );
+}
@@ -47,7 +47,9 @@
 #include "fmt/format.h"
 
 #include "tbb/parallel_for.h"
+#include "tbb/spin_mutex.h"
 
+#include <algorithm>
 #include <numeric>
 #include <unordered_map>
 #include <unordered_set>
@@ -162,114 +164,200 @@ void dataResize( Data *data, size_t size )
 	);
 }
 
+bool isAffine( const Imath::M44f &m )
+{
+	return m[0][3] == 0.0f && m[1][3] == 0.0f && m[2][3] == 0.0f && m[3][3] == 1.0f;
+}
+
+// Equivalent to `p * matrix` for affine matrices, but without the projective divide.
+// Each element is loaded before anything is stored, so that `source` and `dest` may
+// be the same, and the loop is simple enough for the compiler to vectorise.
+inline void transformPointsAffine( const Imath::V3f *source, Imath::V3f *dest, size_t numElements, const Imath::M44f &matrix )
+{
+	const float m00 = matrix[0][0], m01 = matrix[0][1], m02 = matrix[0][2];
+	const float m10 = matrix[1][0], m11 = matrix[1][1], m12 = matrix[1][2];
+	const float m20 = matrix[2][0], m21 = matrix[2][1], m22 = matrix[2][2];
+	const float m30 = matrix[3][0], m31 = matrix[3][1], m32 = matrix[3][2];
+
+	for( size_t i = 0; i < numElements; i++ )
+	{
+		const float x = source[i].x;
+		const float y = source[i].y;
+		const float z = source[i].z;
+		dest[i].x = x * m00 + y * m10 + z * m20 + m30;
+		dest[i].y = x * m01 + y * m11 + z * m21 + m31;
+		dest[i].z = x * m02 + y * m12 + z * m22 + m32;
+	}
+}
+
+// As above, but for directions, which ignore the translation.
+inline void transformDirections( const Imath::V3f *source, Imath::V3f *dest, size_t numElements, const Imath::M44f &matrix )
+{
+	const float m00 = matrix[0][0], m01 = matrix[0][1], m02 = matrix[0][2];
+	const float m10 = matrix[1][0], m11 = matrix[1][1], m12 = matrix[1][2];
+	const float m20 = matrix[2][0], m21 = matrix[2][1], m22 = matrix[2][2];
+
+	for( size_t i = 0; i < numElements; i++ )
+	{
+		const float x = source[i].x;
+		const float y = source[i].y;
+		const float z = source[i].z;
+		dest[i].x = x * m00 + y * m10 + z * m20;
+		dest[i].y = x * m01 + y * m11 + z * m21;
+		dest[i].z = x * m02 + y * m12 + z * m22;
+	}
+}
+
 inline void transformPrimVarValue(
-	const Imath::V3f *source, Imath::V3f *dest, int numElements,
+	const Imath::V3f *source, Imath::V3f *dest, size_t numElements,
 	const Imath::M44f &matrix, const Imath::M44f &normalMatrix, GeometricData::Interpretation interpretation
 )
 {
-	if( interpretation == GeometricData::Point )
+	if( interpretation == GeometricData::Point && matrix != Imath::M44f() )
 	{
-		for( int i = 0; i < numElements; i++ )
+		if( isAffine( matrix ) )
 		{
-			*(dest++) = *(source++) * matrix;
+			transformPointsAffine( source, dest, numElements, matrix );
 		}
-	}
-	else if( interpretation == GeometricData::Vector )
-	{
-		for( int i = 0; i < numElements; i++ )
+		else
 		{
-			matrix.multDirMatrix( *(source++), *(dest++) );
+			for( size_t i = 0; i < numElements; i++ )
+			{
+				*(dest++) = *(source++) * matrix;
+			}
 		}
 	}
-	else if( interpretation == GeometricData::Normal )
+	else if( interpretation == GeometricData::Vector && matrix != Imath::M44f() )
 	{
-		for( int i = 0; i < numElements; i++ )
-		{
-			normalMatrix.multDirMatrix( *(source++), *(dest++) );
-		}
+		transformDirections( source, dest, numElements, matrix );
 	}
-	else
+	else if( interpretation == GeometricData::Normal && normalMatrix != Imath::M44f() )
+	{
+		transformDirections( source, dest, numElements, normalMatrix );
+	}
+	else if( source != dest )
+	{
+		std::copy( source, source + numElements, dest );
+	}
+}
+
+template<typename DataType>
+inline void copyElements( const Data *sourceData, size_t sourceIndex, typename DataType::ValueType &typedDest, size_t destIndex, size_t num, const Imath::M44f &matrix, const Imath::M44f &normalMatrix )
+{
+	auto *typedSourceData = IECore::runTimeCast< const DataType >( sourceData );
+	if( !typedSourceData )
 	{
-		for( int i = 0; i < numElements; i++ )
+		// Failed to cast to destination type ... maybe this is a Constant variable being promoted,
+		// and the Data stores a single element instead of a vector?
+
+		using SingleElementDataType = typename DataTraits< typename DataType::ValueType::value_type >::DataType;
+
+		auto *singleElementTypedSourceData = IECore::runTimeCast< const SingleElementDataType >( sourceData );
+		if( singleElementTypedSourceData )
+		{
+			assert( num == 1 );
+			if constexpr( std::is_same_v< SingleElementDataType, V3fData > )
+			{
+				// Fairly weird corner case, but technically Constant primvars could need transforming too
+				GeometricData::Interpretation interp = singleElementTypedSourceData->getInterpretation();
+				transformPrimVarValue(
+					&singleElementTypedSourceData->readable(), &typedDest[ destIndex ], 1,
+					matrix, normalMatrix, interp
+				);
+			}
+			else
+			{
+				typedDest[ destIndex ] = singleElementTypedSourceData->readable();
+			}
+			return;
+		}
+		else
 		{
-			*(dest++) = *(source++);
+			throw IECore::Exception( fmt::format(
+				"Can't copy element of type {} to destination of type: {}",
+				sourceData->typeName(), DataType::staticTypeName()
+			) );
 		}
 	}
+	const auto &typedSource = typedSourceData->readable();
 
-}
+	assert( typedSource.size() >= sourceIndex + num );
+	assert( typedDest.size() >= destIndex + num );
 
+	if constexpr( std::is_same_v< DataType, V3fVectorData > )
+	{
+		GeometricData::Interpretation interp = typedSourceData->getInterpretation();
+		transformPrimVarValue(
+			&typedSource[ sourceIndex ], &typedDest[ destIndex ], num, matrix, normalMatrix, interp
+		);
+	}
+	else
+	{
+		std::copy( typedSource.begin() + sourceIndex, typedSource.begin() + sourceIndex + num, typedDest.begin() + destIndex );
+	}
+}
 
-inline void copyElements( const Data *sourceData, size_t sourceIndex, Data *destData, size_t destIndex, size_t num, const Imath::M44f &matrix, const Imath::M44f &normalMatrix )
+// Copies the data for one merged primitive variable from all of the source primitives.
+// Work is divided by output element rather than by primitive, so that we parallelise
+// equally well when merging many small primitives and when merging a few large ones.
+// Elements for primitives which don't have the variable are left at their initial value.
+template<typename DataType>
+void scatterElements(
+	const std::vector< std::pair< const IECoreScene::Primitive*, Imath::M44f > > &primitives,
+	const std::vector<Imath::M44f> &normalMatrices,
+	const std::vector<const PrimitiveVariable *> &sources,
+	const std::vector<unsigned int> &numData, const std::vector<unsigned int> &accumDataSizes,
+	DataType *destData, const IECore::Canceller *canceller, tbb::task_group_context &taskGroupContext
+)
 {
-	IECore::dispatch( destData,
-		[&] ( auto *typedDestData ) {
-			using DataType = std::remove_pointer_t< decltype( typedDestData ) >;
-			if constexpr( TypeTraits::IsVectorTypedData< DataType >::value )
-			{
-				auto &typedDest = typedDestData->writable();
-				auto *typedSourceData = IECore::runTimeCast< const DataType >( sourceData );
-				if( !typedSourceData )
-				{
-					// Failed to cast to destination type ... maybe this is a Constant variable being promoted,
-					// and the Data stores a single element instead of a vector?
-
-					using SingleElementDataType = typename DataTraits< typename DataType::ValueType::value_type >::DataType;
+	// We call `writable()` up front, since it isn't safe to call concurrently.
+	auto &dest = destData->writable();
 
-					auto *singleElementTypedSourceData = IECore::runTimeCast< const SingleElementDataType >( sourceData );
-					if( singleElementTypedSourceData )
-					{
-						assert( num == 1 );
-						if constexpr( std::is_same_v< SingleElementDataType, V3fData > )
-						{
-							// Fairly weird corner case, but technically Constant primvars could need transforming too
-							GeometricData::Interpretation interp = singleElementTypedSourceData->getInterpretation();
-							transformPrimVarValue(
-								&singleElementTypedSourceData->readable(), &typedDest[ destIndex ], 1,
-								matrix, normalMatrix, interp
-							);
-						}
-						else
-						{
-							typedDest[ destIndex ] = singleElementTypedSourceData->readable();
-						}
-						return;
-					}
-					else
-					{
-						throw IECore::Exception( fmt::format(
-							"Can't copy element of type {} to destination of type: {}",
-							sourceData->typeName(), destData->typeName()
-						) );
-					}
-				}
-				const auto &typedSource = typedSourceData->readable();
+	auto copyRange = [&]( size_t begin, size_t end ) {
 
-				assert( typedSource.size() >= sourceIndex + num );
-				assert( typedDest.size() >= destIndex + num );
+		Canceller::check( canceller );
 
-				if constexpr( std::is_same_v< DataType, V3fVectorData > )
-				{
-					GeometricData::Interpretation interp = typedSourceData->getInterpretation();
-					transformPrimVarValue(
-						&typedSource[ sourceIndex ], &typedDest[ destIndex ], num, matrix, normalMatrix, interp
-					);
-				}
-				else
-				{
-					for( size_t i = 0; i < num; i++ )
-					{
-						typedDest[ destIndex + i ] = typedSource[ sourceIndex + i ];
-					}
-				}
+		// Find the first primitive contributing to this range. Primitives with no data
+		// have the same offset as the one after them, so `upper_bound()` skips them.
+		size_t i = std::upper_bound( accumDataSizes.begin(), accumDataSizes.end(), begin ) - accumDataSizes.begin() - 1;
+		for( ; i < accumDataSizes.size() && accumDataSizes[i] < end; ++i )
+		{
+			if( !sources[i] )
+			{
+				continue;
 			}
-			else
+
+			const size_t primBegin = std::max<size_t>( begin, accumDataSizes[i] );
+			const size_t primEnd = std::min<size_t>( end, accumDataSizes[i] + numData[i] );
+			if( primBegin >= primEnd )
 			{
-				throw IECore::Exception( fmt::format(
-					"Can't copy elements, not a vector data type: {}", typedDestData->typeName()
-				) );
+				continue;
 			}
+
+			copyElements<DataType>(
+				sources[i]->data.get(), primBegin - accumDataSizes[i], dest, primBegin, primEnd - primBegin,
+				primitives[i].second, normalMatrices[i]
+			);
 		}
-	);
+	};
+
+	const size_t size = dest.size();
+	if constexpr( std::is_same_v< typename DataType::ValueType, std::vector<bool> > )
+	{
+		// Elements of `std::vector<bool>` share storage, so can't be written concurrently.
+		copyRange( 0, size );
+	}
+	else
+	{
+		tbb::parallel_for(
+			tbb::blocked_range<size_t>( 0, size, 1024 ),
+			[&]( const tbb::blocked_range<size_t> &range )
+			{
+				copyRange( range.begin(), range.end() );
+			},
+			taskGroupContext
+		);
+	}
 }
 
 IECore::TypeId vectorDataTypeFromDataType( const Data *data )
@@ -1000,6 +1088,16 @@ IECoreScene::PrimitivePtr mergePrimitivesInternal(
 		// We need to collect the data size before we can allocate the output primvars
 		std::vector<unsigned int> numData;
 		std::vector<unsigned int> accumDataSizes;
+
+		IECore::InternedString name;
+
+		// The variable from each source primitive, or null if it doesn't have one.
+		std::vector<const PrimitiveVariable *> sources;
+		// Set if any source primitive doesn't have the variable.
+		bool incomplete = false;
+
+		// The variable in the result.
+		PrimitiveVariable *dest = nullptr;
 	};
 
 	std::unordered_map< IECore::InternedString, PrimVarInfo > varInfos;
@@ -1101,9 +1199,11 @@ IECoreScene::PrimitivePtr mergePrimitivesInternal(
 	}
 
 	//
-	// Now loop over variables collecting the information we'll need to allocate them.
+	// Gather the variables we'll be outputting into a list, so we don't need to look them up
+	// by name again.
 	//
 
+	std::vector<PrimVarInfo *> outputVarInfos;
 	for( auto &[name, varInfo] : varInfos )
 	{
 		if( varInfo.interpolation == PrimitiveVariable::Invalid )
@@ -1118,57 +1218,14 @@ IECoreScene::PrimitivePtr mergePrimitivesInternal(
 			varInfo.interpolation = PrimitiveVariable::Uniform;
 		}
 
-
-		// We also need to count the amount of data for this primvar contributed by each primitive.
-
-		bool incomplete = false;
-		for( unsigned int i = 0; i < primitives.size(); i++ )
-		{
-
-			auto it = primitives[i].first->variables.find( name );
-
-			if( it == primitives[i].first->variables.end() )
-			{
-				// This primitive doesn't have this primvar, we'll just write one data element
-				// that will be left uninitialized.
-				// Note : It's probably arguable what is most correct here ... is it unexpected that a var that
-				// usually isn't indexed would become indexed because one prim is missing it? But there is an
-				// efficiency gain in not storing the zero value repeatedly ( in any case where the data type is
-				// more than 4 bytes ). I've currently gone with indexing it because it feels simplest to
-				// implement - we need to make this work for the indexed case, so it's easy to just always use
-				// the indexed case.
-				varInfo.numData[i] = 1;
-				varInfo.indexed = true;
-				incomplete = true;
-				continue;
-			}
-
-			varInfo.numData[i] = IECore::size( it->second.data.get() );
-
-			// Only if everything is simple and matches can we skip outputting indices ( though this
-			// is hopefully the most common case )
-			if( it->second.indices || !interpolationMatches( resultTypeId, it->second.interpolation, varInfo.interpolation ) )
-			{
-				varInfo.indexed = true;
-			}
-		}
-
-		if( incomplete )
-		{
-			if( name == "N" )
-			{
-				// Using default initialized normals is particularly likely to produce confusion, so we have a special
-				// warning for this case.
-				msg( Msg::Warning, "mergePrimitives",
-					"Primitive variable N missing on some input primitives, defaulting to zero length normals."
-				);
-			}
-		}
+		varInfo.name = name;
+		varInfo.sources.resize( primitives.size(), nullptr );
+		outputVarInfos.push_back( &varInfo );
 	}
 
 	//
-	// Prepare count and offset lists for every interpolation type ( simpler than doing an extra query over
-	// all variables to collect which interpolations are used ).
+	// Now a parallel loop over the primitives, collecting the sizes we'll need to compute the layout
+	// of the output.
 	//
 
 	// There isn't a MaxInterpolation enum, but we don't expect this list to change, and can double check
@@ -1180,20 +1237,100 @@ IECoreScene::PrimitivePtr mergePrimitivesInternal(
 	assert( PrimitiveVariable::Varying < numInterpolations );
 	assert( PrimitiveVariable::FaceVarying < numInterpolations );
 
-	std::vector< std::vector<int> > countInterpolation( numInterpolations );
+	// We prepare count and offset lists for every interpolation type ( simpler than doing an extra query over
+	// all variables to collect which interpolations are used ).
+	std::vector< std::vector<int> > countInterpolation( numInterpolations, std::vector<int>( primitives.size() ) );
 	std::vector< int > totalInterpolation( numInterpolations );
-	std::vector< std::vector<int> > accumInterpolation( numInterpolations );
+	std::vector< std::vector<int> > accumInterpolation( numInterpolations, std::vector<int>( primitives.size() ) );
+
+	std::vector<Imath::M44f> normalMatrices( primitives.size() );
+
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::spin_mutex flagsMutex;
+
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, primitives.size() ),
+		[&]( const tbb::blocked_range<size_t> &range )
+		{
+			// Flags are accumulated locally, and only written to the shared PrimVarInfos once per range.
+			std::vector<char> indexed( outputVarInfos.size(), false );
+			std::vector<char> incomplete( outputVarInfos.size(), false );
+
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				Canceller::check( canceller );
+				const Primitive *prim = primitives[i].first;
+
+				for( int interpolation = 0; interpolation < numInterpolations; interpolation++ )
+				{
+					countInterpolation[interpolation][i] = prim->variableSize( (PrimitiveVariable::Interpolation)interpolation );
+				}
+
+				normalMatrices[i] = normalTransform( primitives[i].second );
+
+				for( size_t v = 0; v < outputVarInfos.size(); ++v )
+				{
+					PrimVarInfo &varInfo = *outputVarInfos[v];
+					auto it = prim->variables.find( varInfo.name );
+					if( it == prim->variables.end() || it->second.interpolation == PrimitiveVariable::Invalid )
+					{
+						// This primitive doesn't have this primvar, we'll just write one data element
+						// that will be left uninitialized.
+						// Note : It's probably arguable what is most correct here ... is it unexpected that a var that
+						// usually isn't indexed would become indexed because one prim is missing it? But there is an
+						// efficiency gain in not storing the zero value repeatedly ( in any case where the data type is
+						// more than 4 bytes ). I've currently gone with indexing it because it feels simplest to
+						// implement - we need to make this work for the indexed case, so it's easy to just always use
+						// the indexed case.
+						varInfo.numData[i] = 1;
+						indexed[v] = true;
+						incomplete[v] = true;
+						continue;
+					}
+
+					varInfo.sources[i] = &it->second;
+					varInfo.numData[i] = IECore::size( it->second.data.get() );
+
+					// Only if everything is simple and matches can we skip outputting indices ( though this
+					// is hopefully the most common case )
+					if( it->second.indices || !interpolationMatches( resultTypeId, it->second.interpolation, varInfo.interpolation ) )
+					{
+						indexed[v] = true;
+					}
+				}
+			}
+
+			tbb::spin_mutex::scoped_lock lock( flagsMutex );
+			for( size_t v = 0; v < outputVarInfos.size(); ++v )
+			{
+				outputVarInfos[v]->indexed = outputVarInfos[v]->indexed || indexed[v];
+				outputVarInfos[v]->incomplete = outputVarInfos[v]->incomplete || incomplete[v];
+			}
+		},
+		tbb::auto_partitioner(),
+		taskGroupContext
+	);
+
+	// Using default initialized normals is particularly likely to produce confusion, so we have a special
+	// warning for this case.
+	auto nIt = varInfos.find( "N" );
+	if( nIt != varInfos.end() && nIt->second.interpolation != PrimitiveVariable::Invalid && nIt->second.incomplete )
+	{
+		msg( Msg::Warning, "mergePrimitives",
+			"Primitive variable N missing on some input primitives, defaulting to zero length normals."
+		);
+	}
+
+	// Accumulate counts into offsets. This is serial, but it's just summing integers, so
+	// is negligible compared to the copying.
 
 	for( int interpolation = 0; interpolation < numInterpolations; interpolation++ )
 	{
 		int accum = 0;
-		countInterpolation[interpolation].reserve( primitives.size() );
-		accumInterpolation[interpolation].reserve( primitives.size() );
-		for( unsigned int i = 0; i < primitives.size(); i++ )
+		for( size_t i = 0; i < primitives.size(); i++ )
 		{
-			countInterpolation[interpolation].push_back( primitives[i].first->variableSize( ((PrimitiveVariable::Interpolation)interpolation) ) );
 			accumInterpolation[interpolation][i] = accum;
-			accum += countInterpolation[interpolation].back();
+			accum += countInterpolation[interpolation][i];
 		}
 		totalInterpolation[interpolation] = accum;
 	}
@@ -1208,52 +1345,82 @@ IECoreScene::PrimitivePtr mergePrimitivesInternal(
 	// Allocate storage for the primitives variables
 	//
 
-	for( auto &[name, varInfo] : varInfos )
+	std::vector<size_t> totalDataSizes;
+	for( PrimVarInfo *varInfo : outputVarInfos )
 	{
-		if( varInfo.interpolation == PrimitiveVariable::Invalid )
-		{
-			continue;
-		}
-
-		varInfo.accumDataSizes.reserve( varInfo.numData.size() );
+		varInfo->accumDataSizes.reserve( varInfo->numData.size() );
 		size_t accumDataSize = 0;
-		for( unsigned int i : varInfo.numData )
+		for( unsigned int i : varInfo->numData )
 		{
-			varInfo.accumDataSizes.push_back( accumDataSize );
+			varInfo->accumDataSizes.push_back( accumDataSize );
 			accumDataSize += i;
 		}
+		totalDataSizes.push_back( accumDataSize );
 
-		PrimitiveVariable &p = result.result->variables.emplace(name, PrimitiveVariable() ).first->second;
+		PrimitiveVariable &p = result.result->variables.emplace( varInfo->name, PrimitiveVariable() ).first->second;
 
-		p.data = IECore::runTimeCast<Data>( IECore::Object::create( varInfo.typeId ) );
+		p.data = IECore::runTimeCast<Data>( IECore::Object::create( varInfo->typeId ) );
 
-		IECore::setGeometricInterpretation( p.data.get(), varInfo.interpretation );
-		p.interpolation = varInfo.interpolation;
-		Canceller::check( canceller );
-		dataResize( p.data.get(), accumDataSize );
-
-		if( varInfo.indexed )
+		IECore::setGeometricInterpretation( p.data.get(), varInfo->interpretation );
+		p.interpolation = varInfo->interpolation;
+		if( varInfo->indexed )
 		{
 			p.indices = new IntVectorData();
-			Canceller::check( canceller );
-			p.indices->writable().resize( totalInterpolation[ varInfo.interpolation ] );
 		}
+
+		varInfo->dest = &p;
 	}
 
+	// Resizing includes zero-initialising the data, which is a significant part of the cost,
+	// so we resize each variable in parallel.
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, outputVarInfos.size(), 1 ),
+		[&]( const tbb::blocked_range<size_t> &range )
+		{
+			for( size_t v = range.begin(); v != range.end(); ++v )
+			{
+				PrimitiveVariable &p = *outputVarInfos[v]->dest;
+				Canceller::check( canceller );
+				dataResize( p.data.get(), totalDataSizes[v] );
+				if( p.indices )
+				{
+					Canceller::check( canceller );
+					p.indices->writable().resize( totalInterpolation[ p.interpolation ] );
+				}
+			}
+		},
+		taskGroupContext
+	);
+
 	//
-	// Now a big parallel loop where we do the majority of actual work - copying all the primvar and topology
-	// data to the destination.
+	// Now we can scatter all the primvar data directly into the preallocated outputs.
 	//
 
-	// In theory, we would a finer-grained threading of this, so we could optimize the case where a small
-	// number of extremely large primitives are combined. However, with the current level of multithreading,
-	// it's already hard to produce cases where this loop is a significant contributor to runtime cost. The
-	// more significant issue is that when allocating *VectorData, we currently don't have a way to skip
-	// the zero-initialize, so much of the cost is currently in that ( which is hard to parallelize, and
-	// also is completely unnecessary ). There's probably not much point threading this further until we fix
-	// that.
+	for( PrimVarInfo *varInfo : outputVarInfos )
+	{
+		IECore::dispatch( varInfo->dest->data.get(),
+			[&] ( auto *typedDestData ) {
+				using DataType = std::remove_pointer_t< decltype( typedDestData ) >;
+				if constexpr( TypeTraits::IsVectorTypedData< DataType >::value )
+				{
+					scatterElements(
+						primitives, normalMatrices, varInfo->sources, varInfo->numData, varInfo->accumDataSizes,
+						typedDestData, canceller, taskGroupContext
+					);
+				}
+				else
+				{
+					throw IECore::Exception( fmt::format(
+						"Can't copy elements, not a vector data type: {}", typedDestData->typeName()
+					) );
+				}
+			}
+		);
+	}
 
-	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	//
+	// And finally a parallel loop over the primitives, copying all the indices and topology.
+	//
 
 	tbb::parallel_for(
 		tbb::blocked_range<size_t>( 0, primitives.size() ),
@@ -1263,62 +1430,35 @@ IECoreScene::PrimitivePtr mergePrimitivesInternal(
 			{
 				const Primitive &sourcePrim = *primitives[i].first;
 
-				const Imath::M44f &matrix = primitives[i].second;
-				const Imath::M44f normalMatrix = normalTransform( matrix );
-
-				// Copy the data ( and indices ) for each prim var for this primitive into
-				// the destination primvar.
-				for( auto &[name, varInfo] : varInfos )
+				for( const PrimVarInfo *varInfo : outputVarInfos )
 				{
-					if( varInfo.interpolation == PrimitiveVariable::Invalid )
+					if( !varInfo->indexed )
 					{
 						continue;
 					}
 
-					PrimitiveVariable &destVar = result.result->variables.find( name )->second;
-
-					const size_t numIndices = countInterpolation[ varInfo.interpolation ][i];
-					const size_t startIndex = accumInterpolation[ varInfo.interpolation ][i];
-					const size_t dataStart = varInfo.accumDataSizes[i];
+					const size_t numIndices = countInterpolation[ varInfo->interpolation ][i];
+					const size_t startIndex = accumInterpolation[ varInfo->interpolation ][i];
+					const size_t dataStart = varInfo->accumDataSizes[i];
 
+					Canceller::check( canceller );
+					int *destIndices = varInfo->dest->indices->writable().data() + startIndex;
 
-					auto it = sourcePrim.variables.find( name );
-					if( it == sourcePrim.variables.end() || it->second.interpolation == PrimitiveVariable::Invalid )
+					const PrimitiveVariable *sourceVar = varInfo->sources[i];
+					if( !sourceVar )
 					{
-						// No matching data found in this primitive for this primvar
-
-						// We don't currently have a way to suppress zero-initialization of the data, so
-						// we don't need to initialize that here
-
-						Canceller::check( canceller );
-
 						// We always leave one data element for primitives that don't have the relevant
 						// primvar, so just write out all indices pointing to that element.
-						int *destIndices = &destVar.indices->writable()[ startIndex ];
-						for( size_t j = 0; j < numIndices; j++ )
-						{
-							*(destIndices++) = dataStart;
-						}
+						std::fill( destIndices, destIndices + numIndices, (int)dataStart );
 					}
 					else
 					{
-						const PrimitiveVariable &sourceVar = it->second;
-
-						Canceller::check( canceller );
-						copyElements( sourceVar.data.get(), 0, destVar.data.get(), dataStart, varInfo.numData[i], matrix, normalMatrix );
-
-						if( varInfo.indexed )
-						{
-							Canceller::check( canceller );
-							int *destIndices = &destVar.indices->writable()[ startIndex ];
-
-							copyIndices(
-								sourceVar.indices ? &sourceVar.indices->readable() : nullptr, destIndices,
-								resultTypeId, sourceVar.interpolation, varInfo.interpolation,
-								numIndices, dataStart,
-								&sourcePrim
-							);
-						}
+						copyIndices(
+							sourceVar->indices ? &sourceVar->indices->readable() : nullptr, destIndices,
+							resultTypeId, sourceVar->interpolation, varInfo->interpolation,
+							numIndices, dataStart,
+							&sourcePrim
+						);
 					}
 				}
 
@@ -36,9 +36,20 @@
 
 #include "GafferScene/Private/IECoreScenePreview/Renderer.h"
 
+#include "IECore/DataAlgo.h"
 #include "IECore/Exception.h"
+#include "IECore/VectorTypedData.h"
+
+#include "fmt/format.h"
+
+#include "tbb/parallel_for.h"
+
+#include <algorithm>
+#include <charconv>
+#include <limits>
 
 using namespace std;
+using namespace IECore;
 using namespace IECoreScenePreview;
 
 //////////////////////////////////////////////////////////////////////////
@@ -63,6 +74,106 @@ CreatorMap &creators()
 
 } // namespace
 
+//////////////////////////////////////////////////////////////////////////
+// Instance array fallback
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+struct InstanceAttribute
+{
+
+	template<typename T>
+	DataPtr operator()( const TypedData<vector<T>> *data, size_t index )
+	{
+		return new TypedData<T>( data->readable()[index] );
+	}
+
+	template<typename T>
+	DataPtr operator()( const GeometricTypedData<vector<T>> *data, size_t index )
+	{
+		return new GeometricTypedData<T>( data->readable()[index], data->getInterpretation() );
+	}
+
+	DataPtr operator()( const Data *data, size_t index )
+	{
+		throw IECore::InvalidArgumentException( fmt::format( "Expected VectorTypedData but got {}", data->typeName() ) );
+	}
+
+};
+
+// Handle for an instance array which has been expanded into individual
+// objects by `Renderer::instances()`.
+class ExpandedInstanceArray : public Renderer::ObjectInterface
+{
+
+	public :
+
+		ExpandedInstanceArray( bool hasInstanceAttributes )
+			:	m_hasInstanceAttributes( hasInstanceAttributes )
+		{
+		}
+
+		void transform( const Imath::M44f &transform ) override
+		{
+		}
+
+		void transform( const std::vector<Imath::M44f> &samples, const std::vector<float> &times ) override
+		{
+		}
+
+		bool attributes( const Renderer::AttributesInterface *attributes ) override
+		{
+			if( m_hasInstanceAttributes )
+			{
+				// We'd lose the per-instance attributes, so the array
+				// must be replaced instead.
+				return false;
+			}
+
+			for( auto &o : objects )
+			{
+				if( !o->attributes( attributes ) )
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		void link( const IECore::InternedString &type, const Renderer::ConstObjectSetPtr &objectSet ) override
+		{
+			for( auto &o : objects )
+			{
+				o->link( type, objectSet );
+			}
+		}
+
+		void assignID( uint32_t id ) override
+		{
+			for( auto &o : objects )
+			{
+				o->assignID( id );
+			}
+		}
+
+		void assignInstanceID( uint32_t id ) override
+		{
+		}
+
+		std::vector<Renderer::ObjectInterfacePtr> objects;
+
+	private :
+
+		const bool m_hasInstanceAttributes;
+
+};
+
+IE_CORE_DECLAREPTR( ExpandedInstanceArray )
+
+} // namespace
+
 //////////////////////////////////////////////////////////////////////////
 // Renderer
 //////////////////////////////////////////////////////////////////////////
@@ -82,6 +193,92 @@ Renderer::ObjectInterfacePtr Renderer::camera( const std::string &name,  const s
 	return camera( name, samples[0], attributes );
 }
 
+Renderer::ObjectInterfacePtr Renderer::instances( const std::string &name, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times, const IECore::CompoundObject *attributes, const InstanceArray &instances )
+{
+	const bool hasInstanceAttributes = !instances.attributes.empty();
+	ExpandedInstanceArrayPtr result = new ExpandedInstanceArray( hasInstanceAttributes );
+	result->objects.resize( instances.ids.size() );
+
+	AttributesInterfacePtr sharedAttributes;
+	if( !hasInstanceAttributes )
+	{
+		sharedAttributes = this->attributes( attributes );
+	}
+
+	const std::string &namePrefix = instances.instanceNamePrefix.size() ? instances.instanceNamePrefix : name;
+
+	// Output the instances in parallel, as renderers typically expect when
+	// `object()` is called by capsule expansion. We limit the number of tasks,
+	// as some renderers scale poorly when too many threads call `object()`
+	// concurrently.
+	const size_t grainSize = std::max( (size_t)1, instances.ids.size() / 32 );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, instances.ids.size(), grainSize ),
+		[&] ( const tbb::blocked_range<size_t> &range ) {
+
+			std::string instanceName = namePrefix + "/";
+			const size_t prefixLength = instanceName.size();
+			std::vector<Imath::M44f> transformSamples( instances.transforms.size() );
+
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				AttributesInterfacePtr instanceAttributes = sharedAttributes;
+				if( hasInstanceAttributes )
+				{
+					// Since we're only adding members, we can reference the prototype
+					// members directly rather than copying them.
+					CompoundObjectPtr a = new CompoundObject;
+					a->members() = attributes->members();
+					for( const auto &[attributeName, data] : instances.attributes )
+					{
+						a->members()[attributeName] = dispatch( data.get(), InstanceAttribute(), instances.attributeIndices[i] );
+					}
+					instanceAttributes = this->attributes( a.get() );
+				}
+
+				instanceName.resize( prefixLength + std::numeric_limits<int64_t>::digits10 + 2 );
+				instanceName.resize( std::to_chars( &instanceName[prefixLength], instanceName.data() + instanceName.size(), instances.ids[i] ).ptr - instanceName.data() );
+
+				ObjectInterfacePtr object = times.size() ?
+					this->object( instanceName, samples, times, instanceAttributes.get() ) :
+					this->object( instanceName, samples.front(), instanceAttributes.get() )
+				;
+				if( !object )
+				{
+					continue;
+				}
+
+				if( instances.transformTimes.empty() )
+				{
+					object->transform( instances.transforms.front()[i] );
+				}
+				else
+				{
+					for( size_t s = 0; s < transformSamples.size(); ++s )
+					{
+						transformSamples[s] = instances.transforms[s][i];
+					}
+					object->transform( transformSamples, instances.transformTimes );
+				}
+
+				if( instances.instanceIDs.size() )
+				{
+					object->assignInstanceID( instances.instanceIDs[i] );
+				}
+
+				result->objects[i] = object;
+			}
+		}
+	);
+
+	result->objects.erase(
+		std::remove( result->objects.begin(), result->objects.end(), nullptr ),
+		result->objects.end()
+	);
+
+	return result;
+}
+
 IECore::DataPtr Renderer::command( const IECore::InternedString name, const IECore::CompoundDataMap &parameters )
 {
 	throw IECore::NotImplementedException( "Renderer::command" );
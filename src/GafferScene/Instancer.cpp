@@ -47,7 +47,6 @@
 
 #include "Gaffer/Context.h"
 #include "Gaffer/StringPlug.h"
-#include "Gaffer/Private/IECorePreview/LRUCache.h"
 
 #include "IECoreScene/Primitive.h"
 
@@ -61,6 +60,8 @@
 #include "boost/unordered_set.hpp"
 
 #include "tbb/blocked_range.h"
+#include "tbb/concurrent_hash_map.h"
+#include "tbb/concurrent_vector.h"
 #include "tbb/parallel_for.h"
 #include "tbb/parallel_reduce.h"
 #include "tbb/spin_mutex.h"
@@ -470,6 +471,8 @@ class Instancer::EngineData : public Data
 				}
 			}
 
+			initInstanceTransforms();
+
 			if( m_ids.size() )
 			{
 				for( size_t i = 0, e = numPoints(); i < e; ++i )
@@ -720,30 +723,9 @@ class Instancer::EngineData : public Data
 			return m_names ? m_names->outputChildNames() : g_emptyNames.get();
 		}
 
-		M44f instanceTransform( size_t pointIndex ) const
+		const M44f &instanceTransform( size_t pointIndex ) const
 		{
-			M44f result;
-			if( m_positions )
-			{
-				result.translate( (*m_positions)[pointIndex] );
-			}
-			if( m_orientations )
-			{
-				// Using Orientation::normalizedIfNeeded avoids modifying quaternions that are already
-				// normalized. It's better for consistency to not be pointlessly changing the values
-				// slightly at the limits of floating point precision, when they're already as close to
-				// normalized as they can get, and this saves 4% runtime on InstancerTest.testBoundPerformance.
-				result = Orientation::normalizedIfNeeded((*m_orientations)[pointIndex]).toMatrix44() * result;
-			}
-			if( m_scales )
-			{
-				result.scale( (*m_scales)[pointIndex] );
-			}
-			if( m_uniformScales )
-			{
-				result.scale( V3f( (*m_uniformScales)[pointIndex] ) );
-			}
-			return result;
+			return m_instanceTransforms.size() ? m_instanceTransforms[pointIndex] : g_identityTransform;
 		}
 
 		size_t numInstanceAttributes() const
@@ -757,6 +739,12 @@ class Instancer::EngineData : public Data
 			h.append( (uint64_t)pointIndex );
 		}
 
+		// The data for all per-instance attributes, indexed by point index.
+		const IECoreScenePreview::Renderer::InstanceArray::Attributes &instanceAttributeColumns() const
+		{
+			return m_attributeColumns;
+		}
+
 		void instanceAttributes( size_t pointIndex, CompoundObject &result ) const
 		{
 			CompoundObject::ObjectMap &writableResult = result.members();
@@ -895,23 +883,132 @@ class Instancer::EngineData : public Data
 			msg( Msg::Warning, "EngineData::load", "Not implemented" );
 		}
 
+		void memoryUsage( Object::MemoryAccumulator &accumulator ) const override
+		{
+			Data::memoryUsage( accumulator );
+			accumulator.accumulate( m_instanceTransforms.capacity() * sizeof( M44f ) );
+		}
+
 	private :
 
+		static const M44f g_identityTransform;
+
+		// Composes the transforms for a contiguous range of points. This is templated
+		// on the primitive variables that are present, so that the inner loop has no
+		// branches, and the compiler is free to vectorise it.
+		template<bool HasPositions, bool HasOrientations, bool HasScales, bool HasUniformScales>
+		void composeInstanceTransforms( size_t begin, size_t end )
+		{
+			M44f *result = m_instanceTransforms.data();
+			for( size_t i = begin; i < end; ++i )
+			{
+				M44f &m = result[i];
+				if constexpr( HasOrientations )
+				{
+					// Using Orientation::normalizedIfNeeded avoids modifying quaternions that are already
+					// normalized. It's better for consistency to not be pointlessly changing the values
+					// slightly at the limits of floating point precision, when they're already as close to
+					// normalized as they can get, and this saves 4% runtime on InstancerTest.testBoundPerformance.
+					m = Orientation::normalizedIfNeeded( (*m_orientations)[i] ).toMatrix44();
+				}
+				else
+				{
+					m.makeIdentity();
+				}
+
+				if constexpr( HasScales || HasUniformScales )
+				{
+					V3f s;
+					if constexpr( HasScales )
+					{
+						s = (*m_scales)[i];
+					}
+					else
+					{
+						s = V3f( (*m_uniformScales)[i] );
+					}
+					for( int j = 0; j < 3; ++j )
+					{
+						m[0][j] *= s[0];
+						m[1][j] *= s[1];
+						m[2][j] *= s[2];
+					}
+				}
+
+				if constexpr( HasPositions )
+				{
+					const V3f &p = (*m_positions)[i];
+					m[3][0] = p[0];
+					m[3][1] = p[1];
+					m[3][2] = p[2];
+				}
+			}
+		}
+
+		// Precomputes the transforms for all points in bulk, so that queries for individual
+		// instances are just a lookup. The result is equivalent to `S * R * T`, built directly
+		// rather than via matrix multiplication.
+		void initInstanceTransforms()
+		{
+			if( !m_positions && !m_orientations && !m_scales && !m_uniformScales )
+			{
+				return;
+			}
+
+			m_instanceTransforms.resize( numPoints() );
+
+			using ComposeFunction = void (EngineData::*)( size_t, size_t );
+			static const ComposeFunction g_composeFunctions[16] = {
+				&EngineData::composeInstanceTransforms<false, false, false, false>,
+				&EngineData::composeInstanceTransforms<false, false, false, true>,
+				&EngineData::composeInstanceTransforms<false, false, true, false>,
+				&EngineData::composeInstanceTransforms<false, false, true, true>,
+				&EngineData::composeInstanceTransforms<false, true, false, false>,
+				&EngineData::composeInstanceTransforms<false, true, false, true>,
+				&EngineData::composeInstanceTransforms<false, true, true, false>,
+				&EngineData::composeInstanceTransforms<false, true, true, true>,
+				&EngineData::composeInstanceTransforms<true, false, false, false>,
+				&EngineData::composeInstanceTransforms<true, false, false, true>,
+				&EngineData::composeInstanceTransforms<true, false, true, false>,
+				&EngineData::composeInstanceTransforms<true, false, true, true>,
+				&EngineData::composeInstanceTransforms<true, true, false, false>,
+				&EngineData::composeInstanceTransforms<true, true, false, true>,
+				&EngineData::composeInstanceTransforms<true, true, true, false>,
+				&EngineData::composeInstanceTransforms<true, true, true, true>
+			};
+
+			const ComposeFunction compose = g_composeFunctions[
+				( m_positions ? 8 : 0 ) | ( m_orientations ? 4 : 0 ) | ( m_scales ? 2 : 0 ) | ( m_uniformScales ? 1 : 0 )
+			];
+
+			task_group_context taskGroupContext( task_group_context::isolated );
+			parallel_for(
+				tbb::blocked_range<size_t>( 0, numPoints(), 1024 ),
+				[this, compose] ( const tbb::blocked_range<size_t> &r ) {
+					(this->*compose)( r.begin(), r.end() );
+				},
+				taskGroupContext
+			);
+		}
+
 		using AttributeCreator = std::function<DataPtr ( size_t )>;
 
 		struct MakeAttributeCreator
 		{
 
+			// The creators share ownership of the source data, and index
+			// directly into it, rather than taking a copy of each column.
+
 			template<typename T>
 			AttributeCreator operator()( const TypedData<vector<T>> *data )
 			{
-				return std::bind( &createAttribute<T>, data->readable(), std::placeholders::_1 );
+				return std::bind( &createAttribute<T>, ConstDataPtr( data ), std::placeholders::_1 );
 			}
 
 			template<typename T>
 			AttributeCreator operator()( const GeometricTypedData<vector<T>> *data )
 			{
-				return std::bind( &createGeometricAttribute<T>, data->readable(), data->getInterpretation(), std::placeholders::_1 );
+				return std::bind( &createGeometricAttribute<T>, ConstDataPtr( data ), std::placeholders::_1 );
 			}
 
 			AttributeCreator operator()( const Data *data )
@@ -922,15 +1019,16 @@ class Instancer::EngineData : public Data
 			private :
 
 				template<typename T>
-				static DataPtr createAttribute( const vector<T> &values, size_t index )
+				static DataPtr createAttribute( const ConstDataPtr &data, size_t index )
 				{
-					return new TypedData<T>( values[index] );
+					return new TypedData<T>( static_cast<const TypedData<vector<T>> *>( data.get() )->readable()[index] );
 				}
 
 				template<typename T>
-				static DataPtr createGeometricAttribute( const vector<T> &values, GeometricData::Interpretation interpretation, size_t index )
+				static DataPtr createGeometricAttribute( const ConstDataPtr &data, size_t index )
 				{
-					return new GeometricTypedData<T>( values[index], interpretation );
+					const auto *typedData = static_cast<const GeometricTypedData<vector<T>> *>( data.get() );
+					return new GeometricTypedData<T>( typedData->readable()[index], typedData->getInterpretation() );
 				}
 
 		};
@@ -955,9 +1053,12 @@ class Instancer::EngineData : public Data
 				{
 					continue;
 				}
-				DataPtr d = primVar.second.expandedData();
+				// Only expand indexed data. Otherwise we can reference the primitive's
+				// data directly, since we keep the primitive alive.
+				ConstDataPtr d = primVar.second.indices ? ConstDataPtr( primVar.second.expandedData() ) : primVar.second.data;
 				AttributeCreator attributeCreator = dispatch( d.get(), MakeAttributeCreator() );
 				m_attributeCreators[attributePrefix + primVar.first] = attributeCreator;
+				m_attributeColumns.emplace_back( attributePrefix + primVar.first, d );
 				m_attributesHash.append( primVar.first );
 				d->hash( m_attributesHash );
 			}
@@ -1146,11 +1247,13 @@ class Instancer::EngineData : public Data
 		const std::vector<Imath::Quatf> *m_orientations;
 		const std::vector<Imath::V3f> *m_scales;
 		const std::vector<float> *m_uniformScales;
+		std::vector<M44f> m_instanceTransforms;
 
 		using IdsToPointIndices = std::unordered_map <int64_t, size_t>;
 		IdsToPointIndices m_idsToPointIndices;
 
 		boost::container::flat_map<InternedString, AttributeCreator> m_attributeCreators;
+		IECoreScenePreview::Renderer::InstanceArray::Attributes m_attributeColumns;
 		MurmurHash m_attributesHash;
 
 		const std::vector< PrototypeContextVariable > m_prototypeContextVariables;
@@ -1160,6 +1263,8 @@ class Instancer::EngineData : public Data
 		friend Instancer::EngineSplitPrototypesData;
 };
 
+const M44f Instancer::EngineData::g_identityTransform;
+
 // If we aren't encapsulating, we need to split the prototypes into groups, requiring us to do extra work
 class Instancer::EngineSplitPrototypesData : public Data
 {
@@ -1412,7 +1517,7 @@ GAFFER_NODE_DEFINE_TYPE( Instancer );
 size_t Instancer::g_firstPlugIndex = 0;
 
 Instancer::Instancer( const std::string &name )
-	:	BranchCreator( name )
+	:	BranchCreator( name ), m_statisticsInstances( 0 ), m_statisticsVariants( 0 ), m_statisticsPrototypes( 0 )
 {
 	storeIndexOfNextChild( g_firstPlugIndex );
 	addChild( new StringPlug( "name", Plug::In, "instances" ) );
@@ -1694,6 +1799,22 @@ const Gaffer::AtomicCompoundDataPlug *Instancer::variationsPlug() const
 	return getChild<AtomicCompoundDataPlug>( g_firstPlugIndex + 22 );
 }
 
+Instancer::PrototypeStatistics Instancer::prototypeStatistics() const
+{
+	PrototypeStatistics result;
+	result.instances = m_statisticsInstances;
+	result.variants = m_statisticsVariants;
+	result.prototypes = m_statisticsPrototypes;
+	return result;
+}
+
+void Instancer::resetPrototypeStatistics()
+{
+	m_statisticsInstances = 0;
+	m_statisticsVariants = 0;
+	m_statisticsPrototypes = 0;
+}
+
 Gaffer::ObjectPlug *Instancer::enginePlug()
 {
 	return getChild<ObjectPlug>( g_firstPlugIndex + 23 );
@@ -2397,6 +2518,11 @@ Gaffer::ValuePlug::CachePolicy Instancer::computeCachePolicy( const Gaffer::Valu
 	{
 		return ValuePlug::CachePolicy::TaskCollaboration;
 	}
+	else if( output == enginePlug() )
+	{
+		// Instance transforms are computed in parallel.
+		return ValuePlug::CachePolicy::TaskCollaboration;
+	}
 	return BranchCreator::computeCachePolicy( output );
 }
 
@@ -3108,18 +3234,14 @@ void Instancer::PrototypeScope::setPrototype( const EngineData *engine, const Sc
 namespace
 {
 
-// It shouldn't be necessary for this to be refcounted - but LRUCache is set up to make it impossible
-// to get a pointer to the internal storage, since things could be evicted. We are disabling evictions,
-// but we're still stuck with needing a shared pointer of some sort.
+// Refcounted because identical variants share a single Prototype.
 struct Prototype : public IECore::RefCounted
 {
 	Prototype(
 		const ScenePlug *prototypesPlug, const ScenePlug::ScenePath *prototypeRoot,
 		const std::vector<float> &sampleTimes, const IECore::MurmurHash &hash,
 		const GafferScene::Private::RendererAlgo::RenderOptions &renderOptions,
-		const Context *prototypeContext,
-		IECoreScenePreview::Renderer *renderer,
-		bool prepareRendererAttributes
+		const Context *prototypeContext
 	)
 	{
 		const float onFrameTime = prototypeContext->getFrame();
@@ -3133,10 +3255,7 @@ struct Prototype : public IECore::RefCounted
 		}
 
 		m_attributes = prototypesPlug->attributesPlug()->getValue();
-		if( prepareRendererAttributes )
-		{
-			m_rendererAttributes = renderer->attributes( m_attributes.get() );
-		}
+		const IECore::MurmurHash attributesHash = prototypesPlug->attributesPlug()->hash();
 
 		for( unsigned int i = 0; i < sampleTimes.size(); i++ )
 		{
@@ -3148,6 +3267,9 @@ struct Prototype : public IECore::RefCounted
 		h.append( prototypeContext->hash() );
 		h.append( *prototypeRoot );
 
+		// Until we know better, we must assume that the prototype is unique to this context.
+		m_contentHash = h;
+
 		// We find the capsules using the engine at shutter open, but the time used to construct the capsules
 		// must be the on-frame time, since the capsules will add their own shutter
 		scope.setFrame( onFrameTime );
@@ -3161,13 +3283,20 @@ struct Prototype : public IECore::RefCounted
 			}
 
 			GafferScene::Private::RendererAlgo::deformationMotionTimes( renderOptions, m_attributes.get(), m_objectSampleTimes );
-			GafferScene::Private::RendererAlgo::objectSamples( prototypesPlug->objectPlug(), m_objectSampleTimes, m_object );
-
-			m_objectPointers.reserve( m_object.size() );
-			for( ConstObjectPtr &i : m_object )
+			IECore::MurmurHash objectHash;
+			GafferScene::Private::RendererAlgo::objectSamples( prototypesPlug->objectPlug(), m_objectSampleTimes, m_object, &objectHash );
+
+			// Without children, the prototype is fully described by the values we have
+			// sampled. Hash them so that variants which differ only in context variables
+			// that don't affect the prototype can share it.
+			m_contentHash = IECore::MurmurHash();
+			m_contentHash.append( *prototypeRoot );
+			m_contentHash.append( attributesHash );
+			for( const auto &t : m_transforms )
 			{
-				m_objectPointers.push_back( i.get() );
+				m_contentHash.append( t );
 			}
+			m_contentHash.append( objectHash );
 		}
 		else
 		{
@@ -3186,6 +3315,12 @@ struct Prototype : public IECore::RefCounted
 			newCapsule->setRenderOptions( renderOptions );
 			m_object.push_back( std::move( newCapsule ) );
 		}
+
+		m_objectPointers.reserve( m_object.size() );
+		for( ConstObjectPtr &i : m_object )
+		{
+			m_objectPointers.push_back( i.get() );
+		}
 	}
 
 	std::vector<ConstObjectPtr> m_object;
@@ -3195,31 +3330,14 @@ struct Prototype : public IECore::RefCounted
 	std::vector<const Object *> m_objectPointers;
 	std::vector<float> m_objectSampleTimes;
 	ConstCompoundObjectPtr m_attributes;
-	IECoreScenePreview::Renderer::AttributesInterfacePtr m_rendererAttributes;
 	std::vector<M44f> m_transforms;
+	// Identifies prototypes which would render identically, regardless
+	// of the context they were created in.
+	IECore::MurmurHash m_contentHash;
 };
 
 using ConstPrototypePtr = boost::intrusive_ptr<const Prototype>;
 
-struct PrototypeCacheGetterKey
-{
-
-	PrototypeCacheGetterKey( int prototypeId, const Context *context )
-		: prototypeId( prototypeId ), context( context )
-	{
-	}
-
-	operator IECore::MurmurHash () const
-	{
-		IECore::MurmurHash result = context->hash();
-		result.append( prototypeId );
-		return result;
-	}
-
-	const int prototypeId;
-	const Context *context;
-};
-
 } // namespace
 
 void Instancer::InstancerCapsule::render( IECoreScenePreview::Renderer *renderer ) const
@@ -3277,8 +3395,8 @@ void Instancer::InstancerCapsule::render( IECoreScenePreview::Renderer *renderer
 	// ============================================================================
 	// Set up a vector of all the prototypes
 	// Or, if the prototypes depend on context, so there is no fixed prototype for
-	// each prototype index, set up cache that will be used to find each
-	// prototype
+	// each prototype index, find all the unique variants and construct a prototype
+	// for each.
 	// ============================================================================
 	const ScenePlug *prototypesPlug = m_instancer->prototypesPlug();
 
@@ -3291,11 +3409,16 @@ void Instancer::InstancerCapsule::render( IECoreScenePreview::Renderer *renderer
 
 	// fixedPrototypes is used when the prototypes don't depend on context
 	std::vector<ConstPrototypePtr> fixedPrototypes;
+	// Otherwise, each point has an index into variantPrototypes.
+	std::vector<size_t> pointVariants;
+	std::vector<ConstPrototypePtr> variantPrototypes;
+	size_t numVariants = 0;
+	size_t numUniquePrototypes = 0;
+
 	if( !engines[0]->hasContextVariables() )
 	{
 		fixedPrototypes.resize( engines[0]->numValidPrototypes() );
 
-		const ThreadState &threadState = ThreadState::current();
 		tbb::parallel_for( tbb::blocked_range<size_t>( 0, fixedPrototypes.size() ),
 			[&]( const tbb::blocked_range<size_t> &r )
 			{
@@ -3307,9 +3430,7 @@ void Instancer::InstancerCapsule::render( IECoreScenePreview::Renderer *renderer
 					fixedPrototypes[i] = new Prototype(
 						prototypesPlug, engines[0]->prototypeRoot( i, enginePath, prototypeRootStorage ),
 						sampleTimes, outerCapsuleHash, renderOpts,
-						threadScope.context(), renderer,
-						// If we don't have instance attributes, we can prepare renderer attributes ahead of time
-						!hasAttributes
+						threadScope.context()
 					);
 
 				}
@@ -3317,74 +3438,34 @@ void Instancer::InstancerCapsule::render( IECoreScenePreview::Renderer *renderer
 			taskGroupContext
 		);
 
+		numVariants = numUniquePrototypes = fixedPrototypes.size();
 	}
+	else
+	{
+		// First pass : find the unique combinations of prototype and context, recording
+		// a representative point for each, and the variant used by every point.
 
-	const Context *defaultContext = context();
-
-	// If fixedPrototypes is not set, we will put prototypes in this cache whenever we first encounter
-	// a prototype using a given context.
-	IECorePreview::LRUCache<IECore::MurmurHash, ConstPrototypePtr, IECorePreview::LRUCachePolicy::Parallel, PrototypeCacheGetterKey> prototypeCache(
-		[
-			&prototypesPlug, &sampleTimes, &outerCapsuleHash, &renderOpts,
-			&renderer, &hasAttributes, &engines, &defaultContext, &enginePath
-		]
-		( const PrototypeCacheGetterKey &key, size_t &cost, const IECore::Canceller *canceller ) -> ConstPrototypePtr
-		{
-			cost = 1;
-			ScenePlug::ScenePath prototypeRootStorage;
-			return new Prototype(
-				prototypesPlug, engines[0]->prototypeRoot( key.prototypeId, enginePath, prototypeRootStorage ),
-				sampleTimes, outerCapsuleHash, renderOpts,
-				key.context ? key.context : defaultContext, renderer,
-				// If we don't have instance attributes, we can prepare renderer attributes ahead of time
-				!hasAttributes
-			);
-		},
-		std::numeric_limits<size_t>::max() // Never evict, even if prototypes are all unique
-	);
-
-	// ============================================================================
-	// Output the instances
-	// ============================================================================
-
-	// We've found problems with performance when running too many iterations in parallel, which appear
-	// to be related with hitting AiNode too hard in parallel ( perhaps related to threads spread between
-	// separate processors ). To partially solve this, we set the grain size so that we shouldn't use more
-	// than 32 threads, which appears to help some in testing.
-	size_t grainSize = std::max( (size_t)1, engines[0]->numPoints() / 32 );
-
-	tbb::parallel_for( tbb::blocked_range<size_t>( 0, engines[0]->numPoints(), grainSize ),
-		[&]( const tbb::blocked_range<size_t> &r )
+		struct Variant
 		{
-			Context::EditableScope prototypeScope( threadState );
-
-			vector<M44f> pointTransforms( sampleTimes.size() );
-			IECoreScenePreview::Renderer::AttributesInterfacePtr attribsStorage;
-
-			// Storage for names, indexed by prototype id ( each instance of the same prototype
-			// will reuse this storage )
-			std::vector< std::string > names( engines[0]->numValidPrototypes() );
-			std::vector< int > namePrefixLengths( engines[0]->numValidPrototypes() );
+			size_t pointIndex;
+			int prototypeIndex;
+		};
+		tbb::concurrent_vector<Variant> variants;
+		using VariantMap = tbb::concurrent_hash_map<IECore::MurmurHash, size_t>;
+		VariantMap variantMap;
 
-			for( size_t pointIndex = r.begin(); pointIndex != r.end(); ++pointIndex )
+		pointVariants.resize( engines[0]->numPoints() );
+		tbb::parallel_for( tbb::blocked_range<size_t>( 0, engines[0]->numPoints() ),
+			[&]( const tbb::blocked_range<size_t> &r )
 			{
-				int protoIndex = engines[0]->prototypeIndex( pointIndex );
-				if( protoIndex == -1 )
-				{
-					// Invalid prototype
-					continue;
-				}
-
-				const Prototype *proto;
-				if( fixedPrototypes.size() )
-				{
-					proto = fixedPrototypes[protoIndex].get();
-				}
-				else
+				Context::EditableScope prototypeScope( threadState );
+				for( size_t pointIndex = r.begin(); pointIndex != r.end(); ++pointIndex )
 				{
-					// The prototype depends on the context, so we need to find the prototype context for
-					// this instance.
-
+					const int protoIndex = engines[0]->prototypeIndex( pointIndex );
+					if( protoIndex == -1 )
+					{
+						continue;
+					}
 
 					// We find the capsules using the engine at shutter open, but the time used to construct the capsules
 					// must be the on-frame time, since the capsules will add their own shutter ( and we also handle
@@ -3395,102 +3476,286 @@ void Instancer::InstancerCapsule::render( IECoreScenePreview::Renderer *renderer
 					// time before we do setPrototypeContextVariables for the next element. ( Should this be more
 					// general instead of assuming that frame is the only variable for which offsetMode may be set? )
 					prototypeScope.setFrame( onFrameTime );
-
 					engines[0]->setPrototypeContextVariables( pointIndex, prototypeScope );
 
-					proto = prototypeCache.get( PrototypeCacheGetterKey( protoIndex, prototypeScope.context() ) ).get();
-				}
+					IECore::MurmurHash key = prototypeScope.context()->hash();
+					key.append( protoIndex );
 
-				if( !proto->m_object.size() )
-				{
-					// No object to render. This could happen if the protype didn't meet the
-					// RenderOptions::purposeIncluded test.
-					continue;
+					// Most points will share an existing variant, so we try a find with
+					// a read lock before falling back to an insert with a write lock.
+					VariantMap::const_accessor readAccessor;
+					if( variantMap.find( readAccessor, key ) )
+					{
+						pointVariants[pointIndex] = readAccessor->second;
+						continue;
+					}
+					readAccessor.release();
+
+					VariantMap::accessor writeAccessor;
+					if( variantMap.insert( writeAccessor, key ) )
+					{
+						writeAccessor->second = variants.push_back( { pointIndex, protoIndex } ) - variants.begin();
+					}
+					pointVariants[pointIndex] = writeAccessor->second;
 				}
+			},
+			taskGroupContext
+		);
 
-				IECoreScenePreview::Renderer::AttributesInterface *attribs;
-				if( hasAttributes )
-				{
-					CompoundObjectPtr currentAttributes = new CompoundObject();
+		// Second pass : construct the prototypes for all variants in parallel. Variants which
+		// would render identically are deduplicated, so that they share a single prototype.
 
-					// Since we're not going to modify any existing members (only add new ones),
-					// and our result is only read in this function, and never written, we can
-					// directly reference the input members in our result without copying. Be
-					// careful not to modify them though!
-					currentAttributes->members() = proto->m_attributes->members();
+		using PrototypeMap = tbb::concurrent_hash_map<IECore::MurmurHash, ConstPrototypePtr>;
+		PrototypeMap uniquePrototypes;
 
-					engines[0]->instanceAttributes( pointIndex, *currentAttributes );
-					attribsStorage = renderer->attributes( currentAttributes.get() );
-					attribs = attribsStorage.get();
-				}
-				else
+		variantPrototypes.resize( variants.size() );
+		tbb::parallel_for( tbb::blocked_range<size_t>( 0, variants.size() ),
+			[&]( const tbb::blocked_range<size_t> &r )
+			{
+				Context::EditableScope prototypeScope( threadState );
+
+				ScenePlug::ScenePath prototypeRootStorage;
+				for( size_t i = r.begin(); i != r.end(); ++i )
 				{
-					attribs = proto->m_rendererAttributes.get();
+					const Variant &variant = variants[i];
+					prototypeScope.setFrame( onFrameTime );
+					engines[0]->setPrototypeContextVariables( variant.pointIndex, prototypeScope );
+
+					ConstPrototypePtr prototype = new Prototype(
+						prototypesPlug, engines[0]->prototypeRoot( variant.prototypeIndex, enginePath, prototypeRootStorage ),
+						sampleTimes, outerCapsuleHash, renderOpts,
+						prototypeScope.context()
+					);
+
+					PrototypeMap::accessor a;
+					if( uniquePrototypes.insert( a, prototype->m_contentHash ) )
+					{
+						a->second = prototype;
+					}
+					variantPrototypes[i] = a->second;
 				}
+			},
+			taskGroupContext
+		);
 
-				int64_t instanceId = engines[0]->instanceId( pointIndex );
+		numVariants = variantPrototypes.size();
+		numUniquePrototypes = uniquePrototypes.size();
+	}
 
+	// ============================================================================
+	// Output the instances
+	// ============================================================================
 
-				if( !namePrefixLengths[protoIndex] )
-				{
-					// If we haven't allocated a name for this prototype index, allocate it now,
-					// including additional storage that will hold the digits for each instance id
-					const std::string &protoName = engines[0]->prototypeNames()->readable()[ protoIndex ].string();
-					names[protoIndex].reserve( protoName.size() + std::numeric_limits< int64_t >::digits10 + 1 );
-					names[protoIndex] += protoName;
-					names[protoIndex].append( 1, '/' );
-					namePrefixLengths[protoIndex] = names[protoIndex].size();
-				}
+	// We've found problems with performance when running too many iterations in parallel, which appear
+	// to be related with hitting AiNode too hard in parallel ( perhaps related to threads spread between
+	// separate processors ). To partially solve this, we set the grain size so that we shouldn't use more
+	// than 32 threads, which appears to help some in testing.
+	size_t grainSize = std::max( (size_t)1, engines[0]->numPoints() / 32 );
+	const size_t numChunks = ( engines[0]->numPoints() + grainSize - 1 ) / grainSize;
 
-				// Create a name by concatenating the name of the prototype with digits of the current
-				// instance id.
-				// Including the prototype name is not necessary for uniqueness ( the instance ids are
-				// already unique ), but doing this keeps the names more consistent with how things end
-				// up being named when they use the non-encapsulated hierarchy.
-				std::string &name = names[ protoIndex ];
-				const int prefixLen = namePrefixLengths[ protoIndex ];
-				name.resize( namePrefixLengths[protoIndex] + std::numeric_limits< int64_t >::digits10 + 1 );
-				name.resize( std::to_chars( &name[prefixLen], &(*name.end()), instanceId ).ptr - &name[0] );
-
-				IECoreScenePreview::Renderer::ObjectInterfacePtr objectInterface;
-				if( proto->m_objectSampleTimes.size() )
-				{
-					objectInterface = renderer->object(
-						name, proto->m_objectPointers, proto->m_objectSampleTimes, attribs
-					);
-				}
-				else
+	// We gather the instances into an array per prototype, so that each prototype
+	// can be output with a single call to `Renderer::instances()`. Each chunk of points
+	// is gathered in parallel, and the chunks are then merged in order.
+	struct Batch
+	{
+		const Prototype *prototype;
+		int prototypeIndex;
+		std::string name;
+		IECoreScenePreview::Renderer::InstanceArray instances;
+	};
+	std::vector<std::vector<Batch>> chunkBatches( numChunks );
+
+	tbb::parallel_for( tbb::blocked_range<size_t>( 0, numChunks, 1 ),
+		[&]( const tbb::blocked_range<size_t> &r )
+		{
+			for( size_t chunk = r.begin(); chunk != r.end(); ++chunk )
+			{
+				std::vector<Batch> &batches = chunkBatches[chunk];
+				std::unordered_map<const Prototype *, size_t> batchIndices;
+
+				const size_t chunkEnd = std::min( ( chunk + 1 ) * grainSize, engines[0]->numPoints() );
+				for( size_t pointIndex = chunk * grainSize; pointIndex != chunkEnd; ++pointIndex )
 				{
-					objectInterface = renderer->object(
-						name, proto->m_object[0].get(), attribs
-					);
+					int protoIndex = engines[0]->prototypeIndex( pointIndex );
+					if( protoIndex == -1 )
+					{
+						// Invalid prototype
+						continue;
+					}
+
+					const Prototype *proto = fixedPrototypes.size() ?
+						fixedPrototypes[protoIndex].get() :
+						variantPrototypes[pointVariants[pointIndex]].get()
+					;
+
+					if( !proto->m_object.size() )
+					{
+						// No object to render. This could happen if the protype didn't meet the
+						// RenderOptions::purposeIncluded test.
+						continue;
+					}
+
+					auto [batchIt, inserted] = batchIndices.try_emplace( proto, batches.size() );
+					if( inserted )
+					{
+						Batch &newBatch = batches.emplace_back();
+						newBatch.prototype = proto;
+						newBatch.prototypeIndex = protoIndex;
+						newBatch.instances.transforms.resize( sampleTimes.size() );
+						if( sampleTimes.size() > 1 )
+						{
+							newBatch.instances.transformTimes = sampleTimes;
+						}
+						if( hasAttributes )
+						{
+							newBatch.instances.attributes = engines[0]->instanceAttributeColumns();
+						}
+					}
+
+					IECoreScenePreview::Renderer::InstanceArray &instances = batches[batchIt->second].instances;
+
+					const int64_t instanceId = engines[0]->instanceId( pointIndex );
+					instances.ids.push_back( instanceId );
+
+					if( sampleTimes.size() == 1 )
+					{
+						instances.transforms[0].push_back( proto->m_transforms[0] * engines[0]->instanceTransform( pointIndex ) );
+					}
+					else
+					{
+						for( unsigned int i = 0; i < engines.size(); i++ )
+						{
+							int curPointIndex = i == 0 ? pointIndex : engines[i]->pointIndex( instanceId );
+							instances.transforms[i].push_back( proto->m_transforms[i] * engines[i]->instanceTransform( curPointIndex ) );
+						}
+					}
+
+					if( hasAttributes )
+					{
+						instances.attributeIndices.push_back( pointIndex );
+					}
+
+					if( needsInstanceIDs )
+					{
+						// We add one here so that we can distinguish between the background and an id of 0.
+						// Anything that uses these ids will need to subtract this off ( currently just
+						// ImageSelectionTool ).
+						instances.instanceIDs.push_back( pointIndex + 1 );
+					}
 				}
+			}
+		},
+		taskGroupContext
+	);
 
-				if( sampleTimes.size() == 1 )
+	// Lay out the merged array for each prototype. This is a serial pass, but
+	// only over the batches for each chunk, not the individual instances.
+
+	std::vector<Batch> batches;
+	std::vector<size_t> batchSizes;
+	// For each batch in each chunk, the index of its merged batch, and its
+	// offset within it.
+	std::vector<std::vector<std::pair<size_t, size_t>>> chunkDestinations( numChunks );
+	{
+		std::unordered_map<const Prototype *, size_t> batchIndices;
+		std::unordered_map<int, size_t> prototypeArrayCounts;
+		const std::vector<InternedString> &prototypeNames = engines[0]->prototypeNames()->readable();
+		for( size_t chunk = 0; chunk < numChunks; ++chunk )
+		{
+			for( const Batch &batch : chunkBatches[chunk] )
+			{
+				auto [batchIt, inserted] = batchIndices.try_emplace( batch.prototype, batches.size() );
+				if( inserted )
 				{
-					objectInterface->transform( proto->m_transforms[0] * engines[0]->instanceTransform( pointIndex ) );
+					Batch &newBatch = batches.emplace_back();
+					newBatch.prototype = batch.prototype;
+					newBatch.prototypeIndex = batch.prototypeIndex;
+					newBatch.instances.transforms.resize( batch.instances.transforms.size() );
+					newBatch.instances.transformTimes = batch.instances.transformTimes;
+					newBatch.instances.attributes = batch.instances.attributes;
+					// Context variations may give several prototypes for the same prototype
+					// index. Their arrays need unique names, but we name the instances themselves
+					// after the prototype, so that they match the non-encapsulated hierarchy.
+					// Including the prototype name is not necessary for uniqueness ( the
+					// instance ids are already unique ), but keeps the names consistent.
+					const std::string &prototypeName = prototypeNames[batch.prototypeIndex].string();
+					const size_t arrayIndex = prototypeArrayCounts[batch.prototypeIndex]++;
+					newBatch.name = arrayIndex ? fmt::format( "{}:{}", prototypeName, arrayIndex ) : prototypeName;
+					newBatch.instances.instanceNamePrefix = prototypeName;
+					batchSizes.push_back( 0 );
 				}
-				else
+				chunkDestinations[chunk].push_back( { batchIt->second, batchSizes[batchIt->second] } );
+				batchSizes[batchIt->second] += batch.instances.ids.size();
+			}
+		}
+
+		for( size_t i = 0; i < batches.size(); ++i )
+		{
+			IECoreScenePreview::Renderer::InstanceArray &instances = batches[i].instances;
+			instances.ids.resize( batchSizes[i] );
+			for( auto &t : instances.transforms )
+			{
+				t.resize( batchSizes[i] );
+			}
+			if( hasAttributes )
+			{
+				instances.attributeIndices.resize( batchSizes[i] );
+			}
+			if( needsInstanceIDs )
+			{
+				instances.instanceIDs.resize( batchSizes[i] );
+			}
+		}
+	}
+
+	// Copy the chunks into the merged arrays in parallel.
+
+	tbb::parallel_for( tbb::blocked_range<size_t>( 0, numChunks, 1 ),
+		[&]( const tbb::blocked_range<size_t> &r )
+		{
+			for( size_t chunk = r.begin(); chunk != r.end(); ++chunk )
+			{
+				for( size_t i = 0; i < chunkBatches[chunk].size(); ++i )
 				{
-					for( unsigned int i = 0; i < engines.size(); i++ )
+					const IECoreScenePreview::Renderer::InstanceArray &from = chunkBatches[chunk][i].instances;
+					const auto &[batchIndex, offset] = chunkDestinations[chunk][i];
+					IECoreScenePreview::Renderer::InstanceArray &to = batches[batchIndex].instances;
+
+					std::copy( from.ids.begin(), from.ids.end(), to.ids.begin() + offset );
+					for( size_t t = 0; t < to.transforms.size(); ++t )
 					{
-						int curPointIndex = i == 0 ? pointIndex : engines[i]->pointIndex( instanceId );
-						pointTransforms[i] = proto->m_transforms[i] * engines[i]->instanceTransform( curPointIndex );
+						std::copy( from.transforms[t].begin(), from.transforms[t].end(), to.transforms[t].begin() + offset );
 					}
-
-					objectInterface->transform( pointTransforms, sampleTimes );
+					std::copy( from.attributeIndices.begin(), from.attributeIndices.end(), to.attributeIndices.begin() + offset );
+					std::copy( from.instanceIDs.begin(), from.instanceIDs.end(), to.instanceIDs.begin() + offset );
 				}
+				std::vector<Batch>().swap( chunkBatches[chunk] );
+			}
+		},
+		taskGroupContext
+	);
 
-				if( needsInstanceIDs )
-				{
-					// We add one here so that we can distinguish between the background and an id of 0.
-					// Anything that uses these ids will need to subtract this off ( currently just
-					// ImageSelectionTool ).
-					objectInterface->assignInstanceID( pointIndex + 1 );
-				}
+	// Output the arrays. Renderers are free to output the individual instances of each
+	// array in parallel, as the default implementation of `Renderer::instances()` does.
 
+	std::atomic_size_t numInstances( 0 );
+	tbb::parallel_for( tbb::blocked_range<size_t>( 0, batches.size(), 1 ),
+		[&]( const tbb::blocked_range<size_t> &r )
+		{
+			for( size_t i = r.begin(); i != r.end(); ++i )
+			{
+				const Batch &batch = batches[i];
+				numInstances += batch.instances.ids.size();
+				renderer->instances(
+					batch.name, batch.prototype->m_objectPointers, batch.prototype->m_objectSampleTimes,
+					batch.prototype->m_attributes.get(), batch.instances
+				);
 			}
 		},
 		taskGroupContext
 	);
+
+	m_instancer->m_statisticsInstances += numInstances;
+	m_instancer->m_statisticsVariants += numVariants;
+	m_instancer->m_statisticsPrototypes += numUniquePrototypes;
 }
@@ -429,7 +429,14 @@ void InteractiveRender::update()
 			m_controller->setMinimumExpansionDepth( numeric_limits<size_t>::max() );
 			m_controller->setVisibleSet( g_defaultVisibleSet );
 		}
-		m_controller->update();
+		m_controller->updateProgressively(
+			RenderController::ProgressCallback(),
+			[this] ( const std::function<void ()> &prepareNextPass ) {
+				m_renderer->render();
+				prepareNextPass();
+				m_renderer->pause();
+			}
+		);
 	}
 
 	m_state = requiredState;
@@ -36,6 +36,8 @@
 
 #include "GafferScene/Isolate.h"
 
+#include "GafferScene/Private/PathMatcherAlgo.h"
+
 #include "Gaffer/Context.h"
 #include "Gaffer/StringPlug.h"
 
@@ -364,6 +366,16 @@ void Isolate::hashSet( const IECore::InternedString &setName, const Gaffer::Cont
 	filterPlug()->hash( h );
 }
 
+Gaffer::ValuePlug::CachePolicy Isolate::computeCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == outPlug()->setPlug() )
+	{
+		// Sets are computed in parallel.
+		return ValuePlug::CachePolicy::TaskCollaboration;
+	}
+	return FilteredSceneProcessor::computeCachePolicy( output );
+}
+
 IECore::ConstPathMatcherDataPtr Isolate::computeSet( const IECore::InternedString &setName, const Gaffer::Context *context, const ScenePlug *parent ) const
 {
 	ConstPathMatcherDataPtr inputSetData = inPlug()->setPlug()->getValue();
@@ -381,51 +393,43 @@ IECore::ConstPathMatcherDataPtr Isolate::computeSet( const IECore::InternedStrin
 		return inputSetData;
 	}
 
-	PathMatcherDataPtr outputSetData = inputSetData->copy();
-	PathMatcher &outputSet = outputSetData->writable();
-
-	FilterPlug::SceneScope sceneScope( context, inPlug() );
-	sceneScope.remove( ScenePlug::setNameContextName );
-
 	const std::string fromString = fromPlug()->getValue();
 	ScenePlug::ScenePath fromPath; ScenePlug::stringToPath( fromString, fromPath );
 
 	const SetsToKeep setsToKeep( this );
 
-	for( PathMatcher::RawIterator pIt = inputSet.begin(), peIt = inputSet.end(); pIt != peIt; )
-	{
-		sceneScope.set( ScenePlug::scenePathContextName, &(*pIt) );
-		const int m = filterPlug()->getValue() | setsToKeep.match( *pIt );
-		if( m & ( IECore::PathMatcher::ExactMatch | IECore::PathMatcher::AncestorMatch ) )
-		{
-			// We want to keep everything below this point, so
-			// can just prune our iteration.
-			pIt.prune();
-			++pIt;
-		}
-		else if( m & IECore::PathMatcher::DescendantMatch )
-		{
-			// We might be removing things below here,
-			// so just continue our iteration normally
-			// so we can find out.
-			++pIt;
-		}
-		else
-		{
-			assert( m == IECore::PathMatcher::NoMatch );
-			if( boost::starts_with( *pIt, fromPath ) )
-			{
-				// Not going to keep anything below
-				// here, so we can prune traversal
-				// entirely.
-				outputSet.prune( *pIt );
-				pIt.prune();
+	return new PathMatcherData(
+		Private::PathMatcherAlgo::parallelFilter(
+			inputSet,
+			[&] ( const ScenePlug::ScenePath &path ) {
+				FilterPlug::SceneScope sceneScope( context, inPlug() );
+				sceneScope.remove( ScenePlug::setNameContextName );
+				sceneScope.set( ScenePlug::scenePathContextName, &path );
+				const int m = filterPlug()->getValue() | setsToKeep.match( path );
+				if( m & ( IECore::PathMatcher::ExactMatch | IECore::PathMatcher::AncestorMatch ) )
+				{
+					// We want to keep everything below this point.
+					return Private::PathMatcherAlgo::FilterAction::Keep;
+				}
+				else if( m & IECore::PathMatcher::DescendantMatch )
+				{
+					// We might be removing things below here,
+					// so we need to recurse to find out.
+					return Private::PathMatcherAlgo::FilterAction::Recurse;
+				}
+				else
+				{
+					assert( m == IECore::PathMatcher::NoMatch );
+					if( boost::starts_with( path, fromPath ) )
+					{
+						// Not going to keep anything below here.
+						return Private::PathMatcherAlgo::FilterAction::Remove;
+					}
+					return Private::PathMatcherAlgo::FilterAction::Recurse;
+				}
 			}
-			++pIt;
-		}
-	}
-
-	return outputSetData;
+		)
+	);
 }
 
 bool Isolate::mayPruneChildren( const ScenePath &path, const Gaffer::Context *context, const SetsToKeep &setsToKeep ) const
@@ -261,6 +261,11 @@ void MergeScenes::affects( const Gaffer::Plug *input, AffectedPlugsContainer &ou
 		outputs.push_back( outPlug()->setPlug() );
 	}
 
+	if( scene && input == scene->branchSetPlug() )
+	{
+		outputs.push_back( outPlug()->branchSetPlug() );
+	}
+
 }
 
 void MergeScenes::hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
@@ -916,6 +921,56 @@ IECore::ConstPathMatcherDataPtr MergeScenes::computeSet( const IECore::InternedS
 	return result;
 }
 
+void MergeScenes::hashSetSubtree( const IECore::InternedString &setName, const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const
+{
+	// Same as `hashSet()`, but merging only the relevant branch of each input,
+	// so that we never need to compute the full sets.
+	visit(
+		connectedInputs(),
+		[&] ( InputType type, size_t index, const ScenePlug *scene ) {
+			switch( type )
+			{
+				case InputType::Sole :
+					h = scene->branchSetPlug()->hash();
+					break;
+				case InputType::First :
+					ComputeNode::hash( parent->branchSetPlug(), context, h );
+					[[fallthrough]];
+				case InputType::Other :
+					scene->branchSetPlug()->hash( h );
+			}
+			return true;
+		}
+	);
+}
+
+IECore::ConstPathMatcherDataPtr MergeScenes::computeSetSubtree( const IECore::InternedString &setName, const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent ) const
+{
+	ConstPathMatcherDataPtr result;
+	PathMatcherDataPtr merged;
+	visit(
+		connectedInputs(),
+		[&] ( InputType type, size_t index, const ScenePlug *scene ) {
+			switch( type )
+			{
+				case InputType::Sole :
+					result = scene->branchSetPlug()->getValue();
+					break;
+				case InputType::First :
+					merged = new PathMatcherData();
+					result = merged;
+					[[fallthrough]];
+				case InputType::Other :
+					ConstPathMatcherDataPtr paths = scene->branchSetPlug()->getValue();
+					merged->writable().addPaths( paths->readable() );
+			}
+			return true;
+		}
+	);
+
+	return result;
+}
+
 MergeScenes::VisitOrder MergeScenes::visitOrder( Mode mode, VisitOrder replaceOrder ) const
 {
 	switch( mode )
@@ -36,6 +36,8 @@
 
 #include "GafferScene/MeshSegments.h"
 
+#include "GafferScene/Private/IECoreScenePreview/MeshAlgo.h"
+
 #include "IECore/DataAlgo.h"
 
 #include "IECoreScene/MeshAlgo.h"
@@ -159,6 +161,35 @@ void segmentIndices( const std::vector<int> &verticesPerFace, const std::vector<
 	}
 }
 
+// Segments depend only on the topology and the connectivity indices, so we cache
+// them for reuse by subsequent frames of deforming meshes. `indices` may be null,
+// in which case the vertex ids are used.
+ConstIntVectorDataPtr cachedSegments( const MeshPrimitive *mesh, const IntVectorData *indices, int numIndexed, const IECore::Canceller *canceller )
+{
+	IECore::MurmurHash key;
+	key.append( "MeshSegments" );
+	key.append( numIndexed );
+	if( indices )
+	{
+		indices->hash( key );
+	}
+
+	return boost::static_pointer_cast<const IntVectorData>(
+		IECoreScenePreview::MeshAlgo::cachedTopologyData(
+			*mesh, key,
+			[indices, numIndexed] ( const MeshPrimitive &mesh, const IECore::Canceller *canceller ) {
+				IntVectorDataPtr result = new IntVectorData();
+				segmentIndices(
+					mesh.verticesPerFace()->readable(), indices ? indices->readable() : mesh.vertexIds()->readable(),
+					numIndexed, result->writable()
+				);
+				return result;
+			},
+			canceller
+		)
+	);
+}
+
 } // namespace
 
 size_t MeshSegments::g_firstPlugIndex = 0;
@@ -225,16 +256,12 @@ IECore::ConstObjectPtr MeshSegments::computeProcessedObject( const ScenePath &pa
 		return inputObject;
 	}
 
-	const std::vector<int> &verticesPerFace = mesh->verticesPerFace()->readable();
-	IntVectorDataPtr uniformSegmentsData;
+	ConstIntVectorDataPtr uniformSegmentsData;
 
 	if( connectivityPrimVar == "" )
 	{
-		uniformSegmentsData = new IntVectorData();
-		segmentIndices(
-			verticesPerFace, mesh->vertexIds()->readable(),
-			mesh->variableSize( PrimitiveVariable::Interpolation::Vertex ),
-			uniformSegmentsData->writable()
+		uniformSegmentsData = cachedSegments(
+			mesh, nullptr, mesh->variableSize( PrimitiveVariable::Interpolation::Vertex ), context->canceller()
 		);
 	}
 	else
@@ -251,11 +278,8 @@ IECore::ConstObjectPtr MeshSegments::computeProcessedObject( const ScenePath &pa
 			{
 				throw IECore::Exception( "Vertex primitive variable " + connectivityPrimVar + " has indices.  Indices are not supported on vertex primitive variables." );
 			}
-			uniformSegmentsData = new IntVectorData();
-			segmentIndices(
-				verticesPerFace, mesh->vertexIds()->readable(),
-				mesh->variableSize( PrimitiveVariable::Interpolation::Vertex ),
-				uniformSegmentsData->writable()
+			uniformSegmentsData = cachedSegments(
+				mesh, nullptr, mesh->variableSize( PrimitiveVariable::Interpolation::Vertex ), context->canceller()
 			);
 		}
 		else if( it->second.interpolation == PrimitiveVariable::Interpolation::FaceVarying )
@@ -265,11 +289,8 @@ IECore::ConstObjectPtr MeshSegments::computeProcessedObject( const ScenePath &pa
 				// \todo : suggest using PrimitiveVariableWeld, once this node exists." );
 				throw IECore::Exception( "FaceVarying primitive variable " + connectivityPrimVar + " must be indexed in order to use as connectivity." );
 			}
-			uniformSegmentsData = new IntVectorData();
-			segmentIndices(
-				verticesPerFace, it->second.indices->readable(),
-				IECore::size( it->second.data.get() ),
-				uniformSegmentsData->writable()
+			uniformSegmentsData = cachedSegments(
+				mesh, it->second.indices.get(), IECore::size( it->second.data.get() ), context->canceller()
 			);
 		}
 		else if( it->second.interpolation == PrimitiveVariable::Interpolation::Uniform )
@@ -284,8 +305,9 @@ IECore::ConstObjectPtr MeshSegments::computeProcessedObject( const ScenePath &pa
 		{
 			// Not very useful, but it is completely consistent that if you segment based on a constant primvar,
 			// all faces must be in the same segment
-			uniformSegmentsData = new IntVectorData();
-			uniformSegmentsData->writable().resize( mesh->verticesPerFace()->readable().size(), 0 );
+			IntVectorDataPtr constantSegmentsData = new IntVectorData();
+			constantSegmentsData->writable().resize( mesh->verticesPerFace()->readable().size(), 0 );
+			uniformSegmentsData = constantSegmentsData;
 		}
 		else
 		{
@@ -294,6 +316,6 @@ IECore::ConstObjectPtr MeshSegments::computeProcessedObject( const ScenePath &pa
 	}
 
 	MeshPrimitivePtr result = mesh->copy();
-	result->variables[segmentPrimVar] = PrimitiveVariable( PrimitiveVariable::Uniform, uniformSegmentsData );
+	result->variables[segmentPrimVar] = PrimitiveVariable( PrimitiveVariable::Uniform, boost::const_pointer_cast<IntVectorData>( uniformSegmentsData ) );
 	return result;
 }
@@ -185,3 +185,8 @@ IECore::ConstObjectPtr ObjectProcessor::computeObject( const ScenePath &path, co
 		return inPlug()->objectPlug()->getValue();
 	}
 }
+
+bool ObjectProcessor::affectedPaths( const Gaffer::Plug *input, const Gaffer::ValuePlug *output, IECore::PathMatcher &paths ) const
+{
+	return filteredAffectedPaths( input, paths );
+}
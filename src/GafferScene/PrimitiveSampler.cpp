@@ -38,6 +38,9 @@
 
 #include "GafferScene/SceneAlgo.h"
 
+#include "Gaffer/Private/CacheRegistry.h"
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
+
 #include "IECoreScene/MeshAlgo.h"
 #include "IECoreScene/MeshPrimitive.h"
 #include "IECoreScene/PrimitiveEvaluator.h"
@@ -149,6 +152,86 @@ OutputVariableFunction addPrimitiveVariable( Primitive *outputPrimitive, const s
 
 }
 
+// Evaluator cache
+// ===============
+//
+// Building a PrimitiveEvaluator means triangulating the source primitive
+// and building a spatial acceleration structure for it, which can be far
+// more expensive than the sampling itself. Typically many destination
+// locations sample the same source, so we cache the evaluators by the
+// hash of the source object, and share them between all locations and
+// threads.
+
+struct SourceEvaluator
+{
+	// The primitive used to construct the evaluator. This may differ
+	// from the source object, because meshes are triangulated.
+	ConstPrimitivePtr primitive;
+	// Null if the source is not a primitive, or is not supported
+	// by `PrimitiveEvaluator::create()`.
+	PrimitiveEvaluatorPtr evaluator;
+};
+
+using ConstSourceEvaluatorPtr = std::shared_ptr<const SourceEvaluator>;
+
+struct SourceEvaluatorCacheGetterKey
+{
+
+	SourceEvaluatorCacheGetterKey( const IECore::MurmurHash &objectHash, const ScenePlug *source, const ScenePlug::ScenePath &path, const Context *context )
+		:	objectHash( objectHash ), source( source ), path( path ), context( context )
+	{
+	}
+
+	operator const IECore::MurmurHash & () const
+	{
+		return objectHash;
+	}
+
+	const IECore::MurmurHash objectHash;
+	const ScenePlug *source;
+	const ScenePlug::ScenePath &path;
+	const Context *context;
+
+};
+
+ConstSourceEvaluatorPtr sourceEvaluatorCacheGetter( const SourceEvaluatorCacheGetterKey &key, size_t &cost, const IECore::Canceller *canceller )
+{
+	Context::Scope scopedContext( key.context );
+
+	auto result = std::make_shared<SourceEvaluator>();
+	cost = sizeof( SourceEvaluator );
+
+	ConstObjectPtr sourceObject = key.source->object( key.path );
+	result->primitive = runTimeCast<const Primitive>( sourceObject.get() );
+	if( !result->primitive )
+	{
+		return result;
+	}
+
+	if( auto mesh = runTimeCast<const MeshPrimitive>( result->primitive.get() ) )
+	{
+		result->primitive = MeshAlgo::triangulate( mesh, canceller );
+	}
+	result->evaluator = PrimitiveEvaluator::create( result->primitive );
+
+	// The acceleration structure is typically no larger than
+	// the primitive itself, so we account for it by doubling.
+	cost += result->primitive->memoryUsage() * 2;
+	return result;
+}
+
+using SourceEvaluatorCache = IECorePreview::LRUCache<IECore::MurmurHash, ConstSourceEvaluatorPtr, IECorePreview::LRUCachePolicy::TaskParallel, SourceEvaluatorCacheGetterKey>;
+
+SourceEvaluatorCache &sourceEvaluatorCache()
+{
+	static SourceEvaluatorCache *g_cache = [] {
+		auto cache = new SourceEvaluatorCache( sourceEvaluatorCacheGetter, 0, SourceEvaluatorCache::RemovalCallback(), /* cacheErrors = */ false );
+		Gaffer::Private::registerCache( cache, 1.0f / 8.0f );
+		return cache;
+	}();
+	return *g_cache;
+}
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////////
@@ -299,23 +382,17 @@ IECore::ConstObjectPtr PrimitiveSampler::computeProcessedObject( const ScenePath
 		return inputObject;
 	}
 
-	ConstObjectPtr sourceObject = sourcePlug()->object( sourcePath );
-	const Primitive *sourcePrimitive = runTimeCast<const Primitive>( sourceObject.get() );
-	if( !sourcePrimitive )
+	ConstSourceEvaluatorPtr sourceEvaluator = sourceEvaluatorCache().get(
+		SourceEvaluatorCacheGetterKey( sourcePlug()->objectHash( sourcePath ), sourcePlug(), sourcePath, context ),
+		context->canceller()
+	);
+	if( !sourceEvaluator->evaluator )
 	{
 		return inputObject;
 	}
 
-	ConstPrimitivePtr preprocessedSourcePrimitive = sourcePrimitive;
-	if( auto mesh = runTimeCast<const MeshPrimitive>( preprocessedSourcePrimitive.get() ) )
-	{
-		preprocessedSourcePrimitive = MeshAlgo::triangulate( mesh, context->canceller() );
-	}
-	PrimitiveEvaluatorPtr evaluator = PrimitiveEvaluator::create( preprocessedSourcePrimitive );
-	if( !evaluator )
-	{
-		return inputObject;
-	}
+	const Primitive *preprocessedSourcePrimitive = sourceEvaluator->primitive.get();
+	const PrimitiveEvaluator *evaluator = sourceEvaluator->evaluator.get();
 
 	PrimitivePtr outputPrimitive = inputPrimitive->copy();
 	const size_t size = outputPrimitive->variableSize( outputInterpolation );
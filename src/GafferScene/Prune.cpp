@@ -36,6 +36,8 @@
 
 #include "GafferScene/Prune.h"
 
+#include "GafferScene/Private/PathMatcherAlgo.h"
+
 #include "Gaffer/Context.h"
 
 using namespace std;
@@ -262,6 +264,16 @@ void Prune::hashSet( const IECore::InternedString &setName, const Gaffer::Contex
 	filterPlug()->hash( h );
 }
 
+Gaffer::ValuePlug::CachePolicy Prune::computeCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == outPlug()->setPlug() )
+	{
+		// Sets are computed in parallel.
+		return ValuePlug::CachePolicy::TaskCollaboration;
+	}
+	return FilteredSceneProcessor::computeCachePolicy( output );
+}
+
 IECore::ConstPathMatcherDataPtr Prune::computeSet( const IECore::InternedString &setName, const Gaffer::Context *context, const ScenePlug *parent ) const
 {
 	ConstPathMatcherDataPtr inputSetData = inPlug()->setPlug()->getValue();
@@ -271,42 +283,35 @@ IECore::ConstPathMatcherDataPtr Prune::computeSet( const IECore::InternedString
 		return inputSetData;
 	}
 
-	PathMatcherDataPtr outputSetData = inputSetData->copy();
-	PathMatcher &outputSet = outputSetData->writable();
-
-	FilterPlug::SceneScope sceneScope( context, inPlug() );
-	sceneScope.remove( ScenePlug::setNameContextName );
-
-	for( PathMatcher::RawIterator pIt = inputSet.begin(), peIt = inputSet.end(); pIt != peIt; )
-	{
-		sceneScope.set( ScenePlug::scenePathContextName, &(*pIt) );
-		const int m = filterPlug()->getValue();
-		if( m & ( IECore::PathMatcher::ExactMatch | IECore::PathMatcher::AncestorMatch ) )
-		{
-			// This path and all below it are pruned, so we can
-			// ignore it and prune the traversal to the descendant
-			// paths.
-			outputSet.prune( *pIt );
-			pIt.prune();
-			++pIt;
-		}
-		else if( m & IECore::PathMatcher::DescendantMatch )
-		{
-			// This path isn't pruned, so we continue our traversal
-			// as normal to find out which descendants _are_ pruned.
-			++pIt;
-		}
-		else
-		{
-			// This path isn't pruned, and neither is anything
-			// below it. We can avoid retesting the filter for
-			// all descendant paths, since we know they're not
-			// pruned.
-			assert( m == IECore::PathMatcher::NoMatch );
-			pIt.prune();
-			++pIt;
-		}
-	}
-
-	return outputSetData;
+	return new PathMatcherData(
+		Private::PathMatcherAlgo::parallelFilter(
+			inputSet,
+			[&] ( const ScenePlug::ScenePath &path ) {
+				FilterPlug::SceneScope sceneScope( context, inPlug() );
+				sceneScope.remove( ScenePlug::setNameContextName );
+				sceneScope.set( ScenePlug::scenePathContextName, &path );
+				const int m = filterPlug()->getValue();
+				if( m & ( IECore::PathMatcher::ExactMatch | IECore::PathMatcher::AncestorMatch ) )
+				{
+					// This path and all below it are pruned.
+					return Private::PathMatcherAlgo::FilterAction::Remove;
+				}
+				else if( m & IECore::PathMatcher::DescendantMatch )
+				{
+					// This path isn't pruned, so we continue our traversal
+					// to find out which descendants _are_ pruned.
+					return Private::PathMatcherAlgo::FilterAction::Recurse;
+				}
+				else
+				{
+					// This path isn't pruned, and neither is anything
+					// below it. We can avoid retesting the filter for
+					// all descendant paths, since we know they're not
+					// pruned.
+					assert( m == IECore::PathMatcher::NoMatch );
+					return Private::PathMatcherAlgo::FilterAction::Keep;
+				}
+			}
+		)
+	);
 }
@@ -46,8 +46,6 @@
 #include "boost/multi_index/member.hpp"
 #include "boost/multi_index_container.hpp"
 
-#include "tbb/enumerable_thread_specific.h"
-
 #include "fmt/args.h"
 #include "fmt/format.h"
 
@@ -769,18 +767,16 @@ void Rename::hashSet( const IECore::InternedString &setName, const Gaffer::Conte
 	const MurmurHash inputSetHash = inPlug()->setPlug()->hash();
 	ConstPathMatcherDataPtr inputSetData = inPlug()->setPlug()->getValue( &inputSetHash );
 
-	using ThreadLocalHash = tbb::enumerable_thread_specific<IECore::MurmurHash>;
-
 	struct LocationProcessor
 	{
 
-		LocationProcessor( const Rename *rename, const PathMatcher &inputSet, ThreadLocalHash &hash )
-			:	m_rename( rename ), m_parent( nullptr ), m_inputSet( inputSet ), m_hash( hash )
+		LocationProcessor( const Rename *rename, const PathMatcher &inputSet )
+			:	m_rename( rename ), m_parent( nullptr ), m_inputSet( inputSet )
 		{
 		}
 
 		LocationProcessor( const LocationProcessor &parent )
-			:	m_rename( parent.m_rename ), m_parent( &parent ), m_inputSet( parent.m_inputSet ), m_hash( parent.m_hash )
+			:	m_rename( parent.m_rename ), m_parent( &parent ), m_inputSet( parent.m_inputSet )
 		{
 		}
 
@@ -793,17 +789,17 @@ void Rename::hashSet( const IECore::InternedString &setName, const Gaffer::Conte
 			}
 
 			const int filterMatch = m_rename->filterValue( Context::current() );
-			if( m_parent && (filterMatch & PathMatcher::ExactMatch) )
+			if( m_parent )
 			{
-				const NameMapData::Map &nameMap = m_parent->m_nameMap->map;
-				auto it = nameMap.find( path.back() );
-				if( it != nameMap.end() )
+				m_name = path.back();
+				if( filterMatch & PathMatcher::ExactMatch )
 				{
-					MurmurHash renameHash;
-					renameHash.append( path );
-					renameHash.append( it->outputName );
-					MurmurHash &hash = m_hash.local();
-					hash = MurmurHash( hash.h1() + renameHash.h1(), hash.h2() + renameHash.h2() );
+					const NameMapData::Map &nameMap = m_parent->m_nameMap->map;
+					auto it = nameMap.find( path.back() );
+					if( it != nameMap.end() )
+					{
+						m_hash.append( it->outputName );
+					}
 				}
 			}
 
@@ -818,34 +814,43 @@ void Rename::hashSet( const IECore::InternedString &setName, const Gaffer::Conte
 			}
 		}
 
+		void gatherChildren( std::vector<LocationProcessor> &children )
+		{
+			// Children are gathered in order, so we can hash them directly rather
+			// than needing an order-independent combination.
+			for( const auto &child : children )
+			{
+				if( child.m_hash != MurmurHash() )
+				{
+					m_hash.append( child.m_name );
+					m_hash.append( child.m_hash );
+				}
+			}
+		}
+
+		// Hash of all renames at and below this location. Default
+		// if there are none.
+		MurmurHash m_hash;
+
 		private :
 
 			const Rename *m_rename;
 			const LocationProcessor *m_parent;
 			const PathMatcher &m_inputSet;
-			ThreadLocalHash &m_hash;
+			InternedString m_name;
 			ConstNameMapDataPtr m_nameMap;
 
 	};
 
 	ScenePlug::GlobalScope globalScope( context );
-	ThreadLocalHash threadLocalHash;
-	LocationProcessor processor( this, inputSetData->readable(), threadLocalHash );
+	LocationProcessor processor( this, inputSetData->readable() );
 	SceneAlgo::parallelProcessLocations( inPlug(), processor );
 
-	const MurmurHash renamesHash = threadLocalHash.combine(
-		[] ( const MurmurHash &a, const MurmurHash &b ) {
-			// See SceneAlgo's ThreadablePathHashAccumulator for further discussion of
-			// this "sum of hashes" strategy for deterministic parallel hashing.
-			return MurmurHash( a.h1() + b.h1(), a.h2() + b.h2() );
-		}
-	);
-
-	if( renamesHash != MurmurHash() )
+	if( processor.m_hash != MurmurHash() )
 	{
 		FilteredSceneProcessor::hashSet( setName, context, parent, h );
 		h.append( inputSetHash );
-		h.append( renamesHash );
+		h.append( processor.m_hash );
 	}
 	else
 	{
@@ -862,25 +867,18 @@ IECore::ConstPathMatcherDataPtr Rename::computeSet( const IECore::InternedString
 		return inputSetData;
 	}
 
-	// Thread-local PathMatcher so we can build an output set in a thread-safe
-	// manner.
-	/// \todo If `parallelProcessLocations()` supported a `gatherChildren()`
-	/// method, we could build a single set recursively, passing subtrees from
-	/// child to parent.
-	using ThreadLocalSet = tbb::enumerable_thread_specific<IECore::PathMatcher>;
-
 	struct LocationProcessor
 	{
 
-		LocationProcessor( const Rename *rename, const PathMatcher &inputSet, ThreadLocalSet &outputSet )
-			:	m_rename( rename ), m_parent( nullptr ), m_inputSet( inputSet ), m_outputSet( outputSet )
+		LocationProcessor( const Rename *rename, const PathMatcher &inputSet )
+			:	m_rename( rename ), m_parent( nullptr ), m_inputSet( inputSet )
 		{
 		}
 
 		// Constructor used for child locations, allowing us to inherit stuff
 		// from the parent processor.
 		LocationProcessor( const LocationProcessor &parent )
-			:	m_rename( parent.m_rename ), m_parent( &parent ), m_inputSet( parent.m_inputSet ), m_outputSet( parent.m_outputSet )
+			:	m_rename( parent.m_rename ), m_parent( &parent ), m_inputSet( parent.m_inputSet )
 		{
 		}
 
@@ -893,33 +891,32 @@ IECore::ConstPathMatcherDataPtr Rename::computeSet( const IECore::InternedString
 				return false;
 			}
 
-			// Get output path for this location.
+			// Get output name for this location.
 
 			const int filterMatch = m_rename->filterValue( Context::current() );
 
 			if( m_parent )
 			{
-				m_outputPath = m_parent->m_outputPath;
-				InternedString name = path.back();
+				m_outputName = path.back();
 				if( filterMatch & PathMatcher::ExactMatch )
 				{
 					const NameMapData::Map &nameMap = m_parent->m_nameMap->map;
-					auto it = nameMap.find( name );
+					auto it = nameMap.find( m_outputName );
 					if( it != nameMap.end() )
 					{
-						name = it->outputName;
+						m_outputName = it->outputName;
 					}
 				}
-				m_outputPath.push_back( name );
 			}
 
-			// Add to set if necessary and deal with recursion.
+			// Add to set if necessary and deal with recursion. Paths in
+			// `m_set` are relative to this location.
 
 			if( filterMatch & PathMatcher::DescendantMatch )
 			{
 				if( setMatch & PathMatcher::ExactMatch )
 				{
-					m_outputSet.local().addPath( m_outputPath );
+					m_set.addPath( ScenePlug::ScenePath() );
 				}
 				// Get child map ready for use in our children, and return
 				// `true` to continue recursion.
@@ -931,34 +928,39 @@ IECore::ConstPathMatcherDataPtr Rename::computeSet( const IECore::InternedString
 				// No descendants being renamed. We can directly reference
 				// the entire subtree of the set from this point down, and
 				// have no need to recurse any further.
-				m_outputSet.local().addPaths( m_inputSet.subTree( path ), m_outputPath );
+				m_set = m_inputSet.subTree( path );
 				return false;
 			}
 		}
 
+		void gatherChildren( std::vector<LocationProcessor> &children )
+		{
+			ScenePlug::ScenePath prefix( 1 );
+			for( const auto &child : children )
+			{
+				if( !child.m_set.isEmpty() )
+				{
+					prefix.back() = child.m_outputName;
+					m_set.addPaths( child.m_set, prefix );
+				}
+			}
+		}
+
+		PathMatcher m_set;
+
 		private :
 
 			const Rename *m_rename;
 			const LocationProcessor *m_parent;
 			const PathMatcher &m_inputSet;
-			ThreadLocalSet &m_outputSet;
-			ScenePlug::ScenePath m_outputPath;
+			InternedString m_outputName;
 			ConstNameMapDataPtr m_nameMap;
 
 	};
 
 	ScenePlug::GlobalScope globalScope( context );
-	ThreadLocalSet outputSets;
-	LocationProcessor processor( this, inputSet, outputSets );
+	LocationProcessor processor( this, inputSet );
 	SceneAlgo::parallelProcessLocations( inPlug(), processor );
 
-	return new PathMatcherData(
-		outputSets.combine(
-			[] ( const PathMatcher &a, const PathMatcher &b ) {
-				PathMatcher c = a;
-				c.addPaths( b );
-				return c;
-			}
-		)
-	);
+	return new PathMatcherData( processor.m_set );
 }
@@ -48,6 +48,8 @@
 #include "IECore/Interpolator.h"
 #include "IECore/NullObject.h"
 
+#include "Imath/ImathBoxAlgo.h"
+
 #include "boost/algorithm/string/predicate.hpp"
 #include "boost/bind/bind.hpp"
 #include "boost/container/flat_set.hpp"
@@ -55,10 +57,13 @@
 #include "boost/multi_index/ordered_index.hpp"
 #include "boost/multi_index_container.hpp"
 
+#include "tbb/spin_mutex.h"
 #include "tbb/task.h"
 
 #include "fmt/format.h"
 
+#include <array>
+
 using namespace std;
 using namespace boost::placeholders;
 using namespace Imath;
@@ -230,6 +235,149 @@ struct ObjectInterfaceHandle : public boost::noncopyable
 
 };
 
+// Fractions of the screen which a location's bound must cover for
+// it to be output in each of the passes made by `updateProgressively()`.
+// Locations covering less than the final threshold are left until the
+// last pass, along with everything which is off screen.
+const std::array<float, 3> g_screenCoverageThresholds = { 0.1f, 0.01f, 0.001f };
+
+class ScreenCoverage
+{
+
+	public :
+
+		ScreenCoverage( const Camera *camera, const M44f &cameraTransform )
+			:	m_perspective( camera->getProjection() == "perspective" ),
+				m_screenWindow( camera->frustum() ),
+				m_worldToCamera( cameraTransform.inverse() )
+		{
+		}
+
+		// Returns the fraction of the screen covered by `bound`,
+		// which is specified in the space defined by `transform`.
+		float operator()( const Box3f &bound, const M44f &transform ) const
+		{
+			if( bound.isEmpty() )
+			{
+				return 0.0f;
+			}
+
+			const Box3f cameraBound = Imath::transform( bound, transform * m_worldToCamera );
+			if( cameraBound.min.z >= 0.0f )
+			{
+				// Behind the camera.
+				return 0.0f;
+			}
+
+			Box2f screenBound;
+			if( m_perspective )
+			{
+				if( cameraBound.max.z >= 0.0f )
+				{
+					// Straddles the camera, so we can't project it. Assume
+					// the worst, since it may well surround the camera.
+					return 1.0f;
+				}
+				for( int i = 0; i < 8; ++i )
+				{
+					const V3f p(
+						i & 1 ? cameraBound.max.x : cameraBound.min.x,
+						i & 2 ? cameraBound.max.y : cameraBound.min.y,
+						i & 4 ? cameraBound.max.z : cameraBound.min.z
+					);
+					screenBound.extendBy( V2f( p.x, p.y ) / -p.z );
+				}
+			}
+			else
+			{
+				screenBound = Box2f( V2f( cameraBound.min.x, cameraBound.min.y ), V2f( cameraBound.max.x, cameraBound.max.y ) );
+			}
+
+			const Box2f visibleBound(
+				V2f( std::max( screenBound.min.x, m_screenWindow.min.x ), std::max( screenBound.min.y, m_screenWindow.min.y ) ),
+				V2f( std::min( screenBound.max.x, m_screenWindow.max.x ), std::min( screenBound.max.y, m_screenWindow.max.y ) )
+			);
+			if( visibleBound.isEmpty() )
+			{
+				return 0.0f;
+			}
+
+			const V2f visibleSize = visibleBound.size();
+			const V2f screenSize = m_screenWindow.size();
+			return ( visibleSize.x * visibleSize.y ) / ( screenSize.x * screenSize.y );
+		}
+
+	private :
+
+		const bool m_perspective;
+		const Box2f m_screenWindow;
+		const M44f m_worldToCamera;
+
+};
+
+// Functor for `SceneAlgo::parallelProcessLocations()`, sorting locations
+// into tiers according to their coverage of the screen.
+class ScreenCoverageTierBuilder
+{
+
+	public :
+
+		ScreenCoverageTierBuilder( const ScreenCoverage &screenCoverage, const VisibleSet &visibleSet, size_t minimumExpansionDepth, std::vector<PathMatcher> &tiers, tbb::spin_mutex &mutex )
+			:	m_screenCoverage( screenCoverage ), m_visibleSet( visibleSet ), m_minimumExpansionDepth( minimumExpansionDepth ), m_tiers( tiers ), m_mutex( mutex )
+		{
+		}
+
+		ScreenCoverageTierBuilder( const ScreenCoverageTierBuilder &parent ) = default;
+
+		bool operator()( const ScenePlug *scene, const ScenePlug::ScenePath &path )
+		{
+			if( path.size() )
+			{
+				m_transform = scene->transformPlug()->getValue() * m_transform;
+			}
+
+			const float coverage = m_screenCoverage( scene->boundPlug()->getValue(), m_transform );
+
+			size_t tier = 0;
+			while( tier < g_screenCoverageThresholds.size() && coverage < g_screenCoverageThresholds[tier] )
+			{
+				tier++;
+			}
+
+			if( tier == g_screenCoverageThresholds.size() )
+			{
+				// Off screen or too small to matter. Because bounds
+				// enclose all descendants, the same is true of them.
+				return false;
+			}
+
+			// Matching a location in `updateInternal()` also updates its
+			// ancestors and descendants, so we only add the leaves of the
+			// traversal, where no further prioritisation is possible.
+			if(
+				!m_visibleSet.visibility( path, m_minimumExpansionDepth ).descendantsVisible ||
+				scene->childNamesPlug()->getValue()->readable().empty()
+			)
+			{
+				tbb::spin_mutex::scoped_lock lock( m_mutex );
+				m_tiers[tier].addPath( path );
+				return false;
+			}
+
+			return true;
+		}
+
+	private :
+
+		const ScreenCoverage &m_screenCoverage;
+		const VisibleSet &m_visibleSet;
+		const size_t m_minimumExpansionDepth;
+		std::vector<PathMatcher> &m_tiers;
+		tbb::spin_mutex &m_mutex;
+		M44f m_transform;
+
+};
+
 } // namespace
 
 // Represents a location in the Gaffer scene as specified to the
@@ -296,17 +444,62 @@ class RenderController::SceneGraph
 
 		void dirty( unsigned components )
 		{
-			if( ( components & m_dirtyComponents ) == components )
+			if( ( components & m_recursivelyDirtyComponents ) == components )
 			{
 				return;
 			}
 			m_dirtyComponents |= components;
+			m_recursivelyDirtyComponents |= components;
+			m_subtreeDirty = true;
 			for( const auto &c : m_children )
 			{
 				c->dirty( components );
 			}
 		}
 
+		// Dirties only the locations matched by `paths`, relying on `update()`
+		// to propagate changes in transform and attributes to descendants.
+		// Bounds are also dirtied for the ancestors of matched locations.
+		void dirty( unsigned components, const IECore::PathMatcher &paths, ScenePlug::ScenePath &path )
+		{
+			const unsigned match = paths.match( path );
+			if( match & PathMatcher::ExactMatch )
+			{
+				m_dirtyComponents |= components;
+				m_subtreeDirty = true;
+			}
+
+			if( !( match & PathMatcher::DescendantMatch ) )
+			{
+				return;
+			}
+
+			m_dirtyComponents |= ( components & BoundComponent );
+			m_subtreeDirty = true;
+
+			path.push_back( IECore::InternedString() );
+			for( const auto &c : m_children )
+			{
+				path.back() = c->name();
+				c->dirty( components, paths, path );
+			}
+			path.pop_back();
+		}
+
+		// Returns true if `update()` is needed for this location or
+		// any of its descendants.
+		bool updateRequired() const
+		{
+			return m_subtreeDirty || ( m_parent && m_parent->m_changedComponents != NoComponent );
+		}
+
+		// Called once this location and all its descendants have
+		// been updated successfully.
+		void subtreeUpdated()
+		{
+			m_subtreeDirty = false;
+		}
+
 		// Called by SceneGraphUpdateTask to update this location. Returns true if
 		// anything changed.
 		bool update( const ScenePlug::ScenePath &path, unsigned changedGlobals, Type type, RenderController *controller )
@@ -435,6 +628,10 @@ class RenderController::SceneGraph
 			if( ( m_dirtyComponents & ObjectComponent ) && updateObject( controller->m_scene->objectPlug(), type, controller->m_renderer.get(), controller->m_renderOptions, controller->m_scene.get(), controller->m_lightLinks.get() ) )
 			{
 				m_changedComponents |= ObjectComponent;
+				if( m_objectInterface )
+				{
+					controller->m_objectsTranslated++;
+				}
 			}
 
 			if( m_objectInterface )
@@ -460,6 +657,10 @@ class RenderController::SceneGraph
 							{
 								m_changedComponents |= ObjectComponent;
 								controller->m_failedAttributeEdits++;
+								if( m_objectInterface )
+								{
+									controller->m_objectsTranslated++;
+								}
 							}
 						}
 					}
@@ -611,6 +812,8 @@ class RenderController::SceneGraph
 			m_drawMode = VisibleSet::Visibility::None;
 			m_boundInterface = nullptr;
 			m_dirtyComponents = AllComponents;
+			m_recursivelyDirtyComponents = AllComponents;
+			m_subtreeDirty = true;
 		}
 
 		// Returns true if the location has not been finalised
@@ -1044,6 +1247,7 @@ class RenderController::SceneGraph
 		void clean( unsigned components )
 		{
 			m_dirtyComponents &= ~components;
+			m_recursivelyDirtyComponents &= ~components;
 		}
 
 		M44f fullTransform( float time ) const
@@ -1107,6 +1311,15 @@ class RenderController::SceneGraph
 		// Tracks work which needs to be done on
 		// the next call to `update()`.
 		unsigned m_dirtyComponents;
+		// The subset of `m_dirtyComponents` which are
+		// also known to be dirty for all descendants,
+		// allowing `dirty()` to early out.
+		unsigned m_recursivelyDirtyComponents;
+		// True if `update()` is needed for this location
+		// or any of its descendants. Allows clean branches
+		// to be skipped entirely when only a few locations
+		// have been dirtied.
+		bool m_subtreeDirty;
 		// Tracks things that were changed on the last
 		// call to `update()`. This is needed in two
 		// scenarios :
@@ -1144,7 +1357,8 @@ class RenderController::SceneGraphUpdateTask : public tbb::task
 			const ThreadState &threadState,
 			const ScenePlug::ScenePath &scenePath,
 			const ProgressCallback &callback,
-			const PathMatcher *pathsToUpdate
+			const PathMatcher *pathsToUpdate,
+			bool pruneClean
 		)
 			:	m_controller( controller ),
 				m_sceneGraph( sceneGraph ),
@@ -1153,7 +1367,8 @@ class RenderController::SceneGraphUpdateTask : public tbb::task
 				m_threadState( threadState ),
 				m_scenePath( scenePath ),
 				m_callback( callback ),
-				m_pathsToUpdate( pathsToUpdate )
+				m_pathsToUpdate( pathsToUpdate ),
+				m_pruneClean( pruneClean )
 		{
 		}
 
@@ -1166,6 +1381,13 @@ class RenderController::SceneGraphUpdateTask : public tbb::task
 				return nullptr;
 			}
 
+			if( m_pruneClean && !m_sceneGraph->updateRequired() )
+			{
+				// Nothing has been dirtied at or below this location, and
+				// nothing has changed above it, so there is nothing to do.
+				return nullptr;
+			}
+
 			// Figure out if this location belongs in the type
 			// of scene graph we're constructing. If it doesn't
 			// belong, and neither do any of its descendants,
@@ -1209,7 +1431,7 @@ class RenderController::SceneGraphUpdateTask : public tbb::task
 				for( const auto &child : children )
 				{
 					childPath.back() = child->name();
-					SceneGraphUpdateTask *t = new( allocate_child() ) SceneGraphUpdateTask( m_controller, child.get(), m_sceneGraphType, m_changedGlobalComponents, m_threadState, childPath, m_callback, m_pathsToUpdate );
+					SceneGraphUpdateTask *t = new( allocate_child() ) SceneGraphUpdateTask( m_controller, child.get(), m_sceneGraphType, m_changedGlobalComponents, m_threadState, childPath, m_callback, m_pathsToUpdate, m_pruneClean );
 					spawn( *t );
 				}
 
@@ -1228,6 +1450,11 @@ class RenderController::SceneGraphUpdateTask : public tbb::task
 				m_sceneGraph->allChildrenUpdated();
 			}
 
+			if( !m_pathsToUpdate )
+			{
+				m_sceneGraph->subtreeUpdated();
+			}
+
 			return nullptr;
 		}
 
@@ -1275,6 +1502,7 @@ class RenderController::SceneGraphUpdateTask : public tbb::task
 		ScenePlug::ScenePath m_scenePath;
 		const ProgressCallback &m_callback;
 		const PathMatcher *m_pathsToUpdate;
+		const bool m_pruneClean;
 
 };
 
@@ -1290,6 +1518,10 @@ RenderController::RenderController( const ConstScenePlugPtr &scene, const Gaffer
 		m_failedAttributeEdits( 0 ),
 		m_dirtyGlobalComponents( NoGlobalComponent ),
 		m_changedGlobalComponents( NoGlobalComponent ),
+		m_cameraOptionsChanged( false ),
+		m_objectsTranslated( 0 ),
+		m_updateStartTime( 0 ),
+		m_updateEndTime( 0 ),
 		m_manifestRequired( false )
 {
 	for( int i = SceneGraph::FirstType; i <= SceneGraph::LastType; ++i )
@@ -1486,23 +1718,23 @@ void RenderController::plugDirtied( const Gaffer::Plug *plug )
 {
 	if( plug == m_scene->boundPlug() )
 	{
-		dirtySceneGraphs( SceneGraph::BoundComponent );
+		dirtySceneGraphs( SceneGraph::BoundComponent, m_scene->boundPlug() );
 	}
 	else if( plug == m_scene->transformPlug() )
 	{
-		dirtySceneGraphs( SceneGraph::TransformComponent );
+		dirtySceneGraphs( SceneGraph::TransformComponent, m_scene->transformPlug() );
 	}
 	else if( plug == m_scene->attributesPlug() )
 	{
-		dirtySceneGraphs( SceneGraph::AttributesComponent );
+		dirtySceneGraphs( SceneGraph::AttributesComponent, m_scene->attributesPlug() );
 	}
 	else if( plug == m_scene->objectPlug() )
 	{
-		dirtySceneGraphs( SceneGraph::ObjectComponent );
+		dirtySceneGraphs( SceneGraph::ObjectComponent, m_scene->objectPlug() );
 	}
 	else if( plug == m_scene->childNamesPlug() )
 	{
-		dirtySceneGraphs( SceneGraph::ChildNamesComponent );
+		dirtySceneGraphs( SceneGraph::ChildNamesComponent, m_scene->childNamesPlug() );
 	}
 	else if( plug == m_scene->globalsPlug() )
 	{
@@ -1542,11 +1774,25 @@ void RenderController::dirtyGlobals( unsigned components )
 	m_dirtyGlobalComponents |= components;
 }
 
-void RenderController::dirtySceneGraphs( unsigned components )
+void RenderController::dirtySceneGraphs( unsigned components, const Gaffer::ValuePlug *plug )
 {
-	for( auto &sg : m_sceneGraphs )
+	IECore::PathMatcher paths;
+	if( plug && Private::DirtyPathJournal::affectedPaths( plug, paths ) )
 	{
-		sg->dirty( components );
+		// The upstream nodes have told us exactly which locations
+		// were affected, so we only need to dirty those.
+		ScenePlug::ScenePath path;
+		for( auto &sg : m_sceneGraphs )
+		{
+			sg->dirty( components, paths, path );
+		}
+	}
+	else
+	{
+		for( auto &sg : m_sceneGraphs )
+		{
+			sg->dirty( components );
+		}
 	}
 
 	if( components & SceneGraph::ObjectComponent )
@@ -1557,6 +1803,30 @@ void RenderController::dirtySceneGraphs( unsigned components )
 	}
 }
 
+// Resets the progress counters at the start of an update,
+// and records the time at which it finished.
+struct RenderController::ProgressScope
+{
+
+	ProgressScope( RenderController *controller )
+		:	m_controller( controller )
+	{
+		m_controller->m_objectsTranslated = 0;
+		m_controller->m_updateEndTime = 0;
+		m_controller->m_updateStartTime = std::chrono::steady_clock::now().time_since_epoch().count();
+	}
+
+	~ProgressScope()
+	{
+		m_controller->m_updateEndTime = std::chrono::steady_clock::now().time_since_epoch().count();
+	}
+
+	private :
+
+		RenderController *m_controller;
+
+};
+
 void RenderController::update( const ProgressCallback &callback )
 {
 	if( !m_scene || !m_context )
@@ -1569,6 +1839,7 @@ void RenderController::update( const ProgressCallback &callback )
 	Context::EditableScope scopedContext( m_context.get() );
 	scopedContext.set( "scene:renderer", &m_renderer->name().string() );
 
+	ProgressScope progressScope( this );
 	updateInternal( callback );
 }
 
@@ -1589,6 +1860,7 @@ std::shared_ptr<Gaffer::BackgroundTask> RenderController::updateInBackground( co
 		// Subject
 		m_scene.get(),
 		[this, callback, priorityPaths] {
+			ProgressScope progressScope( this );
 			if( !priorityPaths.isEmpty() )
 			{
 				updateInternal( callback, &priorityPaths, /* signalCompletion = */ false );
@@ -1610,11 +1882,163 @@ void RenderController::updateMatchingPaths( const IECore::PathMatcher &pathsToUp
 	Context::EditableScope scopedContext( m_context.get() );
 	scopedContext.set( "scene:renderer", &m_renderer->name().string() );
 
+	ProgressScope progressScope( this );
 	updateInternal( callback, &pathsToUpdate );
 }
 
+void RenderController::updateProgressively( const ProgressCallback &callback, const PassCallback &passCallback )
+{
+	if( !m_scene || !m_context )
+	{
+		return;
+	}
+
+	m_updateRequested = false;
+
+	Context::EditableScope scopedContext( m_context.get() );
+	scopedContext.set( "scene:renderer", &m_renderer->name().string() );
+
+	ProgressScope progressScope( this );
+
+	if( !m_sceneGraphs[SceneGraph::ObjectType]->cleared() )
+	{
+		// We've translated the scene already, so this is an edit.
+		updateInternal( callback );
+		return;
+	}
+
+	// Globals and sets are updated at the start of every pass, so we
+	// can't identify cameras and lights until a pass has been made.
+	// Make one that updates no locations at all.
+	const PathMatcher noPaths;
+	updateInternal( callback, &noPaths, /* signalCompletion = */ false );
+
+	PathMatcher camerasAndLights = m_renderSets.camerasSet();
+	camerasAndLights.addPaths( m_renderSets.lightsSet() );
+	camerasAndLights.addPaths( m_renderSets.lightFiltersSet() );
+	updateInternal( callback, &camerasAndLights, /* signalCompletion = */ false );
+
+	// Computing the scene data for a pass typically takes much longer than
+	// outputting it, so we do that separately, giving the caller the
+	// opportunity to run the renderer meanwhile.
+	auto preparePass = [&] ( const PathMatcher *paths ) {
+		auto prepare = [&] { prefetch( paths ); };
+		if( passCallback )
+		{
+			passCallback( prepare );
+		}
+		else
+		{
+			prepare();
+		}
+	};
+
+	for( const auto &tier : screenCoverageTiers() )
+	{
+		if( tier.isEmpty() )
+		{
+			continue;
+		}
+		preparePass( &tier );
+		updateInternal( callback, &tier, /* signalCompletion = */ false );
+	}
+
+	preparePass( nullptr );
+	updateInternal( callback );
+}
+
+RenderController::Progress RenderController::progress() const
+{
+	Progress result;
+	result.objectsTranslated = m_objectsTranslated;
+
+	const std::chrono::steady_clock::rep startTime = m_updateStartTime;
+	std::chrono::steady_clock::rep endTime = m_updateEndTime;
+	if( !endTime )
+	{
+		endTime = std::chrono::steady_clock::now().time_since_epoch().count();
+	}
+
+	const std::chrono::duration<double> duration = std::chrono::steady_clock::duration( endTime - startTime );
+	if( duration.count() > 0 )
+	{
+		result.objectsPerSecond = result.objectsTranslated / duration.count();
+	}
+
+	return result;
+}
+
+std::vector<IECore::PathMatcher> RenderController::screenCoverageTiers() const
+{
+	CameraPtr camera;
+	M44f cameraTransform;
+	const StringData *cameraOption = m_renderOptions.globals->member<StringData>( g_cameraGlobalName );
+	if( cameraOption && !cameraOption->readable().empty() )
+	{
+		const ScenePlug::ScenePath cameraPath = ScenePlug::stringToPath( cameraOption->readable() );
+		if( !SceneAlgo::exists( m_scene.get(), cameraPath ) )
+		{
+			return {};
+		}
+		ConstCameraPtr sceneCamera = runTimeCast<const Camera>( m_scene->object( cameraPath ) );
+		if( !sceneCamera )
+		{
+			return {};
+		}
+		camera = sceneCamera->copy();
+		cameraTransform = m_scene->fullTransform( cameraPath );
+	}
+	else
+	{
+		camera = new Camera;
+	}
+
+	SceneAlgo::applyCameraGlobals( camera.get(), m_renderOptions.globals.get(), m_scene.get() );
+
+	std::vector<PathMatcher> result( g_screenCoverageThresholds.size() );
+	tbb::spin_mutex mutex;
+	const ScreenCoverage screenCoverage( camera.get(), cameraTransform );
+	ScreenCoverageTierBuilder tierBuilder( screenCoverage, m_visibleSet, m_minimumExpansionDepth, result, mutex );
+	SceneAlgo::parallelProcessLocations( m_scene.get(), tierBuilder );
+
+	return result;
+}
+
+void RenderController::prefetch( const IECore::PathMatcher *paths ) const
+{
+	auto f = [this] ( const ScenePlug *scene, const ScenePlug::ScenePath &path ) {
+		scene->transformPlug()->getValue();
+		scene->attributesPlug()->getValue();
+		scene->objectPlug()->getValue();
+		return m_visibleSet.visibility( path, m_minimumExpansionDepth ).descendantsVisible;
+	};
+
+	try
+	{
+		if( paths )
+		{
+			SceneAlgo::filteredParallelTraverse( m_scene.get(), *paths, f );
+		}
+		else
+		{
+			SceneAlgo::parallelTraverse( m_scene.get(), f );
+		}
+	}
+	catch( ... )
+	{
+		// Errors will be reported by the update that follows,
+		// which is better placed to deal with them.
+	}
+}
+
 void RenderController::updateInternal( const ProgressCallback &callback, const IECore::PathMatcher *pathsToUpdate, bool signalCompletion )
 {
+	// The journal entries for the edits we're about to apply were consumed
+	// by `dirtySceneGraphs()` during dirty propagation, and are no longer
+	// needed. Clear them so that the journal doesn't grow for the lifetime
+	// of the controller.
+	Private::DirtyPathJournal::clear();
+
 	try
 	{
 		// Update globals
@@ -1630,6 +2054,7 @@ void RenderController::updateInternal( const ProgressCallback &callback, const I
 			if( cameraGlobalsChanged( renderOptions.globals.get(), m_renderOptions.globals.get(), m_scene.get() ) )
 			{
 				m_changedGlobalComponents |= CameraOptionsGlobalComponent;
+				m_cameraOptionsChanged = true;
 			}
 			if( *renderOptions.includedPurposes != *m_renderOptions.includedPurposes )
 			{
@@ -1646,6 +2071,7 @@ void RenderController::updateInternal( const ProgressCallback &callback, const I
 			if( renderOptions.shutter != m_renderOptions.shutter )
 			{
 				m_changedGlobalComponents |= CameraOptionsGlobalComponent;
+				m_cameraOptionsChanged = true;
 			}
 
 			bool needsManifest = m_manifestRequired;
@@ -1695,10 +2121,25 @@ void RenderController::updateInternal( const ProgressCallback &callback, const I
 
 		if( m_dirtyGlobalComponents & SetsGlobalComponent )
 		{
-			if( m_renderSets.update( m_scene.get() ) & Private::RendererAlgo::RenderSets::AttributesChanged )
+			const unsigned changedSets = m_renderSets.update( m_scene.get() );
+			if( changedSets & Private::RendererAlgo::RenderSets::AttributesChanged )
 			{
 				m_changedGlobalComponents |= RenderSetsGlobalComponent;
 			}
+			// Membership of the camera, light and light filter sets determines
+			// which scene graph each location belongs to, so if they have changed
+			// we must revisit every location, including those which haven't been
+			// dirtied.
+			if(
+				changedSets & (
+					Private::RendererAlgo::RenderSets::CamerasSetChanged |
+					Private::RendererAlgo::RenderSets::LightsSetChanged |
+					Private::RendererAlgo::RenderSets::LightFiltersSetChanged
+				)
+			)
+			{
+				m_changedGlobalComponents |= SetsGlobalComponent;
+			}
 			// Light linking expressions might refer to any set, so we
 			// must assume that linking needs to be recalculated.
 			if( m_lightLinks )
@@ -1727,17 +2168,27 @@ void RenderController::updateInternal( const ProgressCallback &callback, const I
 		for( int i = SceneGraph::FirstType; i <= SceneGraph::LastType; ++i )
 		{
 			SceneGraph *sceneGraph = m_sceneGraphs[i].get();
-			if( i == SceneGraph::CameraType && ( m_changedGlobalComponents & CameraOptionsGlobalComponent ) )
+			if( i == SceneGraph::CameraType && m_cameraOptionsChanged )
 			{
 				// Because the globals are applied to camera objects, we must update the object whenever
-				// the globals have changed, so we clear the scene graph and start again.
+				// the globals have changed, so we clear the scene graph and start again. We only do this
+				// once per change, so that partial updates don't remove cameras output by previous ones.
 				/// \todo Can we do better here, by using m_changedGlobalComponents in `SceneGraph::update()`?
 				sceneGraph->clear();
+				m_cameraOptionsChanged = false;
 			}
 
+			// If nothing global has changed, then only the locations we have
+			// dirtied (and their descendants) need to be visited, and we can
+			// skip clean branches of the scene graph entirely.
+			const bool pruneClean =
+				m_changedGlobalComponents == NoGlobalComponent &&
+				!( m_lightLinks && ( m_lightLinks->lightLinksDirty() || m_lightLinks->lightFilterLinksDirty() ) )
+			;
+
 			tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
 			SceneGraphUpdateTask *task = new( tbb::task::allocate_root( taskGroupContext ) ) SceneGraphUpdateTask(
-				this, sceneGraph, (SceneGraph::Type)i, m_changedGlobalComponents, ThreadState::current(), ScenePlug::ScenePath(), callback, pathsToUpdate
+				this, sceneGraph, (SceneGraph::Type)i, m_changedGlobalComponents, ThreadState::current(), ScenePlug::ScenePath(), callback, pathsToUpdate, pruneClean
 			);
 			tbb::task::spawn_root_and_wait( *task );
 
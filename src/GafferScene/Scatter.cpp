@@ -37,10 +37,14 @@
 
 #include "GafferScene/Scatter.h"
 
+#include "GafferScene/Private/IECoreScenePreview/PrimitiveAlgo.h"
+
 #include "Gaffer/StringPlug.h"
 
 #include "IECoreScene/MeshAlgo.h"
 
+#include "tbb/parallel_for.h"
+
 using namespace std;
 using namespace Imath;
 using namespace IECore;
@@ -48,6 +52,106 @@ using namespace IECoreScene;
 using namespace Gaffer;
 using namespace GafferScene;
 
+//////////////////////////////////////////////////////////////////////////
+// Internal utilities
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// The number of faces distributed by each task. This is fixed rather than
+// derived from the number of threads, so that the output doesn't depend on
+// the machine it was computed on.
+const int g_facesPerChunk = 10000;
+
+PointsPrimitivePtr distributePoints(
+	const MeshPrimitive *mesh, float density, const std::string &densityPrimitiveVariable,
+	const std::string &uv, const std::string &referencePosition, const std::string &primitiveVariables,
+	const Canceller *canceller
+)
+{
+	const int numFaces = mesh->numFaces();
+	if( numFaces <= g_facesPerChunk )
+	{
+		return MeshAlgo::distributePoints(
+			mesh, density, V2f( 0 ), densityPrimitiveVariable, uv, referencePosition, primitiveVariables, canceller
+		);
+	}
+
+	// The points generated for each face depend only on that face, so we can
+	// split the mesh into chunks of consecutive faces, distribute over them in
+	// parallel, and concatenate the results in order. This gives exactly the
+	// same result as distributing over the whole mesh at once.
+
+	IntVectorDataPtr chunkIndicesData = new IntVectorData;
+	std::vector<int> &chunkIndices = chunkIndicesData->writable();
+	chunkIndices.resize( numFaces );
+	for( int i = 0; i < numFaces; ++i )
+	{
+		chunkIndices[i] = i / g_facesPerChunk;
+	}
+
+	const MeshAlgo::MeshSplitter splitter( mesh, PrimitiveVariable( PrimitiveVariable::Uniform, chunkIndicesData ), canceller );
+	std::vector<PointsPrimitivePtr> chunks( splitter.numMeshes() );
+
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, chunks.size(), 1 ),
+		[&]( const tbb::blocked_range<size_t> &range )
+		{
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				MeshPrimitivePtr chunkMesh = splitter.mesh( i, canceller );
+				chunks[i] = MeshAlgo::distributePoints(
+					chunkMesh.get(), density, V2f( 0 ), densityPrimitiveVariable, uv, referencePosition, primitiveVariables, canceller
+				);
+			}
+		},
+		taskGroupContext
+	);
+
+	// Constant primitive variables are the same for every chunk, and would be
+	// promoted to Uniform by `mergePrimitives()`, so we set them aside and
+	// transfer them to the result directly.
+
+	PrimitiveVariableMap constantVariables;
+	for( const auto &[name, variable] : chunks[0]->variables )
+	{
+		if( variable.interpolation == PrimitiveVariable::Constant )
+		{
+			constantVariables[name] = variable;
+		}
+	}
+
+	std::vector<std::pair<const Primitive *, M44f>> toMerge;
+	toMerge.reserve( chunks.size() );
+	for( const auto &chunk : chunks )
+	{
+		for( const auto &[name, variable] : constantVariables )
+		{
+			chunk->variables.erase( name );
+		}
+		toMerge.push_back( { chunk.get(), M44f() } );
+	}
+
+	PointsPrimitivePtr result = boost::static_pointer_cast<PointsPrimitive>(
+		IECoreScenePreview::PrimitiveAlgo::mergePrimitives( toMerge, canceller )
+	);
+
+	for( const auto &[name, variable] : constantVariables )
+	{
+		result->variables[name] = variable;
+	}
+
+	return result;
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// Scatter
+//////////////////////////////////////////////////////////////////////////
+
 GAFFER_NODE_DEFINE_TYPE( Scatter );
 
 size_t Scatter::g_firstPlugIndex = 0;
@@ -143,6 +247,16 @@ const Gaffer::StringPlug *Scatter::pointTypePlug() const
 	return getChild<StringPlug>( g_firstPlugIndex + 6 );
 }
 
+Gaffer::ValuePlug::CachePolicy Scatter::computeCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == outPlug()->objectPlug() )
+	{
+		// Points are distributed in parallel.
+		return ValuePlug::CachePolicy::TaskCollaboration;
+	}
+	return BranchCreator::computeCachePolicy( output );
+}
+
 bool Scatter::affectsBranchBound( const Gaffer::Plug *input ) const
 {
 	return input == inPlug()->boundPlug();
@@ -239,10 +353,9 @@ IECore::ConstObjectPtr Scatter::computeBranchObject( const ScenePath &sourcePath
 			return outPlug()->objectPlug()->defaultValue();
 		}
 
-		PointsPrimitivePtr result = MeshAlgo::distributePoints(
+		PointsPrimitivePtr result = distributePoints(
 			mesh.get(),
 			densityPlug()->getValue(),
-			V2f( 0 ),
 			densityPrimitiveVariablePlug()->getValue(),
 			uvPlug()->getValue(),
 			referencePositionPlug()->getValue(),
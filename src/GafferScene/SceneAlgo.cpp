@@ -55,6 +55,7 @@
 #include "Gaffer/Expression.h"
 #include "Gaffer/Monitor.h"
 #include "Gaffer/NameSwitch.h"
+#include "Gaffer/Private/CacheRegistry.h"
 #include "Gaffer/Private/IECorePreview/LRUCache.h"
 #include "Gaffer/Process.h"
 #include "Gaffer/ScriptNode.h"
@@ -1242,7 +1243,10 @@ IECore::PathMatcher GafferScene::SceneAlgo::linkedLights( const ScenePlug *scene
 // Complex hashing
 //////////////////////////////////////////////////////////////////////////
 
-IECore::MurmurHash GafferScene::SceneAlgo::hierarchyHash( const ScenePlug *scene, const ScenePlug::ScenePath &root )
+namespace
+{
+
+IECore::MurmurHash hierarchyHashWalk( const ScenePlug *scene, const ScenePlug::ScenePath &root )
 {
 	return GafferScene::SceneAlgo::parallelReduceLocations(
 		scene,
@@ -1292,6 +1296,81 @@ IECore::MurmurHash GafferScene::SceneAlgo::hierarchyHash( const ScenePlug *scene
 	);
 }
 
+struct HierarchyHashCacheGetterKey
+{
+
+	HierarchyHashCacheGetterKey( const ScenePlug *scene, const ScenePlug::ScenePath &root )
+		:	scene( scene ), root( root )
+	{
+		// The hierarchy hash can only change if one of the scene's plugs has been
+		// dirtied, or if the context has changed. So we can identify it without
+		// traversing the hierarchy, using the same strategy as the hash cache in
+		// ValuePlug. We also include the hashes for the root location itself,
+		// which are cheap to acquire. Among other things, this ensures that any
+		// pending dirty propagation has been flushed before we read the dirty
+		// counts.
+		ScenePlug::PathScope pathScope( Context::current(), &root );
+		hash.append( root.data(), root.size() );
+		for( const ValuePlug *plug : {
+			scene->childNamesPlug(), scene->boundPlug(), scene->transformPlug(),
+			scene->attributesPlug(), scene->objectPlug()
+		} )
+		{
+			plug->hash( hash );
+			const ValuePlug *source = plug->source<ValuePlug>();
+			hash.append( reinterpret_cast<uint64_t>( source ) );
+			hash.append( source->dirtyCount() );
+		}
+		hash.append( Context::current()->hash() );
+	}
+
+	operator const IECore::MurmurHash & () const
+	{
+		return hash;
+	}
+
+	IECore::MurmurHash hash;
+	const ScenePlug *scene;
+	const ScenePlug::ScenePath &root;
+
+};
+
+using HierarchyHashCache = IECorePreview::LRUCache<IECore::MurmurHash, IECore::MurmurHash, IECorePreview::LRUCachePolicy::TaskParallel, HierarchyHashCacheGetterKey>;
+
+HierarchyHashCache &hierarchyHashCache()
+{
+	static HierarchyHashCache *g_cache = [] {
+		auto cache = new HierarchyHashCache(
+			[] ( const HierarchyHashCacheGetterKey &key, size_t &cost, const IECore::Canceller *canceller ) {
+				// Key and value, plus an allowance for the cache's own
+				// bookkeeping.
+				cost = sizeof( IECore::MurmurHash ) * 2 + 64;
+				return hierarchyHashWalk( key.scene, key.root );
+			},
+			0,
+			HierarchyHashCache::RemovalCallback(),
+			/* cacheErrors = */ false
+		);
+		Gaffer::Private::registerCache( cache, 1.0f / 1024.0f );
+		return cache;
+	}();
+	return *g_cache;
+}
+
+} // namespace
+
+IECore::MurmurHash GafferScene::SceneAlgo::hierarchyHash( const ScenePlug *scene, const ScenePlug::ScenePath &root )
+{
+	if( ValuePlug::getHashCacheMode() != ValuePlug::HashCacheMode::Standard )
+	{
+		// The other modes are used to check for errors in dirty propagation,
+		// so we mustn't rely on it.
+		return hierarchyHashWalk( scene, root );
+	}
+
+	return hierarchyHashCache().get( HierarchyHashCacheGetterKey( scene, root ), Context::current()->canceller() );
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Miscellaneous
 //////////////////////////////////////////////////////////////////////////
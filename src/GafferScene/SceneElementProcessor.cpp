@@ -353,3 +353,8 @@ SceneElementProcessor::BoundMethod SceneElementProcessor::boundMethod( const Gaf
 
 	return PassThrough;
 }
+
+bool SceneElementProcessor::affectedPaths( const Gaffer::Plug *input, const Gaffer::ValuePlug *output, IECore::PathMatcher &paths ) const
+{
+	return filteredAffectedPaths( input, paths );
+}
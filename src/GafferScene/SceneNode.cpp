@@ -37,6 +37,8 @@
 
 #include "GafferScene/SceneNode.h"
 
+#include "GafferScene/Private/DirtyPathJournal.h"
+
 #include "Gaffer/Context.h"
 
 #include "IECore/MessageHandler.h"
@@ -66,10 +68,23 @@ SceneNode::SceneNode( const std::string &name )
 	addChild( new BoolPlug( "enabled", Gaffer::Plug::In, true ) );
 
 	plugInputChangedSignal().connect( boost::bind( &SceneNode::plugInputChanged, this, ::_1 ) );
+	plugDirtiedSignal().connect( boost::bind( &SceneNode::plugDirtied, this, ::_1 ) );
 }
 
 SceneNode::~SceneNode()
 {
+	// Journal entries are keyed on plug addresses, so we must remove
+	// ours before they can be reused by another plug.
+	if( Private::DirtyPathJournal::observed() )
+	{
+		for( const auto &plug : ValuePlug::RecursiveRange( *this ) )
+		{
+			if( plug->children().empty() && plug->parent<ScenePlug>() )
+			{
+				Private::DirtyPathJournal::erase( plug.get() );
+			}
+		}
+	}
 }
 
 ScenePlug *SceneNode::outPlug()
@@ -133,6 +148,11 @@ void SceneNode::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outp
 			{
 				outputs.push_back( scenePlug->childBoundsPlug() );
 			}
+
+			if( input == scenePlug->setPlug() )
+			{
+				outputs.push_back( scenePlug->branchSetPlug() );
+			}
 		}
 	}
 }
@@ -211,6 +231,12 @@ void SceneNode::hash( const ValuePlug *output, const Context *context, IECore::M
 			const IECore::InternedString &setName = context->get<IECore::InternedString>( ScenePlug::setNameContextName );
 			hashSet( setName, context, scenePlug, h );
 		}
+		else if( output == scenePlug->branchSetPlug() )
+		{
+			const IECore::InternedString &setName = context->get<IECore::InternedString>( ScenePlug::setNameContextName );
+			const ScenePath &scenePath = context->get<ScenePath>( ScenePlug::scenePathContextName );
+			hashSetSubtree( setName, scenePath, context, scenePlug, h );
+		}
 		else if( output == scenePlug->existsPlug() )
 		{
 			hashExists( context, scenePlug, h );
@@ -270,6 +296,21 @@ void SceneNode::hashSet( const IECore::InternedString &setName, const Gaffer::Co
 	ComputeNode::hash( parent->setPlug(), context, h );
 }
 
+void SceneNode::hashSetSubtree( const IECore::InternedString &setName, const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const
+{
+	ScenePlug::SetScope setScope( context, &setName );
+	if( path.empty() )
+	{
+		// The branch is the whole set, so we can pass it through.
+		h = parent->setPlug()->hash();
+		return;
+	}
+
+	ComputeNode::hash( parent->branchSetPlug(), context, h );
+	parent->setPlug()->hash( h );
+	h.append( path.data(), path.size() );
+}
+
 void SceneNode::compute( ValuePlug *output, const Context *context ) const
 {
 	ScenePlug *scenePlug = output->parent<ScenePlug>();
@@ -351,6 +392,14 @@ void SceneNode::compute( ValuePlug *output, const Context *context ) const
 					computeSet( setName, context, scenePlug )
 				);
 			}
+			else if( output == scenePlug->branchSetPlug() )
+			{
+				const IECore::InternedString &setName = context->get<IECore::InternedString>( ScenePlug::setNameContextName );
+				const ScenePath &scenePath = context->get<ScenePath>( ScenePlug::scenePathContextName );
+				static_cast<ObjectPlug *>( output )->setValue(
+					computeSetSubtree( setName, scenePath, context, scenePlug )
+				);
+			}
 			else if( output == scenePlug->existsPlug() )
 			{
 				static_cast<BoolPlug *>( output )->setValue( computeExists( context, scenePlug ) );
@@ -412,6 +461,26 @@ IECore::ConstPathMatcherDataPtr SceneNode::computeSet( const IECore::InternedStr
 	throw IECore::NotImplementedException( string( typeName() ) + "::computeSet" );
 }
 
+IECore::ConstPathMatcherDataPtr SceneNode::computeSetSubtree( const IECore::InternedString &setName, const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent ) const
+{
+	ConstPathMatcherDataPtr set;
+	{
+		// Evaluate the set without `scene:path`, so that it is shared
+		// by all branches in the cache.
+		ScenePlug::SetScope setScope( context, &setName );
+		set = parent->setPlug()->getValue();
+	}
+
+	if( path.empty() )
+	{
+		return set;
+	}
+
+	PathMatcherDataPtr result = new PathMatcherData;
+	result->writable().addPaths( set->readable().subTree( path ), path );
+	return result;
+}
+
 Gaffer::ValuePlug::CachePolicy SceneNode::hashCachePolicy( const Gaffer::ValuePlug *output ) const
 {
 	if( auto parent = output->parent<ScenePlug>() )
@@ -481,13 +550,32 @@ bool SceneNode::enabled( const Gaffer::Context *context ) const
 	}
 }
 
+bool SceneNode::affectedPaths( const Gaffer::Plug *input, const Gaffer::ValuePlug *output, IECore::PathMatcher &paths ) const
+{
+	return false;
+}
+
 void SceneNode::plugInputChanged( Gaffer::Plug *plug )
 {
+	// A new input may provide different values at any location, so
+	// we must invalidate the dirty path journal for the dirtying
+	// that follows.
+
+	if( Private::DirtyPathJournal::observed() && plug->parent<ScenePlug>() )
+	{
+		if( auto valuePlug = IECore::runTimeCast<const ValuePlug>( plug ) )
+		{
+			Private::DirtyPathJournal::inputChanged( valuePlug );
+		}
+	}
+
 	// If a node makes a pass-through connection for a `childNamesPlug()` then we
 	// want to automatically create the equivalent pass-throughs for the
 	// `existsPlug()` and `sortedChildNamesPlug()`, to avoid unnecessary computes.
 	// We can't expect derived classes to do this for us, because those plugs are
-	// private, so we do it ourselves here.
+	// private, so we do it ourselves here. Likewise, a pass-through for the
+	// `setPlug()` implies one for the `branchSetPlug()`, which existing nodes
+	// know nothing about.
 
 	if( plug->direction() != Plug::Out )
 	{
@@ -495,7 +583,7 @@ void SceneNode::plugInputChanged( Gaffer::Plug *plug )
 	}
 
 	auto scene = plug->parent<ScenePlug>();
-	if( !scene || plug != scene->childNamesPlug() )
+	if( !scene || ( plug != scene->childNamesPlug() && plug != scene->setPlug() ) )
 	{
 		return;
 	}
@@ -506,8 +594,57 @@ void SceneNode::plugInputChanged( Gaffer::Plug *plug )
 		sourceScene = source->parent<ScenePlug>();
 	}
 
-	scene->existsPlug()->setInput( sourceScene ? sourceScene->existsPlug() : nullptr );
-	scene->sortedChildNamesPlug()->setInput( sourceScene ? sourceScene->sortedChildNamesPlug() : nullptr );
+	if( plug == scene->childNamesPlug() )
+	{
+		scene->existsPlug()->setInput( sourceScene ? sourceScene->existsPlug() : nullptr );
+		scene->sortedChildNamesPlug()->setInput( sourceScene ? sourceScene->sortedChildNamesPlug() : nullptr );
+	}
+	else
+	{
+		scene->branchSetPlug()->setInput( sourceScene ? sourceScene->branchSetPlug() : nullptr );
+	}
+}
+
+void SceneNode::plugDirtied( const Gaffer::Plug *plug )
+{
+	// Publish the locations affected by this edit to the dirty path journal.
+	// Dirtiness is signalled for our inputs before our outputs, so the entries
+	// are complete by the time observers are notified about the outputs.
+
+	if( !Private::DirtyPathJournal::observed() || !plug->children().empty() )
+	{
+		return;
+	}
+
+	const ScenePlug *out = outPlug();
+	const bool internal = plug->parent() == out;
+
+	AffectedPlugsContainer affected;
+	affects( plug, affected );
+	for( const auto &a : affected )
+	{
+		if( a->parent() != out )
+		{
+			continue;
+		}
+		const ValuePlug *output = static_cast<const ValuePlug *>( a );
+		IECore::PathMatcher paths;
+		// Dependencies between the children of `outPlug()` (for instance
+		// `childBoundsPlug()` depending on `transformPlug()`) inherit the
+		// journal entry of the plug they depend on.
+		const bool known = internal ?
+			Private::DirtyPathJournal::affectedPaths( static_cast<const ValuePlug *>( plug ), paths ) :
+			affectedPaths( plug, output, paths )
+		;
+		if( known )
+		{
+			Private::DirtyPathJournal::record( output, &paths );
+		}
+		else
+		{
+			Private::DirtyPathJournal::record( output, nullptr );
+		}
+	}
 }
 
 void SceneNode::hashExists( const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const
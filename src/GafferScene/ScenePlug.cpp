@@ -162,6 +162,15 @@ ScenePlug::ScenePlug( const std::string &name, Direction direction, unsigned fla
 		)
 	);
 
+	addChild(
+		new PathMatcherDataPlug(
+			"branchSet",
+			direction,
+			new IECore::PathMatcherData(),
+			childFlags
+		)
+	);
+
 	addChild(
 		new InternedStringVectorDataPlug(
 			"__sortedChildNames",
@@ -183,7 +192,7 @@ bool ScenePlug::acceptsChild( const GraphComponent *potentialChild ) const
 	{
 		return false;
 	}
-	return children().size() != 11;
+	return children().size() != 12;
 }
 
 Gaffer::PlugPtr ScenePlug::createCounterpart( const std::string &name, Direction direction ) const
@@ -304,15 +313,24 @@ const Gaffer::AtomicBox3fPlug *ScenePlug::childBoundsPlug() const
 	return getChild<AtomicBox3fPlug>( 9 );
 }
 
+Gaffer::PathMatcherDataPlug *ScenePlug::branchSetPlug()
+{
+	return getChild<PathMatcherDataPlug>( 10 );
+}
+
+const Gaffer::PathMatcherDataPlug *ScenePlug::branchSetPlug() const
+{
+	return getChild<PathMatcherDataPlug>( 10 );
+}
 
 Gaffer::InternedStringVectorDataPlug *ScenePlug::sortedChildNamesPlug()
 {
-	return getChild<InternedStringVectorDataPlug>( 10 );
+	return getChild<InternedStringVectorDataPlug>( 11 );
 }
 
 const Gaffer::InternedStringVectorDataPlug *ScenePlug::sortedChildNamesPlug() const
 {
-	return getChild<InternedStringVectorDataPlug>( 10 );
+	return getChild<InternedStringVectorDataPlug>( 11 );
 }
 
 ScenePlug::PathScope::PathScope( const Gaffer::Context *context )
@@ -504,6 +522,13 @@ IECore::ConstPathMatcherDataPtr ScenePlug::set( const IECore::InternedString &se
 	return setPlug()->getValue();
 }
 
+IECore::ConstPathMatcherDataPtr ScenePlug::branchSet( const IECore::InternedString &setName, const ScenePath &scenePath ) const
+{
+	SetScope scope( Context::current(), &setName );
+	scope.set( scenePathContextName, &scenePath );
+	return branchSetPlug()->getValue();
+}
+
 IECore::MurmurHash ScenePlug::boundHash( const ScenePath &scenePath ) const
 {
 	PathScope scope( Context::current(), &scenePath );
@@ -589,6 +614,13 @@ IECore::MurmurHash ScenePlug::setHash( const IECore::InternedString &setName ) c
 	return setPlug()->hash();
 }
 
+IECore::MurmurHash ScenePlug::branchSetHash( const IECore::InternedString &setName, const ScenePath &scenePath ) const
+{
+	SetScope scope( Context::current(), &setName );
+	scope.set( scenePathContextName, &scenePath );
+	return branchSetPlug()->hash();
+}
+
 Imath::Box3f ScenePlug::childBounds( const ScenePath &scenePath ) const
 {
 	PathScope scope( Context::current(), &scenePath );
@@ -36,20 +36,44 @@
 
 #include "GafferScene/SceneReader.h"
 
+#include "GafferScene/Private/SceneReaderIndex.h"
+
 #include "Gaffer/Context.h"
 #include "Gaffer/StringPlug.h"
 #include "Gaffer/TransformPlug.h"
+#include "Gaffer/Private/CacheRegistry.h"
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
 
 #include "IECoreScene/SceneCache.h"
 #include "IECoreScene/SharedSceneInterfaces.h"
 
+#include "IECore/IndexedIO.h"
 #include "IECore/InternedString.h"
 #include "IECore/StringAlgo.h"
+#include "IECore/VectorTypedData.h"
 
 #include "boost/bind/bind.hpp"
+#include "boost/functional/hash.hpp"
 
 #include "fmt/format.h"
 
+#include "tbb/parallel_for.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <thread>
+#include <unordered_map>
+
+#ifndef _MSC_VER
+#include <unistd.h>
+#else
+#include <process.h>
+#endif
+
 using namespace std;
 using namespace boost::placeholders;
 using namespace Imath;
@@ -63,11 +87,9 @@ using Tokenizer = boost::tokenizer<boost::char_separator<char> >;
 GAFFER_NODE_DEFINE_TYPE( SceneReader );
 
 //////////////////////////////////////////////////////////////////////////
-// SceneReader implementation
+// Internal utilities
 //////////////////////////////////////////////////////////////////////////
 
-size_t SceneReader::g_firstPlugIndex = 0;
-
 namespace
 {
 
@@ -155,8 +177,703 @@ const ValuePlug::CachePolicy g_objectCachePolicy = cachePolicyFromEnv( "GAFFERSC
 const ValuePlug::CachePolicy g_setNamesCachePolicy = cachePolicyFromEnv( "GAFFERSCENE_SCENEREADER_SETNAMES_CACHEPOLICY" );
 const ValuePlug::CachePolicy g_setCachePolicy = cachePolicyFromEnv( "GAFFERSCENE_SCENEREADER_SET_CACHEPOLICY" );
 
+void filterChildNames( const SceneInterface *s, const std::string &tagsString, vector<InternedString> &childNames )
+{
+	// Filter out any children which don't have the right tags
+
+	if( tagsString.empty() )
+	{
+		return;
+	}
+
+	Tokenizer tagsTokenizer( tagsString, boost::char_separator<char>( " " ) );
+
+	vector<InternedString> tags;
+	std::copy( tagsTokenizer.begin(), tagsTokenizer.end(), back_inserter( tags ) );
+
+	vector<InternedString>::iterator newResultEnd = childNames.begin();
+	SceneInterface::NameList childTags;
+	for( vector<InternedString>::const_iterator cIt = childNames.begin(), cEIt = childNames.end(); cIt != cEIt; ++cIt )
+	{
+		ConstSceneInterfacePtr child = s->child( *cIt );
+		childTags.clear();
+		child->readTags( childTags, IECoreScene::SceneInterface::EveryTag );
+
+		bool childMatches = false;
+		for( SceneInterface::NameList::const_iterator tIt = childTags.begin(), tEIt = childTags.end(); tIt != tEIt; ++tIt )
+		{
+			if( find( tags.begin(), tags.end(), *tIt ) != tags.end() )
+			{
+				childMatches = true;
+				break;
+			}
+		}
+
+		if( childMatches )
+		{
+			*newResultEnd++ = *cIt;
+		}
+	}
+
+	childNames.erase( newResultEnd, childNames.end() );
+}
+
+vector<InternedString> readSetNames( const SceneInterface *s, bool useSetsAPI )
+{
+	vector<InternedString> result;
+	if( useSetsAPI )
+	{
+		result = s->setNames();
+	}
+	else
+	{
+		s->readTags( result, SceneInterface::LocalTag | SceneInterface::DescendantTag );
+	}
+
+	if( shouldEmulateDefaultLightsSet( s, result ) )
+	{
+		result.push_back( g_defaultLights );
+	}
+
+	return result;
+}
+
+void loadSetWalk( const SceneInterface *s, const InternedString &setName, const IECore::Canceller *canceller, PathMatcher &set, const vector<InternedString> &path )
+{
+	if( s->hasTag( setName, SceneInterface::LocalTag ) )
+	{
+		set.addPath( path );
+	}
+
+	// Figure out if we need to recurse by querying descendant tags to see if they include
+	// anything we're interested in.
+
+	if( !s->hasTag( setName, SceneInterface::DescendantTag ) )
+	{
+		return;
+	}
+
+	// Recurse to the children.
+
+	SceneInterface::NameList childNames;
+	s->childNames( childNames );
+	vector<InternedString> childPath( path );
+	childPath.push_back( InternedString() ); // room for the child name
+	for( SceneInterface::NameList::const_iterator it = childNames.begin(), eIt = childNames.end(); it != eIt; ++it )
+	{
+		Canceller::check( canceller );
+
+		ConstSceneInterfacePtr child = s->child( *it );
+		childPath.back() = *it;
+		loadSetWalk( child.get(), setName, canceller, set, childPath );
+	}
+}
+
+PathMatcherDataPtr readSet( const SceneInterface *rootScene, const InternedString &setName, bool useSetsAPI, const IECore::Canceller *canceller )
+{
+	InternedString setNameToRead = setName;
+	if( setName == g_defaultLights )
+	{
+		vector<InternedString> setNames;
+		if( useSetsAPI )
+		{
+			setNames = rootScene->setNames();
+		}
+		else
+		{
+			rootScene->readTags( setNames, SceneInterface::LocalTag | SceneInterface::DescendantTag );
+		}
+		if( shouldEmulateDefaultLightsSet( rootScene, setNames ) )
+		{
+			setNameToRead = g_lights;
+		}
+	}
+
+	if( useSetsAPI )
+	{
+		return new PathMatcherData( rootScene->readSet( setNameToRead, /* readDescendantSets = */ true, canceller ) );
+	}
+	else
+	{
+		PathMatcherDataPtr result = new PathMatcherData;
+		loadSetWalk( rootScene, setNameToRead, canceller, result->writable(), ScenePlug::ScenePath() );
+		return result;
+	}
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// Index
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+std::string indexDirectoryFromEnv()
+{
+	const char *d = getenv( "GAFFERSCENE_SCENEREADER_INDEX_DIRECTORY" );
+	return d ? d : "";
+}
+
+// `g_indexDirectory` is guarded by `g_indexDirectoryMutex`. The directory
+// is only needed when an index is first fetched, but every compute needs to
+// know whether indexing is enabled, so that is also stored separately.
+std::mutex g_indexDirectoryMutex;
+std::string g_indexDirectory = indexDirectoryFromEnv();
+std::atomic_bool g_indexEnabled( !g_indexDirectory.empty() );
+
+std::string indexDirectory()
+{
+	std::lock_guard<std::mutex> lock( g_indexDirectoryMutex );
+	return g_indexDirectory;
+}
+
+// Incremented whenever the index cache is cleared, so that background
+// builds started before then don't add stale indices to the cache.
+std::atomic<uint64_t> g_indexGeneration( 0 );
+
+// Indices are built on background threads, so that the first computes
+// for a file aren't stalled by a walk of the entire file. Until the index
+// is available, computes read from the file directly.
+struct PendingBuilds
+{
+	std::mutex mutex;
+	std::condition_variable condition;
+	std::set<IECore::MurmurHash> hashes;
+};
+
+PendingBuilds &pendingBuilds()
+{
+	// Deliberately leaked, as builds are performed by detached threads.
+	static PendingBuilds *p = new PendingBuilds;
+	return *p;
+}
+
+// Must be incremented whenever the index format changes.
+const int g_indexVersion = 1;
+
+const IndexedIO::EntryID g_namesEntry( "names" );
+const IndexedIO::EntryID g_numChildrenEntry( "numChildren" );
+const IndexedIO::EntryID g_boundsEntry( "bounds" );
+const IndexedIO::EntryID g_hasStaticBoundEntry( "hasStaticBound" );
+const IndexedIO::EntryID g_setNamesEntry( "setNames" );
+const IndexedIO::EntryID g_setsEntry( "sets" );
+
+template<typename T>
+typename T::ConstPtr loadIndexEntry( const ConstIndexedIOPtr &io, const IndexedIO::EntryID &name )
+{
+	typename T::ConstPtr result = runTimeCast<const T>( Object::load( io, name ) );
+	if( !result )
+	{
+		throw IECore::Exception( fmt::format( "Invalid index entry \"{}\"", name.string() ) );
+	}
+	return result;
+}
+
 } // namespace
 
+// Stores the hierarchy and sets of a file in a form that can be saved to
+// disk and loaded again quickly. Locations are stored in breadth-first
+// order, so that the children of each location are contiguous.
+class SceneReader::Index : public IECore::RefCounted
+{
+
+	public :
+
+		Index( const IECore::MurmurHash &fileHash, const IECore::MurmurHash &hash )
+			:	m_fileHash( fileHash ), m_hash( hash )
+		{
+		}
+
+		static ConstIndexPtr get( const std::string &fileName, const std::string &tags, int refreshCount, const IECore::Canceller *canceller )
+		{
+			return cache()->get( CacheGetterKey( fileName, tags, refreshCount ), canceller );
+		}
+
+		static void clearCache()
+		{
+			g_indexGeneration++;
+			cache()->clear();
+		}
+
+		// Identifies the file, independent of `tags`.
+		const IECore::MurmurHash &fileHash() const
+		{
+			return m_fileHash;
+		}
+
+		// Identifies the file and `tags`.
+		const IECore::MurmurHash &hash() const
+		{
+			return m_hash;
+		}
+
+		size_t numLocations() const
+		{
+			return m_names->readable().size();
+		}
+
+		// Sets that are loaded on demand after the index has been
+		// added to the cache are not included.
+		size_t memoryUsage() const
+		{
+			size_t result =
+				sizeof( Index ) +
+				m_names->memoryUsage() + m_numChildren->memoryUsage() + m_bounds->memoryUsage() +
+				m_hasStaticBound->memoryUsage() + m_setNames->memoryUsage() +
+				m_firstChild.capacity() * sizeof( size_t ) +
+				// Includes an approximation of the overhead for each node.
+				m_children.size() * ( sizeof( ChildKey ) + sizeof( size_t ) + 2 * sizeof( void * ) )
+			;
+
+			std::lock_guard<std::mutex> lock( m_setsMutex );
+			for( const auto &[name, set] : m_sets )
+			{
+				result += set->memoryUsage();
+			}
+
+			return result;
+		}
+
+		void build( const SceneInterface *root, const std::string &tags, const IECore::Canceller *canceller )
+		{
+			// Visit the hierarchy in parallel, building a temporary tree.
+
+			tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+			BuildLocation rootLocation;
+			buildWalk( root, tags, canceller, taskGroupContext, rootLocation );
+
+			// Flatten the tree into breadth-first order.
+
+			InternedStringVectorDataPtr namesData = new InternedStringVectorData;
+			IntVectorDataPtr numChildrenData = new IntVectorData;
+			Box3fVectorDataPtr boundsData = new Box3fVectorData;
+			BoolVectorDataPtr hasStaticBoundData = new BoolVectorData;
+
+			auto &names = namesData->writable();
+			auto &numChildren = numChildrenData->writable();
+			auto &bounds = boundsData->writable();
+			auto &hasStaticBound = hasStaticBoundData->writable();
+
+			names.push_back( InternedString() );
+			std::vector<const BuildLocation *> level = { &rootLocation };
+			std::vector<const BuildLocation *> nextLevel;
+			while( level.size() )
+			{
+				for( const BuildLocation *location : level )
+				{
+					numChildren.push_back( location->children.size() );
+					bounds.push_back( location->bound );
+					hasStaticBound.push_back( location->hasStaticBound );
+					for( const auto &child : location->children )
+					{
+						names.push_back( child.name );
+						nextLevel.push_back( &child );
+					}
+				}
+				level.swap( nextLevel );
+				nextLevel.clear();
+			}
+
+			m_names = namesData;
+			m_numChildren = numChildrenData;
+			m_bounds = boundsData;
+			m_hasStaticBound = hasStaticBoundData;
+
+			// Read the sets in parallel.
+
+			const bool sets = useSetsAPI( root );
+			InternedStringVectorDataPtr setNamesData = new InternedStringVectorData( readSetNames( root, sets ) );
+			m_setNames = setNamesData;
+
+			const auto &setNames = m_setNames->readable();
+			std::vector<ConstPathMatcherDataPtr> setData( setNames.size() );
+			tbb::parallel_for(
+				tbb::blocked_range<size_t>( 0, setNames.size(), 1 ),
+				[&] ( const tbb::blocked_range<size_t> &r ) {
+					for( size_t i = r.begin(); i != r.end(); ++i )
+					{
+						setData[i] = readSet( root, setNames[i], sets, canceller );
+					}
+				},
+				taskGroupContext
+			);
+
+			for( size_t i = 0; i < setNames.size(); ++i )
+			{
+				m_sets[setNames[i]] = setData[i];
+			}
+
+			initialiseChildren();
+		}
+
+		void load( const std::string &fileName )
+		{
+			ConstIndexedIOPtr io = IndexedIO::create( fileName, IndexedIO::rootPath, IndexedIO::Read );
+			m_names = loadIndexEntry<InternedStringVectorData>( io, g_namesEntry );
+			m_numChildren = loadIndexEntry<IntVectorData>( io, g_numChildrenEntry );
+			m_bounds = loadIndexEntry<Box3fVectorData>( io, g_boundsEntry );
+			m_hasStaticBound = loadIndexEntry<BoolVectorData>( io, g_hasStaticBoundEntry );
+			m_setNames = loadIndexEntry<InternedStringVectorData>( io, g_setNamesEntry );
+			// Sets are loaded on demand.
+			m_setsIO = io->subdirectory( g_setsEntry );
+
+			const size_t numLocations = m_names->readable().size();
+			if(
+				m_numChildren->readable().size() != numLocations ||
+				m_bounds->readable().size() != numLocations ||
+				m_hasStaticBound->readable().size() != numLocations
+			)
+			{
+				throw IECore::Exception( "Inconsistent index" );
+			}
+
+			initialiseChildren();
+		}
+
+		void save( const std::string &fileName ) const
+		{
+			IndexedIOPtr io = IndexedIO::create( fileName, IndexedIO::rootPath, IndexedIO::Write );
+			m_names->save( io, g_namesEntry );
+			m_numChildren->save( io, g_numChildrenEntry );
+			m_bounds->save( io, g_boundsEntry );
+			m_hasStaticBound->save( io, g_hasStaticBoundEntry );
+			m_setNames->save( io, g_setNamesEntry );
+
+			// Set names aren't necessarily valid entry names, so we
+			// store sets by their index in `m_setNames`.
+			IndexedIOPtr setsIO = io->subdirectory( g_setsEntry, IndexedIO::CreateIfMissing );
+			const auto &setNames = m_setNames->readable();
+			for( size_t i = 0; i < setNames.size(); ++i )
+			{
+				m_sets.at( setNames[i] )->save( setsIO, std::to_string( i ) );
+			}
+		}
+
+		// Returns the index of the location at `path`, or `nullopt` if
+		// it is not in the index.
+		std::optional<size_t> location( const ScenePlug::ScenePath &path ) const
+		{
+			size_t result = 0;
+			for( const auto &name : path )
+			{
+				auto it = m_children.find( ChildKey{ result, name.c_str() } );
+				if( it == m_children.end() )
+				{
+					return std::nullopt;
+				}
+				result = it->second;
+			}
+			return result;
+		}
+
+		InternedStringVectorDataPtr childNames( size_t location ) const
+		{
+			const auto begin = m_names->readable().begin() + m_firstChild[location];
+			return new InternedStringVectorData( vector<InternedString>( begin, begin + m_numChildren->readable()[location] ) );
+		}
+
+		// Returns nullptr if the bound varies with time.
+		const Box3f *staticBound( size_t location ) const
+		{
+			return m_hasStaticBound->readable()[location] ? &m_bounds->readable()[location] : nullptr;
+		}
+
+		const InternedStringVectorData *setNames() const
+		{
+			return m_setNames.get();
+		}
+
+		ConstPathMatcherDataPtr set( const InternedString &setName ) const
+		{
+			std::lock_guard<std::mutex> lock( m_setsMutex );
+			auto it = m_sets.find( setName );
+			if( it != m_sets.end() )
+			{
+				return it->second;
+			}
+
+			const auto &setNames = m_setNames->readable();
+			auto nameIt = std::find( setNames.begin(), setNames.end(), setName );
+			if( !m_setsIO || nameIt == setNames.end() )
+			{
+				return nullptr;
+			}
+
+			ConstPathMatcherDataPtr result = loadIndexEntry<PathMatcherData>( m_setsIO, std::to_string( nameIt - setNames.begin() ) );
+			m_sets[setName] = result;
+			return result;
+		}
+
+	private :
+
+		struct BuildLocation
+		{
+			InternedString name;
+			// Bounds are only stored if they don't vary with time.
+			Box3f bound;
+			bool hasStaticBound = false;
+			std::vector<BuildLocation> children;
+		};
+
+		static void buildWalk( const SceneInterface *s, const std::string &tags, const IECore::Canceller *canceller, tbb::task_group_context &taskGroupContext, BuildLocation &location )
+		{
+			Canceller::check( canceller );
+
+			if( s->hasBound() && s->numBoundSamples() <= 1 )
+			{
+				const Box3d b = s->readBound( 0 );
+				location.bound = b.isEmpty() ? Box3f() : Box3f( b.min, b.max );
+				location.hasStaticBound = true;
+			}
+
+			SceneInterface::NameList childNames;
+			s->childNames( childNames );
+			filterChildNames( s, tags, childNames );
+
+			location.children.resize( childNames.size() );
+			tbb::parallel_for(
+				tbb::blocked_range<size_t>( 0, childNames.size() ),
+				[&] ( const tbb::blocked_range<size_t> &r ) {
+					for( size_t i = r.begin(); i != r.end(); ++i )
+					{
+						BuildLocation &child = location.children[i];
+						child.name = childNames[i];
+						buildWalk( s->child( childNames[i] ).get(), tags, canceller, taskGroupContext, child );
+					}
+				},
+				taskGroupContext
+			);
+		}
+
+		void initialiseChildren()
+		{
+			const auto &numChildren = m_numChildren->readable();
+			const auto &names = m_names->readable();
+
+			m_firstChild.resize( numChildren.size() );
+			m_children.reserve( names.size() );
+			size_t firstChild = 1;
+			for( size_t i = 0; i < numChildren.size(); ++i )
+			{
+				m_firstChild[i] = firstChild;
+				if( firstChild + numChildren[i] > names.size() )
+				{
+					throw IECore::Exception( "Inconsistent index" );
+				}
+				for( size_t c = firstChild; c < firstChild + numChildren[i]; ++c )
+				{
+					m_children[ChildKey{ i, names[c].c_str() }] = c;
+				}
+				firstChild += numChildren[i];
+			}
+		}
+
+		const IECore::MurmurHash m_fileHash;
+		const IECore::MurmurHash m_hash;
+
+		ConstInternedStringVectorDataPtr m_names;
+		ConstIntVectorDataPtr m_numChildren;
+		ConstBox3fVectorDataPtr m_bounds;
+		ConstBoolVectorDataPtr m_hasStaticBound;
+		ConstInternedStringVectorDataPtr m_setNames;
+
+		std::vector<size_t> m_firstChild;
+
+		struct ChildKey
+		{
+			size_t parent;
+			// InternedStrings are unique, so we can key on
+			// the address of the string.
+			const char *name;
+			bool operator == ( const ChildKey &other ) const
+			{
+				return parent == other.parent && name == other.name;
+			}
+		};
+
+		struct ChildKeyHash
+		{
+			size_t operator()( const ChildKey &key ) const
+			{
+				size_t result = 0;
+				boost::hash_combine( result, key.parent );
+				boost::hash_combine( result, key.name );
+				return result;
+			}
+		};
+
+		std::unordered_map<ChildKey, size_t, ChildKeyHash> m_children;
+
+		mutable std::mutex m_setsMutex;
+		mutable std::unordered_map<InternedString, ConstPathMatcherDataPtr> m_sets;
+		ConstIndexedIOPtr m_setsIO;
+
+		struct CacheGetterKey
+		{
+
+			CacheGetterKey( const std::string &fileName, const std::string &tags, int refreshCount )
+				:	fileName( fileName ), tags( tags ), refreshCount( refreshCount )
+			{
+			}
+
+			operator IECore::MurmurHash () const
+			{
+				IECore::MurmurHash result;
+				result.append( fileName );
+				result.append( tags );
+				result.append( refreshCount );
+				return result;
+			}
+
+			const std::string fileName;
+			const std::string tags;
+			const int refreshCount;
+
+		};
+
+		static ConstIndexPtr cacheGetter( const CacheGetterKey &key, size_t &cost, const IECore::Canceller *canceller )
+		{
+			cost = sizeof( Index );
+
+			std::error_code errorCode;
+			const auto modificationTime = std::filesystem::last_write_time( key.fileName, errorCode );
+			if( errorCode )
+			{
+				// Not a plain file, for instance an asset resolved by USD.
+				// We have no way of knowing when it is modified, so can't
+				// index it.
+				return nullptr;
+			}
+
+			const std::string directory = indexDirectory();
+			if( directory.empty() )
+			{
+				return nullptr;
+			}
+
+			IECore::MurmurHash fileHash;
+			fileHash.append( g_indexVersion );
+			fileHash.append( key.fileName );
+			fileHash.append( (uint64_t)modificationTime.time_since_epoch().count() );
+			fileHash.append( key.refreshCount );
+
+			IECore::MurmurHash hash = fileHash;
+			hash.append( key.tags );
+
+			const std::filesystem::path indexFileName = std::filesystem::path( directory ) / ( hash.toString() + ".fio" );
+
+			if( std::filesystem::is_regular_file( indexFileName, errorCode ) )
+			{
+				try
+				{
+					IndexPtr result = new Index( fileHash, hash );
+					result->load( indexFileName.generic_string() );
+					cost = result->memoryUsage();
+					return result;
+				}
+				catch( const std::exception &e )
+				{
+					IECore::msg(
+						IECore::Msg::Warning, "SceneReader",
+						fmt::format( "Rebuilding index \"{}\" for \"{}\" : {}", indexFileName.generic_string(), key.fileName, e.what() )
+					);
+				}
+			}
+
+			// We cache the null result until the build is complete, at which
+			// point it is replaced by the new index.
+			scheduleBuild( key, fileHash, hash, indexFileName );
+			return nullptr;
+		}
+
+		static void scheduleBuild( const CacheGetterKey &key, const IECore::MurmurHash &fileHash, const IECore::MurmurHash &hash, const std::filesystem::path &indexFileName )
+		{
+			PendingBuilds &pending = pendingBuilds();
+			{
+				std::lock_guard<std::mutex> lock( pending.mutex );
+				if( !pending.hashes.insert( hash ).second )
+				{
+					return;
+				}
+			}
+
+			std::thread(
+				[key, fileHash, hash, indexFileName, generation = g_indexGeneration.load()] {
+					buildAndSave( key, fileHash, hash, indexFileName, generation );
+					PendingBuilds &pending = pendingBuilds();
+					{
+						std::lock_guard<std::mutex> lock( pending.mutex );
+						pending.hashes.erase( hash );
+					}
+					pending.condition.notify_all();
+				}
+			).detach();
+		}
+
+		static void buildAndSave( const CacheGetterKey &key, const IECore::MurmurHash &fileHash, const IECore::MurmurHash &hash, const std::filesystem::path &indexFileName, uint64_t generation )
+		{
+			IndexPtr result = new Index( fileHash, hash );
+			try
+			{
+				result->build( SharedSceneInterfaces::get( key.fileName ).get(), key.tags, /* canceller = */ nullptr );
+			}
+			catch( ... )
+			{
+				// Errors will be reported by the computes that read
+				// the file directly.
+				return;
+			}
+
+			// Write to a temporary file and rename, so that other processes never
+			// see a partially written index.
+			try
+			{
+#ifndef _MSC_VER
+				const int pid = getpid();
+#else
+				const int pid = _getpid();
+#endif
+				const std::filesystem::path tempFileName = indexFileName.string() + fmt::format( ".{}.tmp", pid );
+				std::filesystem::create_directories( indexFileName.parent_path() );
+				result->save( tempFileName.generic_string() );
+				std::filesystem::rename( tempFileName, indexFileName );
+			}
+			catch( const std::exception &e )
+			{
+				IECore::msg(
+					IECore::Msg::Warning, "SceneReader",
+					fmt::format( "Unable to save index for \"{}\" : {}", key.fileName, e.what() )
+				);
+			}
+
+			if( generation == g_indexGeneration )
+			{
+				cache()->set( key, result, result->memoryUsage() );
+			}
+		}
+
+		using Cache = IECorePreview::LRUCache<IECore::MurmurHash, ConstIndexPtr, IECorePreview::LRUCachePolicy::TaskParallel, CacheGetterKey>;
+
+		static Cache *cache()
+		{
+			static Cache *c = [] {
+				auto cache = new Cache( cacheGetter, 0 );
+				Gaffer::Private::registerCache( cache, 1.0f / 32.0f );
+				return cache;
+			}();
+			return c;
+		}
+
+};
+
+//////////////////////////////////////////////////////////////////////////
+// SceneReader implementation
+//////////////////////////////////////////////////////////////////////////
+
+size_t SceneReader::g_firstPlugIndex = 0;
+
 SceneReader::SceneReader( const std::string &name )
 	:	SceneNode( name )
 {
@@ -285,6 +1002,21 @@ void SceneReader::hashBound( const ScenePath &path, const Gaffer::Context *conte
 {
 	SceneNode::hashBound( path, context, parent, h );
 
+	if( ConstIndexPtr i = index( context ) )
+	{
+		const std::optional<size_t> location = i->location( path );
+		if( location && i->staticBound( *location ) )
+		{
+			h.append( i->fileHash() );
+			h.append( path.data(), path.size() );
+			if( path.size() == 0 )
+			{
+				transformPlug()->hash( h );
+			}
+			return;
+		}
+	}
+
 	int refreshCount = 0;
 	ConstSceneInterfacePtr s = scene( path, context, &refreshCount );
 	if( !s )
@@ -320,14 +1052,31 @@ void SceneReader::hashBound( const ScenePath &path, const Gaffer::Context *conte
 
 Imath::Box3f SceneReader::computeBound( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent ) const
 {
-	ConstSceneInterfacePtr s = scene( path, context );
-	if( !s )
+	std::optional<Box3f> indexBound;
+	if( ConstIndexPtr i = index( context ) )
+	{
+		const std::optional<size_t> location = i->location( path );
+		if( location )
+		{
+			if( const Box3f *b = i->staticBound( *location ) )
+			{
+				indexBound = *b;
+			}
+		}
+	}
+
+	ConstSceneInterfacePtr s = indexBound ? nullptr : scene( path, context );
+	if( !s && !indexBound )
 	{
 		return Box3f();
 	}
 
 	Box3f result;
-	if( s->hasBound() )
+	if( indexBound )
+	{
+		result = *indexBound;
+	}
+	else if( s->hasBound() )
 	{
 		const Box3d b = s->readBound( timeAsDouble( context ) );
 		if( b.isEmpty() )
@@ -493,6 +1242,17 @@ IECore::ConstObjectPtr SceneReader::computeObject( const ScenePath &path, const
 
 void SceneReader::hashChildNames( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const
 {
+	if( ConstIndexPtr i = index( context ) )
+	{
+		if( const std::optional<size_t> location = i->location( path ) )
+		{
+			SceneNode::hashChildNames( path, context, parent, h );
+			h.append( i->hash() );
+			h.append( (uint64_t)*location );
+			return;
+		}
+	}
+
 	int refreshCount = 0; string tags;
 	ConstSceneInterfacePtr s = scene( path, context, &refreshCount, &tags );
 	if( !s )
@@ -511,6 +1271,14 @@ void SceneReader::hashChildNames( const ScenePath &path, const Gaffer::Context *
 
 IECore::ConstInternedStringVectorDataPtr SceneReader::computeChildNames( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent ) const
 {
+	if( ConstIndexPtr i = index( context ) )
+	{
+		if( const std::optional<size_t> location = i->location( path ) )
+		{
+			return i->childNames( *location );
+		}
+	}
+
 	string tagsString;
 	ConstSceneInterfacePtr s = scene( path, context, nullptr, &tagsString );
 	if( !s )
@@ -518,47 +1286,9 @@ IECore::ConstInternedStringVectorDataPtr SceneReader::computeChildNames( const S
 		return parent->childNamesPlug()->defaultValue();
 	}
 
-	// get the child names
-
 	InternedStringVectorDataPtr resultData = new InternedStringVectorData;
-	vector<InternedString> &result = resultData->writable();
-	s->childNames( result );
-
-	// filter out any which don't have the right tags
-
-	if( !tagsString.empty() )
-	{
-		Tokenizer tagsTokenizer( tagsString, boost::char_separator<char>( " " ) );
-
-		vector<InternedString> tags;
-		std::copy( tagsTokenizer.begin(), tagsTokenizer.end(), back_inserter( tags ) );
-
-		vector<InternedString>::iterator newResultEnd = result.begin();
-		SceneInterface::NameList childTags;
-		for( vector<InternedString>::const_iterator cIt = result.begin(), cEIt = result.end(); cIt != cEIt; ++cIt )
-		{
-			ConstSceneInterfacePtr child = s->child( *cIt );
-			childTags.clear();
-			child->readTags( childTags, IECoreScene::SceneInterface::EveryTag );
-
-			bool childMatches = false;
-			for( SceneInterface::NameList::const_iterator tIt = childTags.begin(), tEIt = childTags.end(); tIt != tEIt; ++tIt )
-			{
-				if( find( tags.begin(), tags.end(), *tIt ) != tags.end() )
-				{
-					childMatches = true;
-					break;
-				}
-			}
-
-			if( childMatches )
-			{
-				*newResultEnd++ = *cIt;
-			}
-		}
-
-		result.erase( newResultEnd, result.end() );
-	}
+	s->childNames( resultData->writable() );
+	filterChildNames( s.get(), tagsString, resultData->writable() );
 
 	return resultData;
 }
@@ -582,28 +1312,18 @@ void SceneReader::hashSetNames( const Gaffer::Context *context, const ScenePlug
 
 IECore::ConstInternedStringVectorDataPtr SceneReader::computeSetNames( const Gaffer::Context *context, const ScenePlug *parent ) const
 {
-	ConstSceneInterfacePtr s = scene( ScenePath(), context );
-	if( !s )
+	if( ConstIndexPtr i = index( context ) )
 	{
-		return parent->setNamesPlug()->defaultValue();
+		return i->setNames();
 	}
 
-	InternedStringVectorDataPtr result = new InternedStringVectorData();
-	if( useSetsAPI( s.get() ) )
-	{
-		result->writable() = s->setNames();
-	}
-	else
-	{
-		s->readTags( result->writable(), SceneInterface::LocalTag | SceneInterface::DescendantTag );
-	}
-
-	if( shouldEmulateDefaultLightsSet( s.get(), result->readable() ) )
+	ConstSceneInterfacePtr s = scene( ScenePath(), context );
+	if( !s )
 	{
-		result->writable().push_back( g_defaultLights );
+		return parent->setNamesPlug()->defaultValue();
 	}
 
-	return result;
+	return new InternedStringVectorData( readSetNames( s.get(), useSetsAPI( s.get() ) ) );
 }
 
 void SceneReader::hashSet( const IECore::InternedString &setName, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const
@@ -618,37 +1338,6 @@ void SceneReader::hashSet( const IECore::InternedString &setName, const Gaffer::
 	h.append( setName );
 }
 
-static void loadSetWalk( const SceneInterface *s, const InternedString &setName, const Gaffer::Context *context, PathMatcher &set, const vector<InternedString> &path )
-{
-	if( s->hasTag( setName, SceneInterface::LocalTag ) )
-	{
-		set.addPath( path );
-	}
-
-	// Figure out if we need to recurse by querying descendant tags to see if they include
-	// anything we're interested in.
-
-	if( !s->hasTag( setName, SceneInterface::DescendantTag ) )
-	{
-		return;
-	}
-
-	// Recurse to the children.
-
-	SceneInterface::NameList childNames;
-	s->childNames( childNames );
-	vector<InternedString> childPath( path );
-	childPath.push_back( InternedString() ); // room for the child name
-	for( SceneInterface::NameList::const_iterator it = childNames.begin(), eIt = childNames.end(); it != eIt; ++it )
-	{
-		Canceller::check( context->canceller() );
-
-		ConstSceneInterfacePtr child = s->child( *it );
-		childPath.back() = *it;
-		loadSetWalk( child.get(), setName, context, set, childPath );
-	}
-}
-
 IECore::ConstPathMatcherDataPtr SceneReader::computeSet( const IECore::InternedString &setName, const Gaffer::Context *context, const ScenePlug *parent ) const
 {
 	ConstInternedStringVectorDataPtr setNamesData = parent->setNames();
@@ -666,40 +1355,21 @@ IECore::ConstPathMatcherDataPtr SceneReader::computeSet( const IECore::InternedS
 		return outPlug()->setPlug()->defaultValue();
 	}
 
-	ConstSceneInterfacePtr rootScene = scene( ScenePath(), context );
-	if( !rootScene )
-	{
-		return outPlug()->setPlug()->defaultValue();
-	}
-
-	InternedString setNameToRead = setName;
-	if( setName == g_defaultLights )
+	if( ConstIndexPtr i = index( context ) )
 	{
-		vector<InternedString> setNames;
-		if( useSetsAPI( rootScene.get() ) )
-		{
-			setNames = rootScene->setNames();
-		}
-		else
-		{
-			rootScene->readTags( setNames, SceneInterface::LocalTag | SceneInterface::DescendantTag );
-		}
-		if( shouldEmulateDefaultLightsSet( rootScene.get(), setNames ) )
+		if( ConstPathMatcherDataPtr set = i->set( setName ) )
 		{
-			setNameToRead = g_lights;
+			return set;
 		}
 	}
 
-	if( useSetsAPI( rootScene.get() ) )
-	{
-		return new PathMatcherData( rootScene->readSet( setNameToRead, /* readDescendantSets = */ true, context->canceller() ) );
-	}
-	else
+	ConstSceneInterfacePtr rootScene = scene( ScenePath(), context );
+	if( !rootScene )
 	{
-		PathMatcherDataPtr result = new PathMatcherData;
-		loadSetWalk( rootScene.get(), setNameToRead, context, result->writable(), ScenePath() );
-		return result;
+		return outPlug()->setPlug()->defaultValue();
 	}
+
+	return readSet( rootScene.get(), setName, useSetsAPI( rootScene.get() ), context->canceller() );
 }
 
 void SceneReader::plugSet( Gaffer::Plug *plug )
@@ -711,10 +1381,50 @@ void SceneReader::plugSet( Gaffer::Plug *plug )
 	if( plug == refreshCountPlug() )
 	{
 		SharedSceneInterfaces::clear();
+		Index::clearCache();
 		m_lastScene.clear();
 	}
 }
 
+SceneReader::ConstIndexPtr SceneReader::index( const Gaffer::Context *context ) const
+{
+	if( !g_indexEnabled )
+	{
+		return nullptr;
+	}
+
+	ScenePlug::GlobalScope globalScope( context );
+	const std::string fileName = fileNamePlug()->getValue();
+	if( fileName.empty() )
+	{
+		return nullptr;
+	}
+
+	return Index::get( fileName, tagsPlug()->getValue(), refreshCountPlug()->getValue(), context->canceller() );
+}
+
+void SceneReader::setIndexDirectory( const std::string &directory )
+{
+	{
+		std::lock_guard<std::mutex> lock( g_indexDirectoryMutex );
+		g_indexDirectory = directory;
+		g_indexEnabled = !directory.empty();
+	}
+	Index::clearCache();
+}
+
+std::string SceneReader::getIndexDirectory()
+{
+	return indexDirectory();
+}
+
+void GafferScene::Private::SceneReaderIndex::waitForBuilds()
+{
+	PendingBuilds &pending = pendingBuilds();
+	std::unique_lock<std::mutex> lock( pending.mutex );
+	pending.condition.wait( lock, [&pending] { return pending.hashes.empty(); } );
+}
+
 ConstSceneInterfacePtr SceneReader::scene( const ScenePath &path, const Gaffer::Context *context, int *refreshCount, std::string *tags ) const
 {
 	ScenePlug::GlobalScope globalScope( context );
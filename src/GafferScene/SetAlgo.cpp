@@ -40,6 +40,9 @@
 
 #include "GafferScene/SetAlgo.h"
 
+#include "Gaffer/Private/CacheRegistry.h"
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
+
 #include "IECore/MessageHandler.h"
 
 #include "boost/algorithm/string/predicate.hpp"
@@ -53,6 +56,8 @@
 
 #include "fmt/format.h"
 
+#include <unordered_map>
+
 using namespace IECore;
 using namespace Gaffer;
 using namespace GafferScene;
@@ -170,14 +175,89 @@ std::ostream& operator<<( std::ostream& stream, const ExpressionAst& expr )
 }
 #endif
 
+// Hashing the AST
+// ---------------
+struct AstHasher
+{
+	using result_type = void;
+
+	AstHasher( const ScenePlug *scene, IECore::MurmurHash &h ) : m_scene( scene ), m_hash( h )
+	{
+	}
+
+	void operator()( const std::string &identifier )
+	{
+		if( identifier[0] == '/' )
+		{
+			// Object name
+			m_hash.append( identifier );
+		}
+		else
+		{
+			// Set name
+			if( !m_scene )
+			{
+				throw IECore::Exception( "SetAlgo: Invalid scene given. Can not hash set expression." );
+			}
+
+			if( !StringAlgo::hasWildcards( identifier ) )
+			{
+				m_hash.append( m_scene->setHash( identifier ) );
+				return;
+			}
+
+			IECore::ConstInternedStringVectorDataPtr setNamesData = m_scene->setNamesPlug()->getValue();
+			const std::vector<IECore::InternedString> &setNames = setNamesData->readable();
+			if( setNames.empty() )
+			{
+				return;
+			}
+
+			ScenePlug::SetScope setScope( Context::current() );
+			for( const IECore::InternedString &setName : setNames )
+			{
+				if( !StringAlgo::match( setName.string(), identifier ) )
+				{
+					continue;
+				}
+
+				setScope.setSetName( &setName );
+				m_hash.append( m_scene->setPlug()->hash() );
+			}
+		}
+	}
+
+	void operator()( const BinaryOp &expr )
+	{
+		m_hash.append( expr.op );
+		boost::apply_visitor( *this, expr.left );
+		boost::apply_visitor( *this, expr.right );
+	}
+
+	void operator()( const Nil &nil )
+	{
+	}
+
+	const ScenePlug* m_scene;
+	IECore::MurmurHash &m_hash;
+
+};
+
 // Evaluating the AST
 // ------------------
+
+struct AstEvaluator;
+// Evaluates a BinaryOp via a cache keyed on the hash of the subexpression,
+// so that subexpressions shared between expressions (or by repeated
+// evaluations of the same expression) are only computed once.
+PathMatcher evaluateSubExpression( const AstEvaluator &evaluator, const BinaryOp &expr, const IECore::MurmurHash &hash );
+
 struct AstEvaluator
 {
 	using result_type = PathMatcher;
 
 	AstEvaluator( const ScenePlug *scene )
-		: m_scene( scene )
+		: m_scene( scene ), m_context( Context::current() )
 	{
 	}
 
@@ -235,14 +315,33 @@ struct AstEvaluator
 	}
 
 	result_type operator()( const BinaryOp &expr ) const
+	{
+		return evaluateSubExpression( *this, expr, hash( expr ) );
+	}
+
+	// Evaluates `expr` without consulting the cache. Operands are only
+	// evaluated when they can affect the result, so expressions such as
+	// `emptySet & hugeSet` avoid computing `hugeSet` entirely.
+	result_type evaluate( const BinaryOp &expr ) const
 	{
 		PathMatcher left = boost::apply_visitor( *this, expr.left );
+		if( left.isEmpty() && expr.op != Union )
+		{
+			// Intersection, Difference, In and Containing all
+			// yield a subset of `left`.
+			return left;
+		}
+
 		PathMatcher right = boost::apply_visitor( *this, expr.right );
 
 		switch( expr.op )
 		{
 			case Union :
 			{
+				if( left.isEmpty() )
+				{
+					return right;
+				}
 				PathMatcher result = PathMatcher( left );
 				result.addPaths( right );
 				return result;
@@ -284,78 +383,100 @@ struct AstEvaluator
 		}
 	}
 
-	const ScenePlug *m_scene;
-
-};
-
-// Hashing the AST
-// ---------------
-struct AstHasher
-{
-	using result_type = void;
-
-	AstHasher( const ScenePlug *scene, IECore::MurmurHash &h ) : m_scene( scene ), m_hash( h )
+	// Returns a hash uniquely identifying the result of `ast`. Hashes for
+	// BinaryOps are memoised, so that the hashes for all subexpressions can
+	// be obtained in a single pass over the AST.
+	IECore::MurmurHash hash( const ExpressionAst &ast ) const
 	{
+		if( const BinaryOp *expr = boost::get<BinaryOp>( &ast ) )
+		{
+			return hash( *expr );
+		}
+
+		IECore::MurmurHash result;
+		AstHasher hasher( m_scene, result );
+		boost::apply_visitor( hasher, ast );
+		return result;
 	}
 
-	void operator()( const std::string &identifier )
+	IECore::MurmurHash hash( const BinaryOp &expr ) const
 	{
-		if( identifier[0] == '/' )
+		auto it = m_hashes.find( &expr );
+		if( it != m_hashes.end() )
 		{
-			// Object name
-			m_hash.append( identifier );
+			return it->second;
 		}
-		else
-		{
-			// Set name
-			if( !m_scene )
-			{
-				throw IECore::Exception( "SetAlgo: Invalid scene given. Can not hash set expression." );
-			}
 
-			if( !StringAlgo::hasWildcards( identifier ) )
-			{
-				m_hash.append( m_scene->setHash( identifier ) );
-				return;
-			}
+		IECore::MurmurHash result;
+		result.append( expr.op );
+		result.append( hash( expr.left ) );
+		result.append( hash( expr.right ) );
+		m_hashes[&expr] = result;
+		return result;
+	}
 
-			IECore::ConstInternedStringVectorDataPtr setNamesData = m_scene->setNamesPlug()->getValue();
-			const std::vector<IECore::InternedString> &setNames = setNamesData->readable();
-			if( setNames.empty() )
-			{
-				return;
-			}
+	const ScenePlug *m_scene;
+	const Context *m_context;
+	mutable std::unordered_map<const BinaryOp *, IECore::MurmurHash> m_hashes;
 
-			ScenePlug::SetScope setScope( Context::current() );
-			for( const IECore::InternedString &setName : setNames )
-			{
-				if( !StringAlgo::match( setName.string(), identifier ) )
-				{
-					continue;
-				}
+};
 
-				setScope.setSetName( &setName );
-				m_hash.append( m_scene->setPlug()->hash() );
-			}
-		}
-	}
+// Caching subexpressions
+// ----------------------
 
-	void operator()( const BinaryOp &expr )
+struct SubExpressionCacheGetterKey
+{
+
+	SubExpressionCacheGetterKey( const IECore::MurmurHash &hash, const BinaryOp &expr, const AstEvaluator &evaluator )
+		:	hash( hash ), expr( expr ), evaluator( evaluator )
 	{
-		m_hash.append( expr.op );
-		boost::apply_visitor( *this, expr.left );
-		boost::apply_visitor( *this, expr.right );
 	}
 
-	void operator()( const Nil &nil )
+	operator const IECore::MurmurHash & () const
 	{
+		return hash;
 	}
 
-	const ScenePlug* m_scene;
-	IECore::MurmurHash &m_hash;
+	const IECore::MurmurHash hash;
+	const BinaryOp &expr;
+	const AstEvaluator &evaluator;
 
 };
 
+// Nominal cost for a cached subexpression. PathMatcher shares unmodified
+// subtrees with the PathMatchers it was constructed from, so much of the
+// memory for a result is shared with the input sets, which are already
+// accounted for by the compute cache. Walking the result to measure it
+// would cost about as much as evaluating it in the first place, so we use
+// a fixed estimate instead.
+const size_t g_subExpressionCost = 16 * 1024;
+
+PathMatcher subExpressionCacheGetter( const SubExpressionCacheGetterKey &key, size_t &cost, const IECore::Canceller *canceller )
+{
+	Context::Scope scopedContext( key.evaluator.m_context );
+	cost = g_subExpressionCost;
+	return key.evaluator.evaluate( key.expr );
+}
+
+// Evaluation may launch TBB tasks of its own (to compute the sets), hence
+// the TaskParallel policy.
+using SubExpressionCache = IECorePreview::LRUCache<IECore::MurmurHash, PathMatcher, IECorePreview::LRUCachePolicy::TaskParallel, SubExpressionCacheGetterKey>;
+
+SubExpressionCache &subExpressionCache()
+{
+	static SubExpressionCache *g_cache = [] {
+		auto cache = new SubExpressionCache( subExpressionCacheGetter, 0 );
+		Gaffer::Private::registerCache( cache, 1.0f / 32.0f );
+		return cache;
+	}();
+	return *g_cache;
+}
+
+PathMatcher evaluateSubExpression( const AstEvaluator &evaluator, const BinaryOp &expr, const IECore::MurmurHash &hash )
+{
+	return subExpressionCache().get( SubExpressionCacheGetterKey( hash, expr, evaluator ), evaluator.m_context->canceller() );
+}
+
 template <typename Iterator>
 struct ExpressionGrammar : qi::grammar<Iterator, ExpressionAst(), ascii::space_type>
 {
@@ -482,6 +603,36 @@ void expressionToAST( const std::string &setExpression, ExpressionAst &ast)
 	}
 }
 
+// Caching ASTs
+// ------------
+
+using ConstExpressionAstPtr = std::shared_ptr<const ExpressionAst>;
+
+ConstExpressionAstPtr expressionAstCacheGetter( const std::string &setExpression, size_t &cost, const IECore::Canceller *canceller )
+{
+	// The AST is typically a small multiple of the size of the expression
+	// it was parsed from.
+	cost = sizeof( ExpressionAst ) + setExpression.size() * 8;
+	auto result = std::make_shared<ExpressionAst>();
+	expressionToAST( setExpression, *result );
+	return result;
+}
+
+// Parsing is relatively expensive, and the same expressions are evaluated
+// repeatedly, both by many different computes and by successive edits to
+// the scene. Syntax errors are cached along with valid ASTs.
+using ExpressionAstCache = IECorePreview::LRUCache<std::string, ConstExpressionAstPtr, IECorePreview::LRUCachePolicy::Parallel>;
+
+ExpressionAstCache &expressionAstCache()
+{
+	static ExpressionAstCache *g_cache = [] {
+		auto cache = new ExpressionAstCache( expressionAstCacheGetter, 0 );
+		Gaffer::Private::registerCache( cache, 1.0f / 1024.0f );
+		return cache;
+	}();
+	return *g_cache;
+}
+
 } // namespace
 
 namespace GafferScene
@@ -492,18 +643,16 @@ namespace SetAlgo
 
 PathMatcher evaluateSetExpression( const std::string &setExpression, const ScenePlug *scene )
 {
-	ExpressionAst ast;
-	expressionToAST( setExpression, ast );
-	return boost::apply_visitor( AstEvaluator( scene ), ast );
+	ConstExpressionAstPtr ast = expressionAstCache().get( setExpression );
+	return boost::apply_visitor( AstEvaluator( scene ), *ast );
 }
 
 void setExpressionHash( const std::string &setExpression, const ScenePlug* scene, IECore::MurmurHash &h )
 {
-	ExpressionAst ast;
-	expressionToAST( setExpression, ast );
+	ConstExpressionAstPtr ast = expressionAstCache().get( setExpression );
 
 	AstHasher hasher = AstHasher( scene, h );
-	boost::apply_visitor( hasher, ast );
+	boost::apply_visitor( hasher, *ast );
 }
 
 IECore::MurmurHash setExpressionHash( const std::string &setExpression, const ScenePlug* scene)
@@ -36,6 +36,8 @@
 
 #include "GafferScene/Wireframe.h"
 
+#include "GafferScene/Private/IECoreScenePreview/MeshAlgo.h"
+
 #include "Gaffer/StringPlug.h"
 
 #include "IECoreScene/MeshPrimitive.h"
@@ -92,16 +94,16 @@ struct MakeWireframe
 			using DataView = PrimitiveVariable::IndexedView<Vec>;
 
 			DataView dataView;
-			const vector<int> *vertexIds = nullptr;
+			const IntVectorData *vertexIds = nullptr;
 			switch( primitiveVariable.interpolation )
 			{
 				case PrimitiveVariable::Vertex :
 				case PrimitiveVariable::Varying :
-					vertexIds = &mesh->vertexIds()->readable();
+					vertexIds = mesh->vertexIds();
 					dataView = DataView( primitiveVariable );
 					break;
 				case PrimitiveVariable::FaceVarying :
-					vertexIds = primitiveVariable.indices ? &primitiveVariable.indices->readable() : nullptr;
+					vertexIds = primitiveVariable.indices.get();
 					dataView = DataView( data->readable(), nullptr );
 					break;
 				default :
@@ -110,22 +112,74 @@ struct MakeWireframe
 					);
 			}
 
+			ConstV2iVectorDataPtr edgesData = uniqueEdges( mesh, vertexIds, canceller );
+			const std::vector<V2i> &edges = edgesData->readable();
+
+			IECore::V3fVectorDataPtr pData = new V3fVectorData;
+			pData->setInterpretation( GeometricData::Point );
+			vector<V3f> &p = pData->writable();
+			// Each edge we add will add 2 points to `p`.
+			p.reserve( edges.size() * 2 );
+
+			for( const V2i &e : edges )
+			{
+				p.push_back( v3f( dataView[e[0]] ) );
+				p.push_back( v3f( dataView[e[1]] ) );
+				Canceller::check( canceller );
+			}
+
+			IECore::IntVectorDataPtr vertsPerCurveData = new IntVectorData;
+			vertsPerCurveData->writable().resize( p.size() / 2, 2 );
+
+			CurvesPrimitivePtr result = new CurvesPrimitive( vertsPerCurveData );
+			result->variables["P"] = PrimitiveVariable( PrimitiveVariable::Vertex, pData );
+			return result;
+		}
+
+		// Returns each edge once, as a pair of indices into the primitive variable.
+		// This depends only on the topology and indices, so we cache it for reuse
+		// by subsequent frames of deforming meshes.
+		static ConstV2iVectorDataPtr uniqueEdges( const MeshPrimitive *mesh, const IntVectorData *vertexIds, const IECore::Canceller *canceller )
+		{
+			IECore::MurmurHash key;
+			key.append( "Wireframe" );
+			if( vertexIds )
+			{
+				vertexIds->hash( key );
+			}
+			else
+			{
+				// Unindexed FaceVarying data, so edges depend only on `verticesPerFace()`.
+				key.append( "unindexed" );
+			}
 
-			using Edge = std::pair<int, int>;
+			return boost::static_pointer_cast<const V2iVectorData>(
+				IECoreScenePreview::MeshAlgo::cachedTopologyData(
+					*mesh, key,
+					[vertexIds] ( const MeshPrimitive &mesh, const IECore::Canceller *canceller ) {
+						return computeUniqueEdges( mesh, vertexIds ? &vertexIds->readable() : nullptr, canceller );
+					},
+					canceller
+				)
+			);
+		}
 
-			std::vector<Edge> edges;
+		static V2iVectorDataPtr computeUniqueEdges( const MeshPrimitive &mesh, const vector<int> *vertexIds, const IECore::Canceller *canceller )
+		{
+			V2iVectorDataPtr resultData = new V2iVectorData;
+			std::vector<V2i> &edges = resultData->writable();
 
 			// We don't know upfront how many edges we will generate.
-			// `mesh->variableSize( PrimitiveVariable::FaceVarying )` gives us
+			// `mesh.variableSize( PrimitiveVariable::FaceVarying )` gives us
 			// an upper bound, but edges can be shared by faces in which case
 			// we only add the edge once. For a fully closed mesh without border
 			// edges, we will only generate half of the edges from this upper bound.
 			// (For non-manifold meshes we could generate even fewer, but we assume
 			// we will not be given those).
-			edges.reserve( mesh->variableSize( PrimitiveVariable::FaceVarying ) );
+			edges.reserve( mesh.variableSize( PrimitiveVariable::FaceVarying ) );
 
 			int vertexIdsIndex = 0;
-			for( int numVertices : mesh->verticesPerFace()->readable() )
+			for( int numVertices : mesh.verticesPerFace()->readable() )
 			{
 				for( int i = 0; i < numVertices; ++i )
 				{
@@ -151,29 +205,16 @@ struct MakeWireframe
 			}
 
 			// We only want to output each edge once, so sort and discard duplicates
-			std::sort( edges.begin(), edges.end() );
+			std::sort(
+				edges.begin(), edges.end(),
+				[] ( const V2i &a, const V2i &b ) {
+					return a.x < b.x || ( a.x == b.x && a.y < b.y );
+				}
+			);
 			Canceller::check( canceller );
 			edges.erase( std::unique( edges.begin(), edges.end() ), edges.end() );
 
-			IECore::V3fVectorDataPtr pData = new V3fVectorData;
-			pData->setInterpretation( GeometricData::Point );
-			vector<V3f> &p = pData->writable();
-			// Each edge we add will add 2 points to `p`.
-			p.reserve( edges.size() * 2 );
-
-			for( const Edge &e : edges )
-			{
-				p.push_back( v3f( dataView[e.first] ) );
-				p.push_back( v3f( dataView[e.second] ) );
-				Canceller::check( canceller );
-			}
-
-			IECore::IntVectorDataPtr vertsPerCurveData = new IntVectorData;
-			vertsPerCurveData->writable().resize( p.size() / 2, 2 );
-
-			CurvesPrimitivePtr result = new CurvesPrimitive( vertsPerCurveData );
-			result->variables["P"] = PrimitiveVariable( PrimitiveVariable::Vertex, pData );
-			return result;
+			return resultData;
 		}
 
 		V3f v3f( const Imath::V3f &v )
@@ -235,6 +235,13 @@ PathMatcherDataPtr setWrapper( const ScenePlug &plug, const IECore::InternedStri
 	return copy ? s->copy() : boost::const_pointer_cast<PathMatcherData>( s );
 }
 
+PathMatcherDataPtr branchSetWrapper( const ScenePlug &plug, const IECore::InternedString &setName, const ScenePlug::ScenePath &scenePath, bool copy )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	ConstPathMatcherDataPtr s = plug.branchSet( setName, scenePath );
+	return copy ? s->copy() : boost::const_pointer_cast<PathMatcherData>( s );
+}
+
 IECore::MurmurHash boundHashWrapper( const ScenePlug &plug, const ScenePlug::ScenePath &scenePath )
 {
 	IECorePython::ScopedGILRelease gilRelease;
@@ -295,6 +302,12 @@ IECore::MurmurHash setHashWrapper( const ScenePlug &plug, const IECore::Interned
 	return plug.setHash( setName );
 }
 
+IECore::MurmurHash branchSetHashWrapper( const ScenePlug &plug, const IECore::InternedString &setName, const ScenePlug::ScenePath &scenePath )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return plug.branchSetHash( setName, scenePath );
+}
+
 bool existsWrapper1( const ScenePlug &plug, const ScenePlug::ScenePath &scenePath )
 {
 	IECorePython::ScopedGILRelease gilRelease;
@@ -410,6 +423,7 @@ void GafferSceneModule::bindCore()
 		.def( "globals", &globalsWrapper, ( boost::python::arg_( "_copy" ) = true ) )
 		.def( "setNames", &setNamesWrapper, ( boost::python::arg_( "_copy" ) = true ) )
 		.def( "set", &setWrapper, ( boost::python::arg_( "_copy" ) = true ) )
+		.def( "branchSet", &branchSetWrapper, ( boost::python::arg_( "_copy" ) = true ) )
 		// hash accessors
 		.def( "boundHash", &boundHashWrapper )
 		.def( "transformHash", &transformHashWrapper )
@@ -421,6 +435,7 @@ void GafferSceneModule::bindCore()
 		.def( "globalsHash", &globalsHashWrapper )
 		.def( "setNamesHash", &setNamesHashWrapper )
 		.def( "setHash", &setHashWrapper )
+		.def( "branchSetHash", &branchSetHashWrapper )
 		// existence queries
 		.def( "exists", &existsWrapper1 )
 		.def( "exists", &existsWrapper2 )
@@ -142,7 +142,17 @@ void GafferSceneModule::bindHierarchy()
 	}
 
 	{
-		scope s = GafferBindings::DependencyNodeClass<Instancer>();
+		scope s = GafferBindings::DependencyNodeClass<Instancer>()
+			.def( "prototypeStatistics", &Instancer::prototypeStatistics )
+			.def( "resetPrototypeStatistics", &Instancer::resetPrototypeStatistics )
+		;
+
+		class_<Instancer::PrototypeStatistics>( "PrototypeStatistics" )
+			.def_readonly( "instances", &Instancer::PrototypeStatistics::instances )
+			.def_readonly( "variants", &Instancer::PrototypeStatistics::variants )
+			.def_readonly( "prototypes", &Instancer::PrototypeStatistics::prototypes )
+		;
+
 		enum_<Instancer::PrototypeMode>( "PrototypeMode" )
 			.value( "IndexedRootsList", Instancer::PrototypeMode::IndexedRootsList )
 			.value( "IndexedRootsVariable", Instancer::PrototypeMode::IndexedRootsVariable )
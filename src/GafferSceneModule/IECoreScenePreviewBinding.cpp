@@ -291,6 +291,17 @@ list capturingRendererCapturedObjectNames( const CapturingRenderer &r )
 	return result;
 }
 
+list capturingRendererCapturedInstanceArrayNames( const CapturingRenderer &r )
+{
+	std::vector<std::string> t = r.capturedInstanceArrayNames();
+	list result;
+	for( auto &i : t )
+	{
+		result.append( i );
+	}
+	return result;
+}
+
 std::string capturedObjectCapturedName( const CapturingRenderer::CapturedObject &o )
 {
 	return o.capturedName();
@@ -521,6 +532,7 @@ void GafferSceneModule::bindIECoreScenePreview()
 				arg( "interpolateBoundary" ) = "",
 				arg( "faceVaryingLinearInterpolation" ) = "",
 				arg( "triangleSubdivisionRule" ) = "",
+				arg( "adaptive" ) = false,
 				arg( "canceller" ) = object()
 			)
 		);
@@ -530,6 +542,7 @@ void GafferSceneModule::bindIECoreScenePreview()
 		.def( init<Renderer::RenderType, const std::string &, const IECore::MessageHandlerPtr &>( ( arg( "renderType" ) = Renderer::RenderType::Interactive, arg( "fileName" ) = "", arg( "messageHandler") = IECore::MessageHandlerPtr() ) ) )
 		.def( "capturedObjectNames", &capturingRendererCapturedObjectNames )
 		.def( "capturedObject", &capturingRendererCapturedObject )
+		.def( "capturedInstanceArrayNames", &capturingRendererCapturedInstanceArrayNames )
 	;
 
 	IECorePython::RefCountedClass<CapturingRenderer::CapturedAttributes, Renderer::AttributesInterface>( "CapturedAttributes" )
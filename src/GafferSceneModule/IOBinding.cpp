@@ -72,6 +72,10 @@ void GafferSceneModule::bindIO()
 	GafferBindings::DependencyNodeClass<SceneReader>()
 		.def( "supportedExtensions", &supportedExtensions )
 		.staticmethod( "supportedExtensions" )
+		.def( "setIndexDirectory", &SceneReader::setIndexDirectory )
+		.staticmethod( "setIndexDirectory" )
+		.def( "getIndexDirectory", &SceneReader::getIndexDirectory )
+		.staticmethod( "getIndexDirectory" )
 	;
 
 	using SceneWriterWrapper = GafferDispatchBindings::TaskNodeWrapper<SceneWriter>;
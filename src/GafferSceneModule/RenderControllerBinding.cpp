@@ -138,6 +138,15 @@ void updateMatchingPaths( RenderController &r, const IECore::PathMatcher &pathsT
 	}
 }
 
+void updateProgressively( RenderController &r, object &pythonCallback )
+{
+	RenderController::ProgressCallback callback = progressCallbackFromPython( pythonCallback );
+	{
+		IECorePython::ScopedGILRelease gilRelease;
+		r.updateProgressively( callback );
+	}
+}
+
 } // namespace
 
 void GafferSceneModule::bindRenderController()
@@ -161,9 +170,16 @@ void GafferSceneModule::bindRenderController()
 		.def( "update", &update, ( arg( "callback" ) = object() ) )
 		.def( "updateMatchingPaths", &updateMatchingPaths, ( arg( "pathsToUpdate" ), arg( "callback" ) = object() ) )
 		.def( "updateInBackground", &updateInBackground, ( arg( "callback" ) = object(), arg( "priorityPaths" ) = IECore::PathMatcher() ) )
+		.def( "updateProgressively", &updateProgressively, ( arg( "callback" ) = object() ) )
+		.def( "progress", &RenderController::progress )
 		.def( "renderManifest", (std::shared_ptr<RenderManifest>( RenderController::*)())&RenderController::renderManifest )
 	;
 
 	SignalClass<RenderController::UpdateRequiredSignal>( "UpdateRequiredSignal" );
 
+	class_<RenderController::Progress>( "Progress" )
+		.def_readonly( "objectsTranslated", &RenderController::Progress::objectsTranslated )
+		.def_readonly( "objectsPerSecond", &RenderController::Progress::objectsPerSecond )
+	;
+
 }
@@ -45,6 +45,8 @@
 #include "GafferSceneTest/TestShader.h"
 #include "GafferSceneTest/TraverseScene.h"
 
+#include "GafferScene/Private/SceneReaderIndex.h"
+
 #include "GafferBindings/DependencyNodeBinding.h"
 
 #include "IECorePython/ScopedGILRelease.h"
@@ -58,6 +60,12 @@ static void traverseSceneWrapper( const GafferScene::ScenePlug *scenePlug )
 	traverseScene( scenePlug );
 }
 
+static void waitForSceneReaderIndexBuilds()
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	GafferScene::Private::SceneReaderIndex::waitForBuilds();
+}
+
 BOOST_PYTHON_MODULE( _GafferSceneTest )
 {
 
@@ -78,5 +86,6 @@ BOOST_PYTHON_MODULE( _GafferSceneTest )
 	def( "connectTraverseSceneToPreDispatchSignal", &connectTraverseSceneToPreDispatchSignal );
 
 	def( "testManyStringToPathCalls", &testManyStringToPathCalls );
+	def( "waitForSceneReaderIndexBuilds", &waitForSceneReaderIndexBuilds );
 
 }
@@ -44,6 +44,8 @@ import IECoreScene
 
 import Gaffer
 import GafferUI
+import GafferImage
+import GafferImageUI
 import GafferScene
 import GafferSceneUI
 
@@ -52,9 +54,28 @@ import GafferSceneUI
 preferences = application.root()["preferences"]
 preferences["viewer"] = Gaffer.Plug()
 preferences["viewer"]["gridDimensions"] = Gaffer.V2fPlug( defaultValue = imath.V2f( 10 ), minValue = imath.V2f( 0 ) )
+preferences["viewer"]["imagePrefetchFrames"] = Gaffer.IntPlug( defaultValue = 0, minValue = 0 )
+preferences["viewer"]["imagePrefetchMemoryLimit"] = Gaffer.IntPlug( defaultValue = 1024, minValue = 0 )
 
 Gaffer.Metadata.registerValue( preferences["viewer"], "plugValueWidget:type", "GafferUI.LayoutPlugValueWidget", persistent = False )
 Gaffer.Metadata.registerValue( preferences["viewer"], "layout:section", "Viewer", persistent = False )
+Gaffer.Metadata.registerValue(
+	preferences["viewer"]["imagePrefetchFrames"], "description",
+	"""
+	The number of frames the image Viewer computes in advance of the
+	current frame, in the direction of playback. Zero disables prefetching.
+	""",
+	persistent = False
+)
+Gaffer.Metadata.registerValue(
+	preferences["viewer"]["imagePrefetchMemoryLimit"], "description",
+	"""
+	The maximum amount of image data, in megabytes, that the image Viewer
+	prefetches. Values larger than the compute cache are counterproductive,
+	as prefetched frames will be evicted before they are viewed.
+	""",
+	persistent = False
+)
 
 # register a customised view for viewing scenes
 
@@ -67,6 +88,18 @@ def __sceneView( scriptNode ) :
 
 GafferUI.View.registerView( GafferScene.ScenePlug.staticTypeId(), __sceneView )
 
+# register a customised view for viewing images
+
+def __imageView( scriptNode ) :
+
+	view = GafferImageUI.ImageView( scriptNode )
+	view["prefetch"]["frames"].setInput( preferences["viewer"]["imagePrefetchFrames"] )
+	view["prefetch"]["memoryLimit"].setInput( preferences["viewer"]["imagePrefetchMemoryLimit"] )
+
+	return view
+
+GafferUI.View.registerView( GafferImage.ImagePlug.staticTypeId(), __imageView )
+
 Gaffer.Metadata.registerValue( GafferSceneUI.SceneView, "drawingMode.includedPurposes.value", "userDefault", IECore.StringVectorData( [ "default", "proxy" ] ) )
 
 # Add items to the viewer's right click menu